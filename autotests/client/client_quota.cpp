@@ -0,0 +1,309 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/region.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/shm_pool.h"
+#include "../../src/client/surface.h"
+
+#include "../../server/client.h"
+#include "../../server/compositor.h"
+#include "../../server/display.h"
+#include "../../server/surface.h"
+
+#include "../../tests/globals.h"
+
+#include <wayland-client-protocol.h>
+
+class TestClientQuota : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testResourceLimit();
+    void testResourceLimitReleased();
+    void testRequestRate();
+    void testBufferLimit();
+    void testDefaultQuota();
+
+private:
+    Wrapland::Server::Client* server_client();
+
+    struct {
+        std::unique_ptr<Wrapland::Server::Display> display;
+        Wrapland::Server::globals globals;
+    } server;
+
+    Wrapland::Client::ConnectionThread* m_connection{nullptr};
+    Wrapland::Client::Compositor* m_compositor{nullptr};
+    Wrapland::Client::ShmPool* m_shm{nullptr};
+    Wrapland::Client::EventQueue* m_queue{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-client-quota-0"};
+
+void TestClientQuota::init()
+{
+    qRegisterMetaType<Wrapland::Server::client_quota_kind>();
+    qRegisterMetaType<Wrapland::Server::Surface*>();
+
+    server.display = std::make_unique<Wrapland::Server::Display>();
+    server.display->set_socket_name(std::string(socket_name));
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.display->createShm();
+    server.globals.compositor
+        = std::make_unique<Wrapland::Server::Compositor>(server.display.get());
+
+    m_connection = new Wrapland::Client::ConnectionThread;
+    QSignalSpy connectedSpy(m_connection, &Wrapland::Client::ConnectionThread::establishedChanged);
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    m_queue = new Wrapland::Client::EventQueue(this);
+    m_queue->setup(m_connection);
+    QVERIFY(m_queue->isValid());
+
+    Wrapland::Client::Registry registry;
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Wrapland::Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection->display());
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    m_compositor = registry.createCompositor(
+        registry.interface(Wrapland::Client::Registry::Interface::Compositor).name,
+        registry.interface(Wrapland::Client::Registry::Interface::Compositor).version,
+        this);
+    QVERIFY(m_compositor->isValid());
+
+    m_shm = registry.createShmPool(
+        registry.interface(Wrapland::Client::Registry::Interface::Shm).name,
+        registry.interface(Wrapland::Client::Registry::Interface::Shm).version,
+        this);
+    QVERIFY(m_shm->isValid());
+
+    QSignalSpy clientConnectedSpy(server.display.get(),
+                                  &Wrapland::Server::Display::clientConnected);
+    QVERIFY(clientConnectedSpy.isValid());
+    QVERIFY(server_client() || clientConnectedSpy.wait());
+    QVERIFY(server_client());
+}
+
+void TestClientQuota::cleanup()
+{
+    delete m_shm;
+    m_shm = nullptr;
+    delete m_compositor;
+    m_compositor = nullptr;
+    delete m_queue;
+    m_queue = nullptr;
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+    delete m_connection;
+    m_connection = nullptr;
+
+    server = {};
+}
+
+Wrapland::Server::Client* TestClientQuota::server_client()
+{
+    auto clients = server.display->clients();
+    return clients.empty() ? nullptr : clients.front();
+}
+
+void TestClientQuota::testResourceLimit()
+{
+    auto client = server_client();
+
+    Wrapland::Server::client_quota quota;
+    quota.max_resources = {{"wl_region", 2}};
+    client->set_quota(quota);
+    QCOMPARE(client->quota().max_resources.at("wl_region"), static_cast<size_t>(2));
+
+    QSignalSpy exceeded_spy(client, &Wrapland::Server::Client::quota_exceeded);
+    QVERIFY(exceeded_spy.isValid());
+    QSignalSpy error_spy(m_connection, &Wrapland::Client::ConnectionThread::establishedChanged);
+    QVERIFY(error_spy.isValid());
+
+    std::unique_ptr<Wrapland::Client::Region> region1(m_compositor->createRegion(this));
+    std::unique_ptr<Wrapland::Client::Region> region2(m_compositor->createRegion(this));
+    std::unique_ptr<Wrapland::Client::Region> region3(m_compositor->createRegion(this));
+
+    QVERIFY(error_spy.wait());
+    QVERIFY(m_connection->hasProtocolError());
+    QCOMPARE(m_connection->protocolError(), WL_DISPLAY_ERROR_IMPLEMENTATION);
+
+    QCOMPARE(exceeded_spy.count(), 1);
+    QCOMPARE(exceeded_spy.first().first().value<Wrapland::Server::client_quota_kind>(),
+             Wrapland::Server::client_quota_kind::resources);
+}
+
+void TestClientQuota::testResourceLimitReleased()
+{
+    auto client = server_client();
+
+    Wrapland::Server::client_quota quota;
+    quota.max_resources = {{"wl_region", 1}};
+    quota.action = Wrapland::Server::client_quota_action::notify;
+    client->set_quota(quota);
+
+    QSignalSpy exceeded_spy(client, &Wrapland::Server::Client::quota_exceeded);
+    QVERIFY(exceeded_spy.isValid());
+    QSignalSpy region_spy(server.globals.compositor.get(),
+                          &Wrapland::Server::Compositor::regionCreated);
+    QVERIFY(region_spy.isValid());
+
+    // Destroyed resources do not count anymore.
+    for (int i = 0; i < 3; i++) {
+        std::unique_ptr<Wrapland::Client::Region> region(m_compositor->createRegion(this));
+        QVERIFY(region_spy.wait());
+    }
+    QVERIFY(exceeded_spy.empty());
+
+    std::unique_ptr<Wrapland::Client::Region> region1(m_compositor->createRegion(this));
+    std::unique_ptr<Wrapland::Client::Region> region2(m_compositor->createRegion(this));
+    QVERIFY(exceeded_spy.wait());
+    QCOMPARE(exceeded_spy.count(), 1);
+
+    // Only notified. The client is still connected.
+    QVERIFY(!m_connection->hasProtocolError());
+    QCOMPARE(server.display->clients().size(), static_cast<size_t>(1));
+}
+
+void TestClientQuota::testRequestRate()
+{
+    auto client = server_client();
+
+    Wrapland::Server::client_quota quota;
+    quota.requests.rate = 10;
+    quota.requests.burst = 20;
+    quota.action = Wrapland::Server::client_quota_action::notify;
+    client->set_quota(quota);
+
+    QSignalSpy exceeded_spy(client, &Wrapland::Server::Client::quota_exceeded);
+    QVERIFY(exceeded_spy.isValid());
+
+    std::unique_ptr<Wrapland::Client::Region> region(m_compositor->createRegion(this));
+    for (int i = 0; i < 100; i++) {
+        region->add(QRect(i, i, 10, 10));
+    }
+    m_connection->flush();
+
+    QVERIFY(exceeded_spy.wait());
+    QCOMPARE(exceeded_spy.first().first().value<Wrapland::Server::client_quota_kind>(),
+             Wrapland::Server::client_quota_kind::request_rate);
+
+    // Reported once while the client keeps going.
+    QTest::qWait(100);
+    QCOMPARE(exceeded_spy.count(), 1);
+}
+
+void TestClientQuota::testBufferLimit()
+{
+    auto client = server_client();
+
+    QImage image(QSize(64, 64), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::red);
+
+    Wrapland::Server::client_quota quota;
+    quota.max_buffer_bytes = static_cast<size_t>(image.sizeInBytes());
+    quota.action = Wrapland::Server::client_quota_action::notify;
+    client->set_quota(quota);
+
+    QSignalSpy exceeded_spy(client, &Wrapland::Server::Client::quota_exceeded);
+    QVERIFY(exceeded_spy.isValid());
+    QSignalSpy surface_spy(server.globals.compositor.get(),
+                           &Wrapland::Server::Compositor::surfaceCreated);
+    QVERIFY(surface_spy.isValid());
+
+    std::unique_ptr<Wrapland::Client::Surface> surface(m_compositor->createSurface());
+    QVERIFY(surface_spy.wait());
+    auto server_surface = surface_spy.first().first().value<Wrapland::Server::Surface*>();
+    QSignalSpy committed_spy(server_surface, &Wrapland::Server::Surface::committed);
+    QVERIFY(committed_spy.isValid());
+
+    // The same wl_buffer is charged once, also while the server holds it more than once.
+    auto buffer = m_shm->createBuffer(image);
+    for (int i = 0; i < 3; i++) {
+        surface->attachBuffer(buffer);
+        surface->damage(QRect(0, 0, 64, 64));
+        surface->commit(Wrapland::Client::Surface::CommitFlag::None);
+        QVERIFY(committed_spy.wait());
+    }
+    surface->attachBuffer(buffer);
+    surface->commit(Wrapland::Client::Surface::CommitFlag::None);
+    QVERIFY(committed_spy.wait());
+    QVERIFY(exceeded_spy.empty());
+
+    // Another buffer exceeds the quota.
+    auto buffer2 = m_shm->createBuffer(image);
+    surface->attachBuffer(buffer2);
+    surface->commit(Wrapland::Client::Surface::CommitFlag::None);
+    QVERIFY(exceeded_spy.wait());
+    QCOMPARE(exceeded_spy.count(), 1);
+    QCOMPARE(exceeded_spy.first().first().value<Wrapland::Server::client_quota_kind>(),
+             Wrapland::Server::client_quota_kind::buffer_bytes);
+}
+
+void TestClientQuota::testDefaultQuota()
+{
+    Wrapland::Server::client_quota quota;
+    quota.max_resources = {{"wl_surface", 5}};
+    server.display->set_client_quota(quota);
+
+    // Applies to connected clients.
+    QCOMPARE(server_client()->quota().max_resources.at("wl_surface"), static_cast<size_t>(5));
+
+    // And to clients connecting later.
+    Wrapland::Client::ConnectionThread connection;
+    QSignalSpy connectedSpy(&connection, &Wrapland::Client::ConnectionThread::establishedChanged);
+    connection.setSocketName(socket_name);
+    connection.establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+
+    QSignalSpy clientConnectedSpy(server.display.get(),
+                                  &Wrapland::Server::Display::clientConnected);
+    QVERIFY(clientConnectedSpy.isValid());
+
+    Wrapland::Client::Registry registry;
+    registry.create(connection.display());
+    registry.setup();
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Wrapland::Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    std::unique_ptr<Wrapland::Client::Compositor> compositor(registry.createCompositor(
+        registry.interface(Wrapland::Client::Registry::Interface::Compositor).name,
+        registry.interface(Wrapland::Client::Registry::Interface::Compositor).version));
+    QVERIFY(clientConnectedSpy.wait());
+
+    auto client = clientConnectedSpy.first().first().value<Wrapland::Server::Client*>();
+    QCOMPARE(client->quota().max_resources.at("wl_surface"), static_cast<size_t>(5));
+}
+
+QTEST_GUILESS_MAIN(TestClientQuota)
+#include "client_quota.moc"
@@ -0,0 +1,257 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/commit_timing_v1.h"
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/surface.h"
+
+#include "../../server/commit_timing_v1.h"
+#include "../../server/compositor.h"
+#include "../../server/display.h"
+#include "../../server/surface.h"
+
+#include "../../tests/globals.h"
+
+#include <wayland-commit-timing-v1-client-protocol.h>
+
+using namespace Wrapland;
+
+class TestCommitTiming : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestCommitTiming(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testTargetTime();
+    void testTargetTimeSaturated();
+    void testTimestampErrors_data();
+    void testTimestampErrors();
+
+private:
+    struct {
+        std::unique_ptr<Server::Display> display;
+        Server::globals globals;
+    } server;
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::Compositor* m_compositor{nullptr};
+    Client::commit_timing_manager_v1* m_commit_timing{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-commit-timing-0"};
+
+TestCommitTiming::TestCommitTiming(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<Server::Surface*>();
+}
+
+void TestCommitTiming::init()
+{
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.commit_timing_manager_v1
+        = std::make_unique<Server::commit_timing_manager_v1>(server.display.get());
+
+    // setup connection
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy connectedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(connectedSpy.isValid());
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+
+    Client::Registry registry;
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection);
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    auto const compositor = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor = registry.createCompositor(compositor.name, compositor.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    auto const commit_timing
+        = registry.interface(Client::Registry::Interface::CommitTimingManagerV1);
+    QVERIFY(commit_timing.name != 0);
+    m_commit_timing = registry.createCommitTimingManagerV1(
+        commit_timing.name, commit_timing.version, this);
+    QVERIFY(m_commit_timing->isValid());
+}
+
+void TestCommitTiming::cleanup()
+{
+#define CLEANUP(variable)                                                                          \
+    if (variable) {                                                                                \
+        delete variable;                                                                           \
+        variable = nullptr;                                                                        \
+    }
+    CLEANUP(m_commit_timing)
+    CLEANUP(m_compositor)
+    CLEANUP(m_queue)
+    if (m_connection) {
+        m_connection->deleteLater();
+        m_connection = nullptr;
+    }
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+#undef CLEANUP
+
+    server = {};
+}
+
+void TestCommitTiming::testTargetTime()
+{
+    // Commits with a target time are applied once the presentation time reaches the target.
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+
+    std::unique_ptr<Client::Surface> surface(m_compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Server::Surface*>();
+    QVERIFY(serverSurface);
+
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+    QSignalSpy queuedSpy(serverSurface, &Server::Surface::commit_queued);
+    QVERIFY(queuedSpy.isValid());
+
+    auto timer = m_commit_timing->get_timer(surface.get());
+
+    wp_commit_timer_v1_set_timestamp(timer, 0, 10, 500);
+    surface->setScale(2);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(queuedSpy.wait());
+    QVERIFY(serverSurface->has_queued_commits());
+
+    // A commit without target time following it is queued as well.
+    surface->setScale(3);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(queuedSpy.wait());
+    QCOMPARE(queuedSpy.count(), 2);
+
+    using namespace std::chrono_literals;
+
+    serverSurface->apply_queued_commits(10s);
+    QCOMPARE(committedSpy.count(), 0);
+    QCOMPARE(serverSurface->state().scale, 1);
+
+    serverSurface->apply_queued_commits(10s + 500ns);
+    QCOMPARE(committedSpy.count(), 2);
+    QCOMPARE(serverSurface->state().scale, 3);
+    QVERIFY(!serverSurface->has_queued_commits());
+
+    // Without target time commits are applied directly.
+    surface->setScale(1);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().scale, 1);
+    QCOMPARE(queuedSpy.count(), 2);
+    QVERIFY(!m_connection->error());
+
+    wp_commit_timer_v1_destroy(timer);
+}
+
+void TestCommitTiming::testTargetTimeSaturated()
+{
+    // Timestamps beyond the range of the target time saturate instead of overflowing.
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+
+    std::unique_ptr<Client::Surface> surface(m_compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Server::Surface*>();
+    QVERIFY(serverSurface);
+
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+    QSignalSpy queuedSpy(serverSurface, &Server::Surface::commit_queued);
+    QVERIFY(queuedSpy.isValid());
+
+    auto timer = m_commit_timing->get_timer(surface.get());
+
+    wp_commit_timer_v1_set_timestamp(timer, 0xffffffff, 0xffffffff, 999999999);
+    surface->setScale(2);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(queuedSpy.wait());
+    QVERIFY(!m_connection->error());
+
+    using namespace std::chrono_literals;
+
+    serverSurface->apply_queued_commits(std::chrono::nanoseconds::max() - 1ns);
+    QCOMPARE(committedSpy.count(), 0);
+
+    serverSurface->apply_queued_commits(std::chrono::nanoseconds::max());
+    QCOMPARE(committedSpy.count(), 1);
+    QCOMPARE(serverSurface->state().scale, 2);
+
+    wp_commit_timer_v1_destroy(timer);
+}
+
+void TestCommitTiming::testTimestampErrors_data()
+{
+    QTest::addColumn<uint32_t>("tv_nsec");
+    QTest::addColumn<bool>("twice");
+
+    QTest::newRow("invalid-nsec") << 1000000000U << false;
+    QTest::newRow("already-set") << 0U << true;
+}
+
+void TestCommitTiming::testTimestampErrors()
+{
+    QFETCH(uint32_t, tv_nsec);
+    QFETCH(bool, twice);
+
+    std::unique_ptr<Client::Surface> surface(m_compositor->createSurface());
+
+    QSignalSpy errorSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(errorSpy.isValid());
+
+    auto timer = m_commit_timing->get_timer(surface.get());
+    wp_commit_timer_v1_set_timestamp(timer, 0, 1, tv_nsec);
+    if (twice) {
+        wp_commit_timer_v1_set_timestamp(timer, 0, 2, tv_nsec);
+    }
+
+    QVERIFY(errorSpy.wait());
+    QVERIFY(m_connection->error());
+
+    wp_commit_timer_v1_destroy(timer);
+}
+
+QTEST_GUILESS_MAIN(TestCommitTiming)
+#include "commit_timing.moc"
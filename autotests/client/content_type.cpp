@@ -0,0 +1,194 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/content_type_v1.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/surface.h"
+
+#include "../../server/compositor.h"
+#include "../../server/content_type_v1.h"
+#include "../../server/display.h"
+#include "../../server/surface.h"
+
+#include "../../tests/globals.h"
+
+#include <wayland-content-type-v1-client-protocol.h>
+
+using namespace Wrapland;
+
+class TestContentType : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestContentType(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testContentType();
+
+private:
+    struct {
+        std::unique_ptr<Server::Display> display;
+        Server::globals globals;
+    } server;
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::Compositor* m_compositor{nullptr};
+    Client::content_type_manager_v1* m_content_type{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-content-type-0"};
+
+TestContentType::TestContentType(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<Server::Surface*>();
+}
+
+void TestContentType::init()
+{
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.content_type_manager_v1
+        = std::make_unique<Server::content_type_manager_v1>(server.display.get());
+
+    // setup connection
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy connectedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(connectedSpy.isValid());
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+
+    Client::Registry registry;
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection);
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    auto const compositor = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor = registry.createCompositor(compositor.name, compositor.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    auto const content_type = registry.interface(Client::Registry::Interface::ContentTypeManagerV1);
+    QVERIFY(content_type.name != 0);
+    m_content_type
+        = registry.createContentTypeManagerV1(content_type.name, content_type.version, this);
+    QVERIFY(m_content_type->isValid());
+}
+
+void TestContentType::cleanup()
+{
+#define CLEANUP(variable)                                                                          \
+    if (variable) {                                                                                \
+        delete variable;                                                                           \
+        variable = nullptr;                                                                        \
+    }
+    CLEANUP(m_content_type)
+    CLEANUP(m_compositor)
+    CLEANUP(m_queue)
+    if (m_connection) {
+        m_connection->deleteLater();
+        m_connection = nullptr;
+    }
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+#undef CLEANUP
+
+    server = {};
+}
+
+void TestContentType::testContentType()
+{
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+
+    std::unique_ptr<Client::Surface> surface(m_compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Server::Surface*>();
+    QVERIFY(serverSurface);
+    QCOMPARE(serverSurface->state().content_type, Server::surface_content_type::none);
+
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+
+    auto content_type = m_content_type->get_surface_content_type(surface.get());
+    wp_content_type_v1_set_content_type(content_type, WP_CONTENT_TYPE_V1_TYPE_VIDEO);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+
+    QCOMPARE(serverSurface->state().content_type, Server::surface_content_type::video);
+    QVERIFY(serverSurface->state().updates & Server::surface_change::content_type);
+
+    // Without a new type the state is kept.
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().content_type, Server::surface_content_type::video);
+    QVERIFY(!(serverSurface->state().updates & Server::surface_change::content_type));
+
+    wp_content_type_v1_set_content_type(content_type, WP_CONTENT_TYPE_V1_TYPE_PHOTO);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().content_type, Server::surface_content_type::photo);
+
+    wp_content_type_v1_set_content_type(content_type, WP_CONTENT_TYPE_V1_TYPE_NONE);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().content_type, Server::surface_content_type::none);
+
+    wp_content_type_v1_set_content_type(content_type, WP_CONTENT_TYPE_V1_TYPE_GAME);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().content_type, Server::surface_content_type::game);
+
+    // Without the object the surface has no content type.
+    wp_content_type_v1_destroy(content_type);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().content_type, Server::surface_content_type::none);
+    QVERIFY(serverSurface->state().updates & Server::surface_change::content_type);
+
+    // A second object for the surface sets a type again.
+    content_type = m_content_type->get_surface_content_type(surface.get());
+    wp_content_type_v1_set_content_type(content_type, WP_CONTENT_TYPE_V1_TYPE_GAME);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().content_type, Server::surface_content_type::game);
+    QVERIFY(!m_connection->error());
+
+    wp_content_type_v1_destroy(content_type);
+}
+
+QTEST_GUILESS_MAIN(TestContentType)
+#include "content_type.moc"
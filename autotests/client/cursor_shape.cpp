@@ -0,0 +1,250 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/cursor_shape_v1.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/pointer.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/seat.h"
+#include "../../src/client/surface.h"
+
+#include "../../server/compositor.h"
+#include "../../server/cursor_shape_v1.h"
+#include "../../server/display.h"
+#include "../../server/pointer.h"
+#include "../../server/pointer_pool.h"
+#include "../../server/seat.h"
+#include "../../server/surface.h"
+
+#include "../../tests/globals.h"
+
+#include <wayland-cursor-shape-v1-client-protocol.h>
+
+using namespace Wrapland;
+
+class TestCursorShape : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestCursorShape(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testShape();
+    void testInvalidShape();
+
+private:
+    Server::Pointer* enter_pointer(Client::Pointer* pointer, quint32& serial);
+
+    struct {
+        std::unique_ptr<Server::Display> display;
+        Server::globals globals;
+        Server::Seat* seat{nullptr};
+    } server;
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::Compositor* m_compositor{nullptr};
+    Client::Seat* m_seat{nullptr};
+    Client::cursor_shape_manager_v1* m_cursor_shape{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-cursor-shape-0"};
+
+TestCursorShape::TestCursorShape(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<Server::Surface*>();
+}
+
+void TestCursorShape::init()
+{
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.cursor_shape_manager_v1
+        = std::make_unique<Server::cursor_shape_manager_v1>(server.display.get());
+    server.globals.seats.emplace_back(std::make_unique<Server::Seat>(server.display.get()));
+    server.seat = server.globals.seats.back().get();
+    server.seat->setHasPointer(true);
+
+    // setup connection
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy connectedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(connectedSpy.isValid());
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+
+    Client::Registry registry;
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection);
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    auto const compositor = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor = registry.createCompositor(compositor.name, compositor.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    auto const seat = registry.interface(Client::Registry::Interface::Seat);
+    m_seat = registry.createSeat(seat.name, seat.version, this);
+    QSignalSpy hasPointerSpy(m_seat, &Client::Seat::hasPointerChanged);
+    QVERIFY(hasPointerSpy.wait());
+
+    auto const cursor_shape = registry.interface(Client::Registry::Interface::CursorShapeManagerV1);
+    QVERIFY(cursor_shape.name != 0);
+    m_cursor_shape
+        = registry.createCursorShapeManagerV1(cursor_shape.name, cursor_shape.version, this);
+    QVERIFY(m_cursor_shape->isValid());
+}
+
+void TestCursorShape::cleanup()
+{
+#define CLEANUP(variable)                                                                          \
+    if (variable) {                                                                                \
+        delete variable;                                                                           \
+        variable = nullptr;                                                                        \
+    }
+    CLEANUP(m_cursor_shape)
+    CLEANUP(m_seat)
+    CLEANUP(m_compositor)
+    CLEANUP(m_queue)
+    if (m_connection) {
+        m_connection->deleteLater();
+        m_connection = nullptr;
+    }
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+#undef CLEANUP
+
+    server = {};
+}
+
+Server::Pointer* TestCursorShape::enter_pointer(Client::Pointer* pointer, quint32& serial)
+{
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    m_compositor->createSurface(m_compositor);
+    if (!surfaceCreatedSpy.wait()) {
+        return nullptr;
+    }
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Server::Surface*>();
+
+    QSignalSpy enteredSpy(pointer, &Client::Pointer::entered);
+
+    auto& server_pointers = server.seat->pointers();
+    server_pointers.set_focused_surface(serverSurface);
+    serial = server.display->serial();
+
+    if (!enteredSpy.wait() || server_pointers.get_focus().devices.empty()) {
+        return nullptr;
+    }
+    return server_pointers.get_focus().devices.front();
+}
+
+void TestCursorShape::testShape()
+{
+    // A shape replaces the cursor surface and the other way around.
+    std::unique_ptr<Client::Pointer> pointer(m_seat->createPointer());
+    QVERIFY(pointer->isValid());
+
+    quint32 serial{0};
+    auto serverPointer = enter_pointer(pointer.get(), serial);
+    QVERIFY(serverPointer);
+    QVERIFY(!serverPointer->cursor());
+
+    QSignalSpy cursorChangedSpy(serverPointer, &Server::Pointer::cursorChanged);
+    QVERIFY(cursorChangedSpy.isValid());
+
+    auto device = m_cursor_shape->get_pointer(pointer.get());
+    wp_cursor_shape_device_v1_set_shape(device, serial, WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_TEXT);
+    QVERIFY(cursorChangedSpy.wait());
+
+    auto cursor = serverPointer->cursor();
+    QVERIFY(cursor);
+    QCOMPARE(cursor->shape(), Server::cursor_shape::text);
+    QCOMPARE(cursor->enteredSerial(), serial);
+    QVERIFY(!cursor->surface());
+
+    QSignalSpy shapeChangedSpy(cursor, &Server::Cursor::shapeChanged);
+    QVERIFY(shapeChangedSpy.isValid());
+    QSignalSpy surfaceChangedSpy(cursor, &Server::Cursor::surfaceChanged);
+    QVERIFY(surfaceChangedSpy.isValid());
+
+    wp_cursor_shape_device_v1_set_shape(device, serial, WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_DEFAULT);
+    QVERIFY(shapeChangedSpy.wait());
+    QCOMPARE(cursor->shape(), Server::cursor_shape::default_);
+
+    wp_cursor_shape_device_v1_set_shape(device, serial, WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_ZOOM_OUT);
+    QVERIFY(shapeChangedSpy.wait());
+    QCOMPARE(cursor->shape(), Server::cursor_shape::zoom_out);
+    QVERIFY(surfaceChangedSpy.isEmpty());
+
+    // Setting a surface unsets the shape.
+    std::unique_ptr<Client::Surface> cursorSurface(m_compositor->createSurface());
+    pointer->setCursor(cursorSurface.get(), QPoint(1, 2));
+    QVERIFY(surfaceChangedSpy.wait());
+    QVERIFY(cursor->surface());
+    QVERIFY(!cursor->shape());
+    QCOMPARE(shapeChangedSpy.count(), 3);
+
+    // And setting a shape unsets the surface again.
+    wp_cursor_shape_device_v1_set_shape(device, serial, WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_GRAB);
+    QVERIFY(shapeChangedSpy.wait());
+    QCOMPARE(cursor->shape(), Server::cursor_shape::grab);
+    QVERIFY(!cursor->surface());
+    QCOMPARE(surfaceChangedSpy.count(), 2);
+    QVERIFY(!m_connection->error());
+
+    wp_cursor_shape_device_v1_destroy(device);
+}
+
+void TestCursorShape::testInvalidShape()
+{
+    std::unique_ptr<Client::Pointer> pointer(m_seat->createPointer());
+    QVERIFY(pointer->isValid());
+
+    quint32 serial{0};
+    QVERIFY(enter_pointer(pointer.get(), serial));
+
+    QSignalSpy errorSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(errorSpy.isValid());
+
+    auto device = m_cursor_shape->get_pointer(pointer.get());
+    wp_cursor_shape_device_v1_set_shape(device, serial, 0);
+
+    QVERIFY(errorSpy.wait());
+    QVERIFY(m_connection->error());
+
+    wp_cursor_shape_device_v1_destroy(device);
+}
+
+QTEST_GUILESS_MAIN(TestCursorShape)
+#include "cursor_shape.moc"
@@ -0,0 +1,210 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/fifo_v1.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/surface.h"
+
+#include "../../server/compositor.h"
+#include "../../server/display.h"
+#include "../../server/fifo_v1.h"
+#include "../../server/surface.h"
+
+#include "../../tests/globals.h"
+
+#include <wayland-fifo-v1-client-protocol.h>
+
+using namespace Wrapland;
+
+class TestFifo : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestFifo(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testBarrier();
+
+private:
+    struct {
+        std::unique_ptr<Server::Display> display;
+        Server::globals globals;
+    } server;
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::Compositor* m_compositor{nullptr};
+    Client::fifo_manager_v1* m_fifo{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-fifo-0"};
+
+TestFifo::TestFifo(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<Server::Surface*>();
+}
+
+void TestFifo::init()
+{
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.fifo_manager_v1
+        = std::make_unique<Server::fifo_manager_v1>(server.display.get());
+
+    // setup connection
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy connectedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(connectedSpy.isValid());
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+
+    Client::Registry registry;
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection);
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    auto const compositor = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor = registry.createCompositor(compositor.name, compositor.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    auto const fifo = registry.interface(Client::Registry::Interface::FifoManagerV1);
+    QVERIFY(fifo.name != 0);
+    m_fifo = registry.createFifoManagerV1(fifo.name, fifo.version, this);
+    QVERIFY(m_fifo->isValid());
+}
+
+void TestFifo::cleanup()
+{
+#define CLEANUP(variable)                                                                          \
+    if (variable) {                                                                                \
+        delete variable;                                                                           \
+        variable = nullptr;                                                                        \
+    }
+    CLEANUP(m_fifo)
+    CLEANUP(m_compositor)
+    CLEANUP(m_queue)
+    if (m_connection) {
+        m_connection->deleteLater();
+        m_connection = nullptr;
+    }
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+#undef CLEANUP
+
+    server = {};
+}
+
+void TestFifo::testBarrier()
+{
+    // Commits waiting on a barrier are applied one per refresh cycle.
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+
+    std::unique_ptr<Client::Surface> surface(m_compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Server::Surface*>();
+    QVERIFY(serverSurface);
+
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+    QSignalSpy queuedSpy(serverSurface, &Server::Surface::commit_queued);
+    QVERIFY(queuedSpy.isValid());
+
+    auto fifo = m_fifo->get_fifo(surface.get());
+
+    // Without a barrier set waiting does not hold back the commit.
+    wp_fifo_v1_wait_barrier(fifo);
+    wp_fifo_v1_set_barrier(fifo);
+    surface->setScale(2);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().scale, 2);
+    QVERIFY(!serverSurface->has_queued_commits());
+
+    // Now the barrier is set and the next waiting commits are queued.
+    wp_fifo_v1_wait_barrier(fifo);
+    wp_fifo_v1_set_barrier(fifo);
+    surface->setScale(3);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(queuedSpy.wait());
+    QVERIFY(serverSurface->has_queued_commits());
+    QCOMPARE(serverSurface->state().scale, 2);
+
+    // Later commits are queued too, even without waiting on the barrier.
+    surface->setScale(4);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(queuedSpy.wait());
+    QCOMPARE(queuedSpy.count(), 2);
+    QCOMPARE(committedSpy.count(), 1);
+
+    // The first refresh cycle applies both as the second one does not wait.
+    serverSurface->apply_queued_commits(std::chrono::nanoseconds::zero());
+    QCOMPARE(committedSpy.count(), 3);
+    QCOMPARE(serverSurface->state().scale, 4);
+    QVERIFY(!serverSurface->has_queued_commits());
+
+    // The barrier is set again and holds back the next commit. That one sets a new barrier which
+    // holds back the commit after it until the following refresh cycle.
+    wp_fifo_v1_wait_barrier(fifo);
+    wp_fifo_v1_set_barrier(fifo);
+    surface->setScale(1);
+    surface->commit(Client::Surface::CommitFlag::None);
+    wp_fifo_v1_wait_barrier(fifo);
+    surface->setScale(2);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(queuedSpy.wait());
+    if (queuedSpy.count() < 4) {
+        QVERIFY(queuedSpy.wait());
+    }
+    QCOMPARE(queuedSpy.count(), 4);
+
+    serverSurface->apply_queued_commits(std::chrono::nanoseconds::zero());
+    QCOMPARE(committedSpy.count(), 4);
+    QCOMPARE(serverSurface->state().scale, 1);
+    QVERIFY(serverSurface->has_queued_commits());
+
+    serverSurface->apply_queued_commits(std::chrono::nanoseconds::zero());
+    QCOMPARE(committedSpy.count(), 5);
+    QCOMPARE(serverSurface->state().scale, 2);
+    QVERIFY(!serverSurface->has_queued_commits());
+    QVERIFY(!m_connection->error());
+
+    wp_fifo_v1_destroy(fifo);
+}
+
+QTEST_GUILESS_MAIN(TestFifo)
+#include "fifo.moc"
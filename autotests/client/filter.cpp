@@ -52,6 +52,7 @@ private Q_SLOTS:
     void cleanup();
     void testFilter_data();
     void testFilter();
+    void testFilterCache();
 
 private:
     std::unique_ptr<TestDisplay> m_display;
@@ -68,6 +69,7 @@ public:
     TestDisplay();
     bool allowInterface(Wrapland::Server::Client* client, QByteArray const& interfaceName) override;
     QList<wl_client*> m_allowedClients;
+    int m_queries{0};
 };
 
 TestDisplay::TestDisplay()
@@ -77,6 +79,7 @@ TestDisplay::TestDisplay()
 
 bool TestDisplay::allowInterface(Wrapland::Server::Client* client, QByteArray const& interfaceName)
 {
+    m_queries++;
     if (interfaceName == "org_kde_kwin_blur_manager") {
         return m_allowedClients.contains(client->native());
     }
@@ -161,5 +164,62 @@ void TestFilter::testFilter()
     thread->wait();
 }
 
+void TestFilter::testFilterCache()
+{
+    // The decisions are only queried once per client and interface until being invalidated.
+    std::unique_ptr<Wrapland::Client::ConnectionThread> connection(
+        new Wrapland::Client::ConnectionThread());
+    QSignalSpy connectedSpy(connection.get(), &ConnectionThread::establishedChanged);
+    QVERIFY(connectedSpy.isValid());
+    connection->setSocketName(socket_name);
+
+    std::unique_ptr<QThread> thread(new QThread(this));
+    connection->moveToThread(thread.get());
+    thread->start();
+
+    connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    Wrapland::Client::EventQueue queue;
+    queue.setup(connection.get());
+
+    auto announce = [&](bool blur_expected) {
+        Registry registry;
+        QSignalSpy registryDoneSpy(&registry, &Registry::interfacesAnnounced);
+        QSignalSpy blurSpy(&registry, &Registry::blurAnnounced);
+
+        registry.setEventQueue(&queue);
+        registry.create(connection->display());
+        QVERIFY(registry.isValid());
+        registry.setup();
+
+        QVERIFY(registryDoneSpy.wait());
+        QCOMPARE(blurSpy.count(), blur_expected ? 1 : 0);
+    };
+
+    announce(false);
+    auto const queries = m_display->m_queries;
+    QVERIFY(queries > 0);
+
+    announce(false);
+    QCOMPARE(m_display->m_queries, queries);
+
+    QCOMPARE(m_display->clients().size(), 1);
+    auto client = m_display->clients().front();
+    m_display->m_allowedClients << client->native();
+
+    // Without invalidation the cached decision still applies.
+    announce(false);
+    QCOMPARE(m_display->m_queries, queries);
+
+    m_display->invalidate_filter(client);
+    announce(true);
+    QCOMPARE(m_display->m_queries, 2 * queries);
+
+    thread->quit();
+    thread->wait();
+}
+
 QTEST_GUILESS_MAIN(TestFilter)
 #include "filter.moc"
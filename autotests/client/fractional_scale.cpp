@@ -0,0 +1,178 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/fractional_scale_v1.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/surface.h"
+
+#include "../../server/compositor.h"
+#include "../../server/display.h"
+#include "../../server/fractional_scale_v1.h"
+#include "../../server/surface.h"
+
+#include "../../tests/globals.h"
+
+using namespace Wrapland;
+
+class TestFractionalScale : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestFractionalScale(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testPreferredScale();
+
+private:
+    struct {
+        std::unique_ptr<Server::Display> display;
+        Server::globals globals;
+    } server;
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::Compositor* m_compositor{nullptr};
+    Client::fractional_scale_manager_v1* m_fractional_scale{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-fractional-scale-0"};
+
+TestFractionalScale::TestFractionalScale(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<Server::Surface*>();
+}
+
+void TestFractionalScale::init()
+{
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.fractional_scale_manager_v1
+        = std::make_unique<Server::fractional_scale_manager_v1>(server.display.get());
+
+    // setup connection
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy connectedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(connectedSpy.isValid());
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+
+    Client::Registry registry;
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection);
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    auto const compositor = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor = registry.createCompositor(compositor.name, compositor.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    auto const fractional_scale
+        = registry.interface(Client::Registry::Interface::FractionalScaleManagerV1);
+    QVERIFY(fractional_scale.name != 0);
+    m_fractional_scale = registry.createFractionalScaleManagerV1(
+        fractional_scale.name, fractional_scale.version, this);
+    QVERIFY(m_fractional_scale->isValid());
+}
+
+void TestFractionalScale::cleanup()
+{
+#define CLEANUP(variable)                                                                          \
+    if (variable) {                                                                                \
+        delete variable;                                                                           \
+        variable = nullptr;                                                                        \
+    }
+    CLEANUP(m_fractional_scale)
+    CLEANUP(m_compositor)
+    CLEANUP(m_queue)
+    if (m_connection) {
+        m_connection->deleteLater();
+        m_connection = nullptr;
+    }
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+#undef CLEANUP
+
+    server = {};
+}
+
+void TestFractionalScale::testPreferredScale()
+{
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+
+    std::unique_ptr<Client::Surface> surface(m_compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Server::Surface*>();
+    QVERIFY(serverSurface);
+    QCOMPARE(serverSurface->preferred_scale(), 1.);
+
+    // A scale set before the object is created is sent on creation.
+    serverSurface->set_preferred_scale(1.25);
+
+    std::unique_ptr<Client::fractional_scale_v1> scale(
+        m_fractional_scale->get_fractional_scale(surface.get()));
+    QVERIFY(scale->isValid());
+
+    QSignalSpy scaleSpy(scale.get(), &Client::fractional_scale_v1::preferred_scale_changed);
+    QVERIFY(scaleSpy.isValid());
+    QVERIFY(scaleSpy.wait());
+    QCOMPARE(scale->preferred_scale(), 1.25);
+
+    serverSurface->set_preferred_scale(1.5);
+    QVERIFY(scaleSpy.wait());
+    QCOMPARE(scaleSpy.count(), 2);
+    QCOMPARE(scale->preferred_scale(), 1.5);
+
+    // Setting the same scale again does not send an event.
+    serverSurface->set_preferred_scale(1.5);
+    serverSurface->set_preferred_scale(2.);
+    QVERIFY(scaleSpy.wait());
+    QCOMPARE(scaleSpy.count(), 3);
+    QCOMPARE(scale->preferred_scale(), 2.);
+
+    // A new object can be created after the previous one got destroyed.
+    scale.reset();
+    scale.reset(m_fractional_scale->get_fractional_scale(surface.get()));
+
+    QSignalSpy scaleSpy2(scale.get(), &Client::fractional_scale_v1::preferred_scale_changed);
+    QVERIFY(scaleSpy2.isValid());
+    QVERIFY(scaleSpy2.wait());
+    QCOMPARE(scale->preferred_scale(), 2.);
+    QVERIFY(!m_connection->error());
+}
+
+QTEST_GUILESS_MAIN(TestFractionalScale)
+#include "fractional_scale.moc"
@@ -0,0 +1,337 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/shm_pool.h"
+#include "../../src/client/subcompositor.h"
+#include "../../src/client/subsurface.h"
+#include "../../src/client/surface.h"
+
+#include "../../server/compositor.h"
+#include "../../server/display.h"
+#include "../../server/frame_callback_scheduler.h"
+#include "../../server/output.h"
+#include "../../server/subcompositor.h"
+#include "../../server/surface.h"
+
+#include "../../tests/globals.h"
+
+using namespace Wrapland;
+
+class TestFrameCallbackScheduler : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestFrameCallbackScheduler(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testFlushOutput();
+    void testFlushSubsurface();
+    void testOffscreenInterval();
+    void testHiddenSurface();
+    void testDestroySurface();
+
+private:
+    Server::Surface* create_surface(std::unique_ptr<Client::Surface>& surface);
+    void commit_frame(Client::Surface* surface, Server::Surface* serverSurface);
+
+    struct {
+        std::unique_ptr<Server::Display> display;
+        std::unique_ptr<Server::output> output;
+        std::unique_ptr<Server::output> other_output;
+        std::unique_ptr<Server::frame_callback_scheduler> scheduler;
+        Server::globals globals;
+    } server;
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::Compositor* m_compositor{nullptr};
+    Client::SubCompositor* m_subcompositor{nullptr};
+    Client::ShmPool* m_shm{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-frame-callback-scheduler-0"};
+
+TestFrameCallbackScheduler::TestFrameCallbackScheduler(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<Server::Surface*>();
+}
+
+void TestFrameCallbackScheduler::init()
+{
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.display->createShm();
+
+    server.globals.output_manager = std::make_unique<Server::output_manager>(*server.display);
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.subcompositor = std::make_unique<Server::Subcompositor>(server.display.get());
+    server.scheduler
+        = std::make_unique<Server::frame_callback_scheduler>(server.globals.compositor.get());
+
+    auto create_output = [this] {
+        auto output = std::make_unique<Server::output>(*server.globals.output_manager);
+        output->add_mode({.size = QSize{1920, 1080}, .id = 0});
+        auto state = output->get_state();
+        state.enabled = true;
+        output->set_state(state);
+        output->done();
+        return output;
+    };
+    server.output = create_output();
+    server.other_output = create_output();
+
+    // Setup connection.
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy establishedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(establishedSpy.wait());
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+    QVERIFY(m_queue->isValid());
+
+    Client::Registry registry;
+    QSignalSpy allAnnounced(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(allAnnounced.isValid());
+
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection->display());
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(allAnnounced.wait());
+
+    auto const compositor = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor = registry.createCompositor(compositor.name, compositor.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    auto const subcompositor = registry.interface(Client::Registry::Interface::SubCompositor);
+    m_subcompositor
+        = registry.createSubCompositor(subcompositor.name, subcompositor.version, this);
+    QVERIFY(m_subcompositor->isValid());
+
+    auto const shm = registry.interface(Client::Registry::Interface::Shm);
+    m_shm = registry.createShmPool(shm.name, shm.version, this);
+    QVERIFY(m_shm->isValid());
+}
+
+void TestFrameCallbackScheduler::cleanup()
+{
+    delete m_shm;
+    m_shm = nullptr;
+    delete m_subcompositor;
+    m_subcompositor = nullptr;
+    delete m_compositor;
+    m_compositor = nullptr;
+    delete m_queue;
+    m_queue = nullptr;
+
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+    delete m_connection;
+    m_connection = nullptr;
+
+    server = {};
+}
+
+Server::Surface*
+TestFrameCallbackScheduler::create_surface(std::unique_ptr<Client::Surface>& surface)
+{
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    if (!surfaceCreatedSpy.isValid()) {
+        return nullptr;
+    }
+
+    surface.reset(m_compositor->createSurface());
+    if (!surfaceCreatedSpy.wait()) {
+        return nullptr;
+    }
+    return surfaceCreatedSpy.first().first().value<Server::Surface*>();
+}
+
+void TestFrameCallbackScheduler::commit_frame(Client::Surface* surface,
+                                              Server::Surface* serverSurface)
+{
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+
+    QImage image(QSize(10, 10), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::red);
+    surface->attachBuffer(m_shm->createBuffer(image));
+    surface->damage(QRect(0, 0, 10, 10));
+    surface->commit(Client::Surface::CommitFlag::FrameCallback);
+
+    QVERIFY(committedSpy.wait());
+}
+
+void TestFrameCallbackScheduler::testFlushOutput()
+{
+    // Frame callbacks are sent only when flushing the output the surface is on.
+    std::unique_ptr<Client::Surface> surface;
+    auto serverSurface = create_surface(surface);
+    QVERIFY(serverSurface);
+
+    QSignalSpy frameRenderedSpy(surface.get(), &Client::Surface::frameRendered);
+    QVERIFY(frameRenderedSpy.isValid());
+
+    commit_frame(surface.get(), serverSurface);
+    QVERIFY(server.scheduler->has_pending(serverSurface));
+
+    serverSurface->setOutputs(std::vector<Server::output*>{server.output.get()});
+
+    server.scheduler->flush(server.other_output.get(), 1);
+    QVERIFY(server.scheduler->has_pending(serverSurface));
+    QVERIFY(!frameRenderedSpy.wait(100));
+
+    server.scheduler->flush(server.output.get(), 2);
+    QVERIFY(!server.scheduler->has_pending(serverSurface));
+    QVERIFY(frameRenderedSpy.wait());
+    QCOMPARE(frameRenderedSpy.count(), 1);
+
+    // Without a new frame callback the surface is not tracked anymore.
+    commit_frame(surface.get(), serverSurface);
+    server.scheduler->flush(server.output.get(), 3);
+    QVERIFY(frameRenderedSpy.wait());
+    QCOMPARE(frameRenderedSpy.count(), 2);
+
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+    surface->damage(QRect(0, 0, 10, 10));
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QVERIFY(!server.scheduler->has_pending(serverSurface));
+}
+
+void TestFrameCallbackScheduler::testFlushSubsurface()
+{
+    // A subsurface is flushed together with the output of its parent surface.
+    std::unique_ptr<Client::Surface> parent;
+    auto serverParent = create_surface(parent);
+    QVERIFY(serverParent);
+
+    std::unique_ptr<Client::Surface> child;
+    auto serverChild = create_surface(child);
+    QVERIFY(serverChild);
+
+    QSignalSpy subsurfaceCreatedSpy(server.globals.subcompositor.get(),
+                                    &Server::Subcompositor::subsurfaceCreated);
+    QVERIFY(subsurfaceCreatedSpy.isValid());
+    std::unique_ptr<Client::SubSurface> subsurface(
+        m_subcompositor->createSubSurface(child.get(), parent.get()));
+    subsurface->setMode(Client::SubSurface::Mode::Desynchronized);
+    QVERIFY(subsurfaceCreatedSpy.wait());
+
+    QSignalSpy frameRenderedSpy(child.get(), &Client::Surface::frameRendered);
+    QVERIFY(frameRenderedSpy.isValid());
+
+    commit_frame(child.get(), serverChild);
+    QVERIFY(server.scheduler->has_pending(serverChild));
+    QVERIFY(!server.scheduler->has_pending(serverParent));
+
+    serverParent->setOutputs(std::vector<Server::output*>{server.output.get()});
+    server.scheduler->flush(server.output.get(), 1);
+    QVERIFY(!server.scheduler->has_pending(serverChild));
+    QVERIFY(frameRenderedSpy.wait());
+}
+
+void TestFrameCallbackScheduler::testOffscreenInterval()
+{
+    // Surfaces without output are flushed in the off-screen interval when enabled.
+    QCOMPARE(server.scheduler->offscreen_interval(), std::chrono::milliseconds::zero());
+
+    std::unique_ptr<Client::Surface> surface;
+    auto serverSurface = create_surface(surface);
+    QVERIFY(serverSurface);
+
+    QSignalSpy frameRenderedSpy(surface.get(), &Client::Surface::frameRendered);
+    QVERIFY(frameRenderedSpy.isValid());
+
+    commit_frame(surface.get(), serverSurface);
+    QVERIFY(!frameRenderedSpy.wait(100));
+    QVERIFY(server.scheduler->has_pending(serverSurface));
+
+    server.scheduler->set_offscreen_interval(std::chrono::milliseconds(20));
+    QCOMPARE(server.scheduler->offscreen_interval(), std::chrono::milliseconds(20));
+    QVERIFY(frameRenderedSpy.wait());
+    QVERIFY(!server.scheduler->has_pending(serverSurface));
+
+    server.scheduler->set_offscreen_interval(std::chrono::milliseconds::zero());
+    commit_frame(surface.get(), serverSurface);
+    QVERIFY(!frameRenderedSpy.wait(100));
+    QCOMPARE(frameRenderedSpy.count(), 1);
+
+    // Explicitly flushing the surface still works.
+    server.scheduler->flush(serverSurface, 1);
+    QVERIFY(frameRenderedSpy.wait());
+    QVERIFY(!server.scheduler->has_pending(serverSurface));
+}
+
+void TestFrameCallbackScheduler::testHiddenSurface()
+{
+    // Callbacks withheld by the visibility hint stay pending.
+    std::unique_ptr<Client::Surface> surface;
+    auto serverSurface = create_surface(surface);
+    QVERIFY(serverSurface);
+    serverSurface->setOutputs(std::vector<Server::output*>{server.output.get()});
+    serverSurface->set_visibility(Server::surface_visibility::hidden);
+
+    QSignalSpy frameRenderedSpy(surface.get(), &Client::Surface::frameRendered);
+    QVERIFY(frameRenderedSpy.isValid());
+
+    commit_frame(surface.get(), serverSurface);
+    server.scheduler->flush(server.output.get(), 1);
+    QVERIFY(server.scheduler->has_pending(serverSurface));
+    QVERIFY(!frameRenderedSpy.wait(100));
+
+    serverSurface->set_visibility(Server::surface_visibility::visible);
+    server.scheduler->flush(server.output.get(), 2);
+    QVERIFY(!server.scheduler->has_pending(serverSurface));
+    QVERIFY(frameRenderedSpy.wait());
+}
+
+void TestFrameCallbackScheduler::testDestroySurface()
+{
+    // A destroyed surface is removed from the pending surfaces.
+    std::unique_ptr<Client::Surface> surface;
+    auto serverSurface = create_surface(surface);
+    QVERIFY(serverSurface);
+
+    commit_frame(surface.get(), serverSurface);
+    QVERIFY(server.scheduler->has_pending(serverSurface));
+
+    QSignalSpy destroyedSpy(serverSurface, &Server::Surface::resourceDestroyed);
+    QVERIFY(destroyedSpy.isValid());
+    surface.reset();
+    QVERIFY(destroyedSpy.wait());
+
+    QVERIFY(!server.scheduler->has_pending(serverSurface));
+    server.scheduler->flush(server.output.get(), 1);
+}
+
+QTEST_GUILESS_MAIN(TestFrameCallbackScheduler)
+#include "frame_callback_scheduler.moc"
@@ -0,0 +1,464 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/buffer.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/image_capture_source_v1.h"
+#include "../../src/client/image_copy_capture_v1.h"
+#include "../../src/client/output.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/shm_pool.h"
+
+#include "../../server/buffer.h"
+#include "../../server/display.h"
+#include "../../server/image_capture_source_v1.h"
+#include "../../server/image_copy_capture_v1.h"
+#include "../../server/output.h"
+#include "../../server/output_manager.h"
+
+#include "../../tests/globals.h"
+
+#include <wayland-ext-image-capture-source-v1-client-protocol.h>
+#include <wayland-ext-image-copy-capture-v1-client-protocol.h>
+
+#include <optional>
+
+using namespace Wrapland;
+
+class TestImageCopyCapture : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestImageCopyCapture(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testCapture();
+    void testBufferConstraints();
+    void testStop();
+    void testNoBuffer();
+
+private:
+    struct {
+        std::unique_ptr<Server::Display> display;
+        Server::globals globals;
+        std::unique_ptr<Server::output> output;
+    } server;
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::ShmPool* m_shm{nullptr};
+    Client::Output* m_output{nullptr};
+    Client::output_image_capture_source_manager_v1* m_source_manager{nullptr};
+    Client::image_copy_capture_manager_v1* m_capture_manager{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-image-copy-capture-0"};
+
+struct session_events {
+    QSize buffer_size;
+    std::vector<uint32_t> shm_formats;
+    int done{0};
+    bool stopped{false};
+};
+
+ext_image_copy_capture_session_v1_listener const session_listener = {
+    .buffer_size =
+        [](void* data,
+           ext_image_copy_capture_session_v1* /*session*/,
+           uint32_t width,
+           uint32_t height) {
+            static_cast<session_events*>(data)->buffer_size
+                = QSize(static_cast<int>(width), static_cast<int>(height));
+        },
+    .shm_format =
+        [](void* data, ext_image_copy_capture_session_v1* /*session*/, uint32_t format) {
+            static_cast<session_events*>(data)->shm_formats.push_back(format);
+        },
+    .dmabuf_device =
+        [](void* /*data*/, ext_image_copy_capture_session_v1* /*session*/, wl_array* /*device*/) {
+        },
+    .dmabuf_format = [](void* /*data*/,
+                        ext_image_copy_capture_session_v1* /*session*/,
+                        uint32_t /*format*/,
+                        wl_array* /*modifiers*/) {},
+    .done =
+        [](void* data, ext_image_copy_capture_session_v1* /*session*/) {
+            static_cast<session_events*>(data)->done++;
+        },
+    .stopped =
+        [](void* data, ext_image_copy_capture_session_v1* /*session*/) {
+            static_cast<session_events*>(data)->stopped = true;
+        },
+};
+
+struct frame_events {
+    std::optional<uint32_t> transform;
+    QRegion damage;
+    std::chrono::nanoseconds presentation_time{0};
+    bool ready{false};
+    std::optional<uint32_t> failure;
+};
+
+ext_image_copy_capture_frame_v1_listener const frame_listener = {
+    .transform =
+        [](void* data, ext_image_copy_capture_frame_v1* /*frame*/, uint32_t transform) {
+            static_cast<frame_events*>(data)->transform = transform;
+        },
+    .damage =
+        [](void* data,
+           ext_image_copy_capture_frame_v1* /*frame*/,
+           int32_t x,
+           int32_t y,
+           int32_t width,
+           int32_t height) {
+            static_cast<frame_events*>(data)->damage |= QRect(x, y, width, height);
+        },
+    .presentation_time =
+        [](void* data,
+           ext_image_copy_capture_frame_v1* /*frame*/,
+           uint32_t tv_sec_hi,
+           uint32_t tv_sec_lo,
+           uint32_t tv_nsec) {
+            auto const secs = (static_cast<uint64_t>(tv_sec_hi) << 32) | tv_sec_lo;
+            static_cast<frame_events*>(data)->presentation_time
+                = std::chrono::seconds(secs) + std::chrono::nanoseconds(tv_nsec);
+        },
+    .ready =
+        [](void* data, ext_image_copy_capture_frame_v1* /*frame*/) {
+            static_cast<frame_events*>(data)->ready = true;
+        },
+    .failed =
+        [](void* data, ext_image_copy_capture_frame_v1* /*frame*/, uint32_t reason) {
+            static_cast<frame_events*>(data)->failure = reason;
+        },
+};
+
+TestImageCopyCapture::TestImageCopyCapture(QObject* parent)
+    : QObject(parent)
+{
+}
+
+void TestImageCopyCapture::init()
+{
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.display->createShm();
+    server.globals.output_manager = std::make_unique<Server::output_manager>(*server.display);
+    server.output = std::make_unique<Server::output>(Server::output_metadata{.name = "out"},
+                                                     *server.globals.output_manager);
+    server.output->add_mode(Server::output_mode{QSize(100, 50), 60000, true, 1});
+    auto state = server.output->get_state();
+    state.enabled = true;
+    server.output->set_state(state);
+    server.output->done();
+
+    server.globals.output_image_capture_source_manager_v1
+        = std::make_unique<Server::output_image_capture_source_manager_v1>(server.display.get());
+    server.globals.image_copy_capture_manager_v1
+        = std::make_unique<Server::image_copy_capture_manager_v1>(server.display.get());
+
+    // setup connection
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy connectedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(connectedSpy.isValid());
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+
+    Client::Registry registry;
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection);
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    auto const shm = registry.interface(Client::Registry::Interface::Shm);
+    m_shm = registry.createShmPool(shm.name, shm.version, this);
+    QVERIFY(m_shm->isValid());
+
+    auto const output = registry.interface(Client::Registry::Interface::Output);
+    m_output = registry.createOutput(output.name, output.version, this);
+    QVERIFY(m_output->isValid());
+
+    auto const source_manager
+        = registry.interface(Client::Registry::Interface::OutputImageCaptureSourceManagerV1);
+    QVERIFY(source_manager.name != 0);
+    m_source_manager = registry.createOutputImageCaptureSourceManagerV1(
+        source_manager.name, source_manager.version, this);
+    QVERIFY(m_source_manager->isValid());
+
+    auto const capture_manager
+        = registry.interface(Client::Registry::Interface::ImageCopyCaptureManagerV1);
+    QVERIFY(capture_manager.name != 0);
+    m_capture_manager = registry.createImageCopyCaptureManagerV1(
+        capture_manager.name, capture_manager.version, this);
+    QVERIFY(m_capture_manager->isValid());
+}
+
+void TestImageCopyCapture::cleanup()
+{
+#define CLEANUP(variable)                                                                          \
+    if (variable) {                                                                                \
+        delete variable;                                                                           \
+        variable = nullptr;                                                                        \
+    }
+    CLEANUP(m_capture_manager)
+    CLEANUP(m_source_manager)
+    CLEANUP(m_output)
+    CLEANUP(m_shm)
+    CLEANUP(m_queue)
+    if (m_connection) {
+        m_connection->deleteLater();
+        m_connection = nullptr;
+    }
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+#undef CLEANUP
+
+    server = {};
+}
+
+void TestImageCopyCapture::testCapture()
+{
+    // The first frame has full damage. Later frames wait for damage of the output.
+    QSignalSpy sessionCreatedSpy(server.globals.image_copy_capture_manager_v1.get(),
+                                 &Server::image_copy_capture_manager_v1::session_created);
+    QVERIFY(sessionCreatedSpy.isValid());
+
+    auto source = m_source_manager->create_source(m_output);
+    auto session = m_capture_manager->create_session(
+        source, EXT_IMAGE_COPY_CAPTURE_MANAGER_V1_OPTIONS_PAINT_CURSORS);
+    session_events events;
+    ext_image_copy_capture_session_v1_add_listener(session, &session_listener, &events);
+    QVERIFY(sessionCreatedSpy.wait());
+
+    auto serverSession
+        = sessionCreatedSpy.first().first().value<Server::image_copy_capture_session_v1*>();
+    QVERIFY(serverSession);
+    QCOMPARE(serverSession->output(), server.output.get());
+    QVERIFY(serverSession->paint_cursors());
+
+    serverSession->set_constraints(
+        {.size = QSize(100, 50), .shm_formats = {WL_SHM_FORMAT_ARGB8888}});
+    QTRY_COMPARE(events.done, 1);
+    QCOMPARE(events.buffer_size, QSize(100, 50));
+    QCOMPARE(events.shm_formats, std::vector<uint32_t>{WL_SHM_FORMAT_ARGB8888});
+
+    QSignalSpy captureSpy(serverSession,
+                          &Server::image_copy_capture_session_v1::capture_requested);
+    QVERIFY(captureSpy.isValid());
+
+    QImage image(QSize(100, 50), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::black);
+    auto buffer = m_shm->createBuffer(image).lock();
+
+    auto frame = ext_image_copy_capture_session_v1_create_frame(session);
+    frame_events first_events;
+    ext_image_copy_capture_frame_v1_add_listener(frame, &frame_listener, &first_events);
+    ext_image_copy_capture_frame_v1_attach_buffer(frame, *buffer);
+    ext_image_copy_capture_frame_v1_capture(frame);
+    m_connection->flush();
+
+    QVERIFY(captureSpy.wait());
+    auto serverFrame = captureSpy.first().first().value<Server::image_copy_capture_frame_v1*>();
+    QCOMPARE(serverFrame->session(), serverSession);
+    QCOMPARE(serverFrame->buffer()->size(), QSize(100, 50));
+    QCOMPARE(serverFrame->damage(), QRegion(0, 0, 100, 50));
+
+    serverFrame->ready(Server::output_transform::rotated_90,
+                       std::chrono::seconds(5) + std::chrono::nanoseconds(7));
+    QTRY_VERIFY(first_events.ready);
+    QCOMPARE(*first_events.transform, static_cast<uint32_t>(WL_OUTPUT_TRANSFORM_90));
+    QCOMPARE(first_events.damage, QRegion(0, 0, 100, 50));
+    QCOMPARE(first_events.presentation_time,
+             std::chrono::seconds(5) + std::chrono::nanoseconds(7));
+    ext_image_copy_capture_frame_v1_destroy(frame);
+
+    // Without damage of the output the next frame is not handed to the compositor.
+    frame = ext_image_copy_capture_session_v1_create_frame(session);
+    frame_events second_events;
+    ext_image_copy_capture_frame_v1_add_listener(frame, &frame_listener, &second_events);
+    ext_image_copy_capture_frame_v1_attach_buffer(frame, *buffer);
+    ext_image_copy_capture_frame_v1_damage_buffer(frame, 0, 0, 10, 10);
+    ext_image_copy_capture_frame_v1_capture(frame);
+    m_connection->flush();
+
+    QVERIFY(!captureSpy.wait(100));
+    QCOMPARE(captureSpy.count(), 1);
+
+    serverSession->add_damage(QRegion(20, 20, 5, 5));
+    QCOMPARE(captureSpy.count(), 2);
+    serverFrame = captureSpy.last().first().value<Server::image_copy_capture_frame_v1*>();
+
+    // The compositor copies the damage of the output together with the damage of the buffer.
+    QCOMPARE(serverFrame->damage(), QRegion(0, 0, 10, 10) | QRegion(20, 20, 5, 5));
+
+    serverFrame->ready(Server::output_transform::normal, std::chrono::seconds(6));
+    QTRY_VERIFY(second_events.ready);
+    QCOMPARE(*second_events.transform, static_cast<uint32_t>(WL_OUTPUT_TRANSFORM_NORMAL));
+    QCOMPARE(second_events.damage, QRegion(20, 20, 5, 5));
+    QVERIFY(!m_connection->error());
+
+    ext_image_copy_capture_frame_v1_destroy(frame);
+    ext_image_copy_capture_session_v1_destroy(session);
+    ext_image_capture_source_v1_destroy(source);
+}
+
+void TestImageCopyCapture::testBufferConstraints()
+{
+    QSignalSpy sessionCreatedSpy(server.globals.image_copy_capture_manager_v1.get(),
+                                 &Server::image_copy_capture_manager_v1::session_created);
+    QVERIFY(sessionCreatedSpy.isValid());
+
+    auto source = m_source_manager->create_source(m_output);
+    auto session = m_capture_manager->create_session(source, 0);
+    QVERIFY(sessionCreatedSpy.wait());
+
+    auto serverSession
+        = sessionCreatedSpy.first().first().value<Server::image_copy_capture_session_v1*>();
+    QVERIFY(!serverSession->paint_cursors());
+    serverSession->set_constraints(
+        {.size = QSize(100, 50), .shm_formats = {WL_SHM_FORMAT_ARGB8888}});
+
+    QSignalSpy captureSpy(serverSession,
+                          &Server::image_copy_capture_session_v1::capture_requested);
+    QVERIFY(captureSpy.isValid());
+
+    // The buffer has the wrong size.
+    QImage image(QSize(50, 50), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::black);
+    auto buffer = m_shm->createBuffer(image).lock();
+
+    auto frame = ext_image_copy_capture_session_v1_create_frame(session);
+    frame_events events;
+    ext_image_copy_capture_frame_v1_add_listener(frame, &frame_listener, &events);
+    ext_image_copy_capture_frame_v1_attach_buffer(frame, *buffer);
+    ext_image_copy_capture_frame_v1_capture(frame);
+    m_connection->flush();
+
+    QTRY_VERIFY(events.failure);
+    uint32_t const reason = EXT_IMAGE_COPY_CAPTURE_FRAME_V1_FAILURE_REASON_BUFFER_CONSTRAINTS;
+    QCOMPARE(*events.failure, reason);
+    QVERIFY(captureSpy.isEmpty());
+    QVERIFY(!m_connection->error());
+
+    ext_image_copy_capture_frame_v1_destroy(frame);
+    ext_image_copy_capture_session_v1_destroy(session);
+    ext_image_capture_source_v1_destroy(source);
+}
+
+void TestImageCopyCapture::testStop()
+{
+    QSignalSpy sessionCreatedSpy(server.globals.image_copy_capture_manager_v1.get(),
+                                 &Server::image_copy_capture_manager_v1::session_created);
+    QVERIFY(sessionCreatedSpy.isValid());
+
+    auto source = m_source_manager->create_source(m_output);
+    auto session = m_capture_manager->create_session(source, 0);
+    session_events events;
+    ext_image_copy_capture_session_v1_add_listener(session, &session_listener, &events);
+    QVERIFY(sessionCreatedSpy.wait());
+
+    auto serverSession
+        = sessionCreatedSpy.first().first().value<Server::image_copy_capture_session_v1*>();
+    serverSession->set_constraints(
+        {.size = QSize(100, 50), .shm_formats = {WL_SHM_FORMAT_ARGB8888}});
+    QTRY_COMPARE(events.done, 1);
+
+    QSignalSpy captureSpy(serverSession,
+                          &Server::image_copy_capture_session_v1::capture_requested);
+    QVERIFY(captureSpy.isValid());
+
+    QImage image(QSize(100, 50), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::black);
+    auto buffer = m_shm->createBuffer(image).lock();
+
+    auto frame = ext_image_copy_capture_session_v1_create_frame(session);
+    frame_events first_events;
+    ext_image_copy_capture_frame_v1_add_listener(frame, &frame_listener, &first_events);
+    ext_image_copy_capture_frame_v1_attach_buffer(frame, *buffer);
+    ext_image_copy_capture_frame_v1_capture(frame);
+    m_connection->flush();
+
+    QVERIFY(captureSpy.wait());
+    auto serverFrame = captureSpy.first().first().value<Server::image_copy_capture_frame_v1*>();
+    serverFrame->ready(Server::output_transform::normal, std::chrono::seconds(1));
+    QTRY_VERIFY(first_events.ready);
+    ext_image_copy_capture_frame_v1_destroy(frame);
+
+    // A frame waiting for damage fails when the output is removed.
+    frame = ext_image_copy_capture_session_v1_create_frame(session);
+    frame_events second_events;
+    ext_image_copy_capture_frame_v1_add_listener(frame, &frame_listener, &second_events);
+    ext_image_copy_capture_frame_v1_attach_buffer(frame, *buffer);
+    ext_image_copy_capture_frame_v1_capture(frame);
+    m_connection->flush();
+
+    QVERIFY(!captureSpy.wait(100));
+    server.output.reset();
+
+    QTRY_VERIFY(events.stopped);
+    QTRY_VERIFY(second_events.failure);
+    QCOMPARE(*second_events.failure,
+             static_cast<uint32_t>(EXT_IMAGE_COPY_CAPTURE_FRAME_V1_FAILURE_REASON_STOPPED));
+    QVERIFY(!serverSession->output());
+    QVERIFY(!m_connection->error());
+
+    ext_image_copy_capture_frame_v1_destroy(frame);
+    ext_image_copy_capture_session_v1_destroy(session);
+    ext_image_capture_source_v1_destroy(source);
+}
+
+void TestImageCopyCapture::testNoBuffer()
+{
+    QSignalSpy sessionCreatedSpy(server.globals.image_copy_capture_manager_v1.get(),
+                                 &Server::image_copy_capture_manager_v1::session_created);
+    QVERIFY(sessionCreatedSpy.isValid());
+
+    auto source = m_source_manager->create_source(m_output);
+    auto session = m_capture_manager->create_session(source, 0);
+    QVERIFY(sessionCreatedSpy.wait());
+
+    QSignalSpy errorSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(errorSpy.isValid());
+
+    auto frame = ext_image_copy_capture_session_v1_create_frame(session);
+    ext_image_copy_capture_frame_v1_capture(frame);
+    m_connection->flush();
+
+    QVERIFY(errorSpy.wait());
+    QVERIFY(m_connection->error());
+
+    ext_image_copy_capture_frame_v1_destroy(frame);
+    ext_image_copy_capture_session_v1_destroy(session);
+    ext_image_capture_source_v1_destroy(source);
+}
+
+QTEST_GUILESS_MAIN(TestImageCopyCapture)
+#include "image_copy_capture.moc"
@@ -18,9 +18,12 @@ You should have received a copy of the GNU Lesser General Public
 License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 *********************************************************************/
 #include <wayland-client-protocol.h>
+#include <wayland-linux-dmabuf-unstable-v1-client-protocol.h>
 
 #include <QHash>
 #include <QtTest>
+#include <algorithm>
+#include <cstring>
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <unistd.h>
@@ -32,8 +35,12 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "../../src/client/linux_dmabuf_v1.h"
 #include "../../src/client/registry.h"
 
+#include "../../src/client/surface.h"
+
+#include "../../server/compositor.h"
 #include "../../server/display.h"
 #include "../../server/linux_dmabuf_v1.h"
+#include "../../server/surface.h"
 
 #include "../../tests/globals.h"
 
@@ -48,6 +55,9 @@ private Q_SLOTS:
     void testModifier();
     void testCreateBufferFail();
     void testCreateBufferSucess();
+    void testCreateBufferAsync();
+    void testCommitBeforeImport();
+    void testFeedback();
 
 private:
     std::unique_ptr<Wrapland::Server::linux_dmabuf_buffer_v1>
@@ -73,6 +83,101 @@ private:
 
 constexpr auto socket_name{"wrapland-test-wayland-dmabuf-0"};
 
+struct feedback_events {
+    struct tranche {
+        dev_t device{0};
+        std::vector<uint16_t> indices;
+        uint32_t flags{0};
+    };
+
+    int table_fd{-1};
+    uint32_t table_size{0};
+    dev_t main_device{0};
+    std::vector<tranche> tranches;
+    tranche pending;
+    std::vector<tranche> current;
+    int done{0};
+};
+
+dev_t get_device(wl_array* array)
+{
+    dev_t device{0};
+    std::memcpy(&device, array->data, sizeof(dev_t));
+    return device;
+}
+
+zwp_linux_dmabuf_feedback_v1_listener const feedback_listener = {
+    .done =
+        [](void* data, zwp_linux_dmabuf_feedback_v1* /*feedback*/) {
+            auto events = static_cast<feedback_events*>(data);
+            events->tranches = std::move(events->current);
+            events->current = {};
+            events->done++;
+        },
+    .format_table =
+        [](void* data, zwp_linux_dmabuf_feedback_v1* /*feedback*/, int32_t fd, uint32_t size) {
+            auto events = static_cast<feedback_events*>(data);
+            if (events->table_fd >= 0) {
+                close(events->table_fd);
+            }
+            events->table_fd = fd;
+            events->table_size = size;
+        },
+    .main_device =
+        [](void* data, zwp_linux_dmabuf_feedback_v1* /*feedback*/, wl_array* device) {
+            static_cast<feedback_events*>(data)->main_device = get_device(device);
+        },
+    .tranche_done =
+        [](void* data, zwp_linux_dmabuf_feedback_v1* /*feedback*/) {
+            auto events = static_cast<feedback_events*>(data);
+            events->current.push_back(std::move(events->pending));
+            events->pending = {};
+        },
+    .tranche_target_device =
+        [](void* data, zwp_linux_dmabuf_feedback_v1* /*feedback*/, wl_array* device) {
+            static_cast<feedback_events*>(data)->pending.device = get_device(device);
+        },
+    .tranche_formats =
+        [](void* data, zwp_linux_dmabuf_feedback_v1* /*feedback*/, wl_array* indices) {
+            auto begin = static_cast<uint16_t*>(indices->data);
+            static_cast<feedback_events*>(data)->pending.indices.assign(
+                begin, begin + indices->size / sizeof(uint16_t));
+        },
+    .tranche_flags =
+        [](void* data, zwp_linux_dmabuf_feedback_v1* /*feedback*/, uint32_t flags) {
+            static_cast<feedback_events*>(data)->pending.flags = flags;
+        },
+};
+
+/// Returns the format-modifier pairs of @p tranche by looking them up in the format table.
+std::vector<std::pair<uint32_t, uint64_t>> tranche_formats(feedback_events const& events,
+                                                           feedback_events::tranche const& tranche)
+{
+    struct entry {
+        uint32_t format;
+        uint32_t padding;
+        uint64_t modifier;
+    };
+
+    auto map = mmap(nullptr, events.table_size, PROT_READ, MAP_PRIVATE, events.table_fd, 0);
+    if (map == MAP_FAILED) {
+        return {};
+    }
+
+    std::vector<std::pair<uint32_t, uint64_t>> formats;
+    auto entries = static_cast<entry const*>(map);
+    for (auto index : tranche.indices) {
+        if (index >= events.table_size / sizeof(entry)) {
+            formats.clear();
+            break;
+        }
+        formats.emplace_back(entries[index].format, entries[index].modifier);
+    }
+
+    munmap(map, events.table_size);
+    return formats;
+}
+
 std::unique_ptr<Wrapland::Server::linux_dmabuf_buffer_v1>
 TestLinuxDmabuf::import_function(std::vector<Wrapland::Server::linux_dmabuf_plane_v1> const& planes,
                                  uint32_t format,
@@ -231,5 +336,280 @@ void TestLinuxDmabuf::testCreateBufferSucess()
     delete paramV1;
 }
 
+void TestLinuxDmabuf::testCreateBufferAsync()
+{
+    // With an asynchronous import the created event is sent once the import is done.
+    using namespace Wrapland;
+
+    std::vector<Server::linux_dmabuf_import_done_v1> pending_imports;
+    std::vector<std::unique_ptr<Server::linux_dmabuf_buffer_v1>> imported;
+
+    server.globals.linux_dmabuf_v1 = std::make_unique<Server::linux_dmabuf_v1>(
+        server.display.get(),
+        [&](auto const& planes,
+            auto format,
+            auto modifier,
+            auto const& size,
+            auto flags,
+            auto done) {
+            imported.push_back(std::make_unique<Server::linux_dmabuf_buffer_v1>(
+                planes, format, modifier, size, flags));
+            pending_imports.push_back(std::move(done));
+        });
+    server.globals.linux_dmabuf_v1->set_formats(modifiers);
+
+    Client::Registry registry;
+    QSignalSpy dmabufSpy(&registry, &Client::Registry::LinuxDmabufV1Announced);
+    QVERIFY(dmabufSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection->display());
+    registry.setup();
+    QVERIFY(dmabufSpy.wait());
+
+    std::unique_ptr<Client::LinuxDmabufV1> dmabuf(
+        registry.createLinuxDmabufV1(dmabufSpy.last().first().value<quint32>(),
+                                     dmabufSpy.last().last().value<quint32>()));
+    QVERIFY(dmabuf->isValid());
+
+    std::unique_ptr<Client::ParamsV1> params(dmabuf->createParamsV1());
+    QVERIFY(params->isValid());
+
+    QSignalSpy createdSpy(params.get(), &Client::ParamsV1::createSuccess);
+    QVERIFY(createdSpy.isValid());
+
+    int fd = memfd_create("AutotestBufferAsync", 0);
+    ftruncate(fd, 500);
+    params->addDmabuf(fd, 0, 0, 0, 12);
+    params->createDmabuf(32, 32, 64, 0);
+
+    QTRY_COMPARE(pending_imports.size(), 1);
+    QVERIFY(!createdSpy.wait(100));
+
+    pending_imports.front()(std::move(imported.front()));
+    QVERIFY(createdSpy.wait());
+
+    auto buffer = params->getBuffer();
+    QVERIFY(buffer);
+    wl_buffer_destroy(buffer);
+}
+
+void TestLinuxDmabuf::testCommitBeforeImport()
+{
+    // A buffer created with create_immed can be committed before its import is done. The commit
+    // is held back until then.
+    using namespace Wrapland;
+
+    qRegisterMetaType<Server::Surface*>();
+
+    std::vector<Server::linux_dmabuf_import_done_v1> pending_imports;
+    std::vector<std::unique_ptr<Server::linux_dmabuf_buffer_v1>> imported;
+
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.linux_dmabuf_v1 = std::make_unique<Server::linux_dmabuf_v1>(
+        server.display.get(),
+        [&](auto const& planes,
+            auto format,
+            auto modifier,
+            auto const& size,
+            auto flags,
+            auto done) {
+            imported.push_back(std::make_unique<Server::linux_dmabuf_buffer_v1>(
+                planes, format, modifier, size, flags));
+            pending_imports.push_back(std::move(done));
+        });
+    server.globals.linux_dmabuf_v1->set_formats(modifiers);
+
+    Client::Registry registry;
+    QSignalSpy dmabufSpy(&registry, &Client::Registry::LinuxDmabufV1Announced);
+    QVERIFY(dmabufSpy.isValid());
+    QSignalSpy compositorSpy(&registry, &Client::Registry::compositorAnnounced);
+    QVERIFY(compositorSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection->display());
+    registry.setup();
+    QVERIFY(dmabufSpy.wait());
+    QVERIFY(compositorSpy.count() || compositorSpy.wait());
+
+    std::unique_ptr<Client::LinuxDmabufV1> dmabuf(
+        registry.createLinuxDmabufV1(dmabufSpy.last().first().value<quint32>(),
+                                     dmabufSpy.last().last().value<quint32>()));
+    QVERIFY(dmabuf->isValid());
+    m_compositor = registry.createCompositor(compositorSpy.last().first().value<quint32>(),
+                                             compositorSpy.last().last().value<quint32>(),
+                                             this);
+    QVERIFY(m_compositor->isValid());
+
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+    std::unique_ptr<Client::Surface> surface(m_compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Server::Surface*>();
+
+    QSignalSpy queuedSpy(serverSurface, &Server::Surface::commit_queued);
+    QVERIFY(queuedSpy.isValid());
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+
+    std::unique_ptr<Client::ParamsV1> params(dmabuf->createParamsV1());
+    QVERIFY(params->isValid());
+
+    int fd = memfd_create("AutotestBufferImmed", 0);
+    ftruncate(fd, 500);
+    params->addDmabuf(fd, 0, 0, 0, 12);
+    auto buffer = params->createDmabufImmediate(32, 32, 64, 0);
+    QVERIFY(buffer);
+
+    surface->attachBuffer(buffer);
+    surface->damage(QRect(0, 0, 32, 32));
+    surface->commit(Client::Surface::CommitFlag::None);
+
+    QVERIFY(queuedSpy.wait());
+    QCOMPARE(pending_imports.size(), 1);
+    QVERIFY(committedSpy.empty());
+    QVERIFY(serverSurface->has_queued_commits());
+
+    // A refresh cycle does not apply it either.
+    serverSurface->apply_queued_commits(std::chrono::nanoseconds::zero());
+    QVERIFY(committedSpy.empty());
+
+    pending_imports.front()(std::move(imported.front()));
+
+    QCOMPARE(committedSpy.count(), 1);
+    QVERIFY(!serverSurface->has_queued_commits());
+    QVERIFY(serverSurface->state().updates & Server::surface_change::size);
+    QCOMPARE(serverSurface->size(), QSize(32, 32));
+    QVERIFY(serverSurface->state().buffer->linuxDmabufBuffer());
+    QCOMPARE(serverSurface->state().buffer->size(), QSize(32, 32));
+
+    wl_buffer_destroy(buffer);
+}
+
+void TestLinuxDmabuf::testFeedback()
+{
+    // Clients binding version 4 receive default and per-surface feedback through a format table.
+    using namespace Wrapland;
+    using format_list = std::vector<std::pair<uint32_t, uint64_t>>;
+
+    qRegisterMetaType<Server::Surface*>();
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+
+    Client::Registry registry;
+    QSignalSpy allAnnounced(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(allAnnounced.isValid());
+    QSignalSpy dmabufAnnounced(&registry, &Client::Registry::LinuxDmabufV1Announced);
+    QVERIFY(dmabufAnnounced.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection->display());
+    registry.setup();
+    QVERIFY(allAnnounced.wait());
+
+    // Without default feedback there is no main device to send. Only version 3 is advertised.
+    QCOMPARE(registry.interface(Client::Registry::Interface::LinuxDmabufV1).version, 3);
+
+    Server::linux_dmabuf_feedback_v1 default_feedback;
+    default_feedback.main_device = 42;
+    default_feedback.tranches.push_back({.device = 42, .flags = {}, .formats = {{1212, {12, 13}}}});
+
+    dmabufAnnounced.clear();
+    server.globals.linux_dmabuf_v1.reset();
+    server.globals.linux_dmabuf_v1 = std::make_unique<Server::linux_dmabuf_v1>(
+        server.display.get(),
+        [this](auto const& planes, auto format, auto modifier, auto const& size, auto flags) {
+            return import_function(planes, format, modifier, size, flags);
+        },
+        default_feedback);
+    QVERIFY(dmabufAnnounced.wait());
+
+    auto const dmabuf_iface = registry.interface(Client::Registry::Interface::LinuxDmabufV1);
+    QCOMPARE(dmabuf_iface.version, 4);
+    auto dmabuf = static_cast<zwp_linux_dmabuf_v1*>(
+        wl_registry_bind(registry, dmabuf_iface.name, &zwp_linux_dmabuf_v1_interface, 4));
+    m_queue->addProxy(dmabuf);
+
+    auto const compositor_iface = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor
+        = registry.createCompositor(compositor_iface.name, compositor_iface.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    // Default feedback.
+    feedback_events default_events;
+    auto feedback = zwp_linux_dmabuf_v1_get_default_feedback(dmabuf);
+    m_queue->addProxy(feedback);
+    zwp_linux_dmabuf_feedback_v1_add_listener(feedback, &feedback_listener, &default_events);
+
+    QTRY_COMPARE(default_events.done, 1);
+    QCOMPARE(default_events.main_device, 42);
+    QCOMPARE(default_events.tranches.size(), 1);
+    QCOMPARE(default_events.tranches.at(0).device, 42);
+    QCOMPARE(default_events.tranches.at(0).flags, 0);
+    QCOMPARE(default_events.table_size, 32);
+
+    auto formats = tranche_formats(default_events, default_events.tranches.at(0));
+    std::sort(formats.begin(), formats.end());
+    QCOMPARE(formats, (format_list{{1212, 12}, {1212, 13}}));
+
+    // Surface feedback first falls back to the default feedback.
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+    std::unique_ptr<Client::Surface> surface(m_compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Server::Surface*>();
+
+    feedback_events surface_events;
+    auto surface_feedback = zwp_linux_dmabuf_v1_get_surface_feedback(dmabuf, *surface);
+    m_queue->addProxy(surface_feedback);
+    zwp_linux_dmabuf_feedback_v1_add_listener(
+        surface_feedback, &feedback_listener, &surface_events);
+
+    QTRY_COMPARE(surface_events.done, 1);
+    QCOMPARE(surface_events.tranches.size(), 1);
+
+    // The compositor prefers scanout for the surface.
+    auto scanout_feedback = default_feedback;
+    scanout_feedback.tranches.insert(scanout_feedback.tranches.begin(),
+                                     {.device = 43,
+                                      .flags = Server::linux_dmabuf_tranche_flag_v1::scanout,
+                                      .formats = {{1212, {13}}}});
+    server.globals.linux_dmabuf_v1->set_surface_feedback(serverSurface, scanout_feedback);
+
+    QTRY_COMPARE(surface_events.done, 2);
+    QCOMPARE(surface_events.tranches.size(), 2);
+    QCOMPARE(surface_events.tranches.at(0).device, 43);
+    QCOMPARE(surface_events.tranches.at(0).flags,
+             ZWP_LINUX_DMABUF_FEEDBACK_V1_TRANCHE_FLAGS_SCANOUT);
+
+    // The pair in both tranches has one table entry.
+    QCOMPARE(surface_events.table_size, 32);
+    QCOMPARE(tranche_formats(surface_events, surface_events.tranches.at(0)),
+             (format_list{{1212, 13}}));
+
+    // Unsetting the surface feedback resends the default feedback.
+    server.globals.linux_dmabuf_v1->set_surface_feedback(serverSurface, std::nullopt);
+    QTRY_COMPARE(surface_events.done, 3);
+    QCOMPARE(surface_events.tranches.size(), 1);
+    QCOMPARE(surface_events.tranches.at(0).flags, 0);
+
+    // The default feedback was not touched.
+    QCOMPARE(default_events.done, 1);
+
+    // Feedback without main device is ignored.
+    server.globals.linux_dmabuf_v1->set_default_feedback({});
+    default_feedback.tranches.front().formats = {{1212, {12}}};
+    server.globals.linux_dmabuf_v1->set_default_feedback(default_feedback);
+
+    QTRY_COMPARE(default_events.done, 2);
+    QCOMPARE(default_events.main_device, 42);
+    QCOMPARE(default_events.table_size, 16);
+    QTRY_COMPARE(surface_events.done, 4);
+
+    zwp_linux_dmabuf_feedback_v1_destroy(surface_feedback);
+    zwp_linux_dmabuf_feedback_v1_destroy(feedback);
+    zwp_linux_dmabuf_v1_destroy(dmabuf);
+    close(default_events.table_fd);
+    close(surface_events.table_fd);
+}
+
 QTEST_GUILESS_MAIN(TestLinuxDmabuf)
 #include "linux_dmabuf.moc"
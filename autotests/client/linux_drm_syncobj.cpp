@@ -0,0 +1,387 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/linux_dmabuf_v1.h"
+#include "../../src/client/linux_drm_syncobj_v1.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/shm_pool.h"
+#include "../../src/client/surface.h"
+
+#include "../../server/buffer.h"
+#include "../../server/compositor.h"
+#include "../../server/display.h"
+#include "../../server/linux_dmabuf_v1.h"
+#include "../../server/linux_drm_syncobj_v1.h"
+#include "../../server/surface.h"
+
+#include "../../tests/globals.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <wayland-client-protocol.h>
+#include <wayland-linux-drm-syncobj-v1-client-protocol.h>
+
+using namespace Wrapland;
+
+class test_timeline : public Server::linux_drm_syncobj_timeline_v1
+{
+public:
+    explicit test_timeline(int fd)
+        : fd{fd}
+    {
+    }
+    ~test_timeline() override
+    {
+        close(fd);
+    }
+
+    void signal(uint64_t point) override
+    {
+        signaled.push_back(point);
+    }
+
+    int fd;
+    std::vector<uint64_t> signaled;
+};
+
+class TestLinuxDrmSyncobj : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestLinuxDrmSyncobj(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testImportFailed();
+    void testPoints();
+    void testCommitErrors_data();
+    void testCommitErrors();
+
+private:
+    Server::Surface* create_surface(std::unique_ptr<Client::Surface>& surface);
+    wl_buffer* create_dmabuf_buffer();
+
+    struct {
+        std::unique_ptr<Server::Display> display;
+        Server::globals globals;
+    } server;
+
+    std::vector<std::shared_ptr<test_timeline>> timelines;
+    bool import_fails{false};
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::Compositor* m_compositor{nullptr};
+    Client::ShmPool* m_shm{nullptr};
+    Client::LinuxDmabufV1* m_dmabuf{nullptr};
+    Client::linux_drm_syncobj_manager_v1* m_syncobj{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-linux-drm-syncobj-0"};
+
+TestLinuxDrmSyncobj::TestLinuxDrmSyncobj(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<Server::Surface*>();
+}
+
+void TestLinuxDrmSyncobj::init()
+{
+    import_fails = false;
+
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.display->createShm();
+
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.linux_dmabuf_v1 = std::make_unique<Server::linux_dmabuf_v1>(
+        server.display.get(),
+        [](auto const& planes, auto format, auto modifier, auto const& size, auto flags) {
+            return std::make_unique<Server::linux_dmabuf_buffer_v1>(
+                planes, format, modifier, size, flags);
+        });
+    server.globals.linux_dmabuf_v1->set_formats({Server::drm_format{1212, {12}}});
+    server.globals.linux_drm_syncobj_manager_v1
+        = std::make_unique<Server::linux_drm_syncobj_manager_v1>(
+            server.display.get(),
+            [this](int fd) -> std::shared_ptr<Server::linux_drm_syncobj_timeline_v1> {
+                if (import_fails) {
+                    close(fd);
+                    return nullptr;
+                }
+                timelines.push_back(std::make_shared<test_timeline>(fd));
+                return timelines.back();
+            });
+
+    // setup connection
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy connectedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(connectedSpy.isValid());
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+
+    Client::Registry registry;
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection);
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    auto const compositor = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor = registry.createCompositor(compositor.name, compositor.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    auto const shm = registry.interface(Client::Registry::Interface::Shm);
+    m_shm = registry.createShmPool(shm.name, shm.version, this);
+    QVERIFY(m_shm->isValid());
+
+    auto const dmabuf = registry.interface(Client::Registry::Interface::LinuxDmabufV1);
+    m_dmabuf = registry.createLinuxDmabufV1(dmabuf.name, dmabuf.version, this);
+    QVERIFY(m_dmabuf->isValid());
+
+    auto const syncobj
+        = registry.interface(Client::Registry::Interface::LinuxDrmSyncobjManagerV1);
+    QVERIFY(syncobj.name != 0);
+    m_syncobj = registry.createLinuxDrmSyncobjManagerV1(syncobj.name, syncobj.version, this);
+    QVERIFY(m_syncobj->isValid());
+}
+
+void TestLinuxDrmSyncobj::cleanup()
+{
+#define CLEANUP(variable)                                                                          \
+    if (variable) {                                                                                \
+        delete variable;                                                                           \
+        variable = nullptr;                                                                        \
+    }
+    CLEANUP(m_syncobj)
+    CLEANUP(m_dmabuf)
+    CLEANUP(m_shm)
+    CLEANUP(m_compositor)
+    CLEANUP(m_queue)
+    if (m_connection) {
+        m_connection->deleteLater();
+        m_connection = nullptr;
+    }
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+#undef CLEANUP
+
+    server = {};
+    timelines.clear();
+}
+
+Server::Surface* TestLinuxDrmSyncobj::create_surface(std::unique_ptr<Client::Surface>& surface)
+{
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    if (!surfaceCreatedSpy.isValid()) {
+        return nullptr;
+    }
+
+    surface.reset(m_compositor->createSurface());
+    if (!surfaceCreatedSpy.wait()) {
+        return nullptr;
+    }
+    return surfaceCreatedSpy.first().first().value<Server::Surface*>();
+}
+
+wl_buffer* TestLinuxDrmSyncobj::create_dmabuf_buffer()
+{
+    std::unique_ptr<Client::ParamsV1> params(m_dmabuf->createParamsV1());
+    QSignalSpy createdSpy(params.get(), &Client::ParamsV1::createSuccess);
+
+    auto fd = memfd_create("AutotestSyncobjBuffer", 0);
+    ftruncate(fd, 500);
+    params->addDmabuf(fd, 0, 0, 0, 12);
+    params->createDmabuf(10, 10, 1212, 0);
+
+    if (!createdSpy.wait()) {
+        return nullptr;
+    }
+    return params->getBuffer();
+}
+
+void TestLinuxDrmSyncobj::testImportFailed()
+{
+    import_fails = true;
+
+    QSignalSpy errorSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(errorSpy.isValid());
+
+    auto fd = memfd_create("AutotestSyncobjTimeline", 0);
+    auto timeline = m_syncobj->import_timeline(fd);
+    close(fd);
+
+    QVERIFY(errorSpy.wait());
+    QVERIFY(m_connection->error());
+    QVERIFY(timelines.empty());
+    wp_linux_drm_syncobj_timeline_v1_destroy(timeline);
+}
+
+void TestLinuxDrmSyncobj::testPoints()
+{
+    // Committed points are exposed in the surface state and the release point is signaled once
+    // the buffer is not used anymore.
+    std::unique_ptr<Client::Surface> surface;
+    auto serverSurface = create_surface(surface);
+    QVERIFY(serverSurface);
+
+    auto fd = memfd_create("AutotestSyncobjTimeline", 0);
+    auto timeline = m_syncobj->import_timeline(fd);
+    close(fd);
+    auto syncobj_surface = m_syncobj->get_surface(surface.get());
+
+    auto buffer1 = create_dmabuf_buffer();
+    QVERIFY(buffer1);
+    QCOMPARE(timelines.size(), 1);
+    auto server_timeline = timelines.front();
+
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+
+    wp_linux_drm_syncobj_surface_v1_set_acquire_point(syncobj_surface, timeline, 0, 1);
+    wp_linux_drm_syncobj_surface_v1_set_release_point(syncobj_surface, timeline, 1, 2);
+    surface->attachBuffer(buffer1);
+    surface->damage(QRect(0, 0, 10, 10));
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+
+    auto const& state = serverSurface->state();
+    QVERIFY(state.buffer);
+    QVERIFY(state.acquire_point);
+    QCOMPARE(state.acquire_point->timeline, server_timeline);
+    QCOMPARE(state.acquire_point->value, 1);
+    QVERIFY(state.release_point);
+    QCOMPARE(state.release_point->value, (uint64_t{1} << 32) + 2);
+    QVERIFY(server_timeline->signaled.empty());
+
+    // The timeline stays valid after the client destroyed it.
+    wp_linux_drm_syncobj_timeline_v1_destroy(timeline);
+
+    // Replacing the buffer releases the previous one.
+    auto buffer2 = create_dmabuf_buffer();
+    QVERIFY(buffer2);
+
+    fd = memfd_create("AutotestSyncobjTimeline2", 0);
+    auto timeline2 = m_syncobj->import_timeline(fd);
+    close(fd);
+
+    wp_linux_drm_syncobj_surface_v1_set_acquire_point(syncobj_surface, timeline2, 0, 5);
+    wp_linux_drm_syncobj_surface_v1_set_release_point(syncobj_surface, timeline2, 0, 6);
+    surface->attachBuffer(buffer2);
+    surface->damage(QRect(0, 0, 10, 10));
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+
+    QCOMPARE(server_timeline->signaled, std::vector<uint64_t>{(uint64_t{1} << 32) + 2});
+    QCOMPARE(timelines.size(), 2);
+    QCOMPARE(serverSurface->state().acquire_point->timeline, timelines.back());
+    QCOMPARE(serverSurface->state().acquire_point->value, 5);
+
+    // After destroying the synchronization object buffers can be attached without points.
+    wp_linux_drm_syncobj_surface_v1_destroy(syncobj_surface);
+    surface->attachBuffer(m_shm->createBuffer(QImage(QSize(10, 10), QImage::Format_RGB32)));
+    surface->damage(QRect(0, 0, 10, 10));
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+
+    QVERIFY(!serverSurface->state().acquire_point);
+    QVERIFY(!m_connection->error());
+    QCOMPARE(timelines.back()->signaled, std::vector<uint64_t>{6});
+
+    wp_linux_drm_syncobj_timeline_v1_destroy(timeline2);
+    wl_buffer_destroy(buffer1);
+    wl_buffer_destroy(buffer2);
+}
+
+void TestLinuxDrmSyncobj::testCommitErrors_data()
+{
+    QTest::addColumn<bool>("dmabuf");
+    QTest::addColumn<bool>("acquire");
+    QTest::addColumn<bool>("release");
+    QTest::addColumn<uint32_t>("release_point");
+
+    QTest::newRow("no-acquire") << true << false << true << 2U;
+    QTest::newRow("no-release") << true << true << false << 2U;
+    QTest::newRow("conflicting") << true << true << true << 1U;
+    QTest::newRow("shm") << false << true << true << 2U;
+}
+
+void TestLinuxDrmSyncobj::testCommitErrors()
+{
+    // Buffers must come with valid points and be dmabufs.
+    QFETCH(bool, dmabuf);
+    QFETCH(bool, acquire);
+    QFETCH(bool, release);
+    QFETCH(uint32_t, release_point);
+
+    std::unique_ptr<Client::Surface> surface;
+    auto serverSurface = create_surface(surface);
+    QVERIFY(serverSurface);
+
+    auto fd = memfd_create("AutotestSyncobjTimeline", 0);
+    auto timeline = m_syncobj->import_timeline(fd);
+    close(fd);
+    auto syncobj_surface = m_syncobj->get_surface(surface.get());
+
+    wl_buffer* buffer{nullptr};
+    if (dmabuf) {
+        buffer = create_dmabuf_buffer();
+        QVERIFY(buffer);
+        surface->attachBuffer(buffer);
+    } else {
+        surface->attachBuffer(m_shm->createBuffer(QImage(QSize(10, 10), QImage::Format_RGB32)));
+    }
+
+    if (acquire) {
+        wp_linux_drm_syncobj_surface_v1_set_acquire_point(syncobj_surface, timeline, 0, 1);
+    }
+    if (release) {
+        wp_linux_drm_syncobj_surface_v1_set_release_point(
+            syncobj_surface, timeline, 0, release_point);
+    }
+
+    QSignalSpy errorSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(errorSpy.isValid());
+
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(errorSpy.wait());
+    QVERIFY(m_connection->error());
+
+    wp_linux_drm_syncobj_surface_v1_destroy(syncobj_surface);
+    wp_linux_drm_syncobj_timeline_v1_destroy(timeline);
+    if (buffer) {
+        wl_buffer_destroy(buffer);
+    }
+}
+
+QTEST_GUILESS_MAIN(TestLinuxDrmSyncobj)
+#include "linux_drm_syncobj.moc"
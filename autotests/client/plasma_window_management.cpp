@@ -24,6 +24,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "../../src/client/connection_thread.h"
 #include "../../src/client/event_queue.h"
 #include "../../src/client/output.h"
+#include "../../src/client/plasma_stacking_order_v1.h"
 #include "../../src/client/plasmawindowmanagement.h"
 #include "../../src/client/region.h"
 #include "../../src/client/registry.h"
@@ -37,6 +38,9 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "../../tests/globals.h"
 
+#include <QUuid>
+
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -99,11 +103,16 @@ private Q_SLOTS:
     void testStackingOrderUuid_data();
     void testStackingOrderUuid();
     void testStackingOrderUuid_empty();
+    void testStackingOrderUuidDelta_data();
+    void testStackingOrderUuidDelta();
+    void testStackingOrderUuidManyWindows();
 
     void testSendToOutput();
     void testResourceNameChanged();
 
 private:
+    void setup_stacking_order_manager();
+
     struct {
         std::unique_ptr<Wrapland::Server::Display> display;
         Wrapland::Server::globals globals;
@@ -117,6 +126,7 @@ private:
     Clt::Compositor* m_compositor{};
     Clt::EventQueue* m_queue{};
     Clt::PlasmaWindowManagement* m_windowManagement{};
+    Clt::plasma_stacking_order_manager_v1* m_stackingOrderManager{};
     Clt::PlasmaWindow* m_window{};
     QThread* m_thread{};
     Clt::Registry* m_registry{};
@@ -222,6 +232,10 @@ void TestWindowManagement::cleanup()
         delete m_compositor;
         m_compositor = nullptr;
     }
+    if (m_stackingOrderManager) {
+        delete m_stackingOrderManager;
+        m_stackingOrderManager = nullptr;
+    }
     if (m_windowManagement) {
         delete m_windowManagement;
         m_windowManagement = nullptr;
@@ -249,6 +263,26 @@ void TestWindowManagement::cleanup()
     server = {};
 }
 
+void TestWindowManagement::setup_stacking_order_manager()
+{
+    QSignalSpy manager_spy(m_registry, &Clt::Registry::plasmaStackingOrderManagerV1Announced);
+    QVERIFY(manager_spy.isValid());
+
+    server.globals.plasma_stacking_order_manager_v1
+        = std::make_unique<Srv::plasma_stacking_order_manager_v1>(server.display.get());
+
+    QVERIFY(manager_spy.wait());
+    m_stackingOrderManager = m_registry->createPlasmaStackingOrderManagerV1(
+        manager_spy.first().first().value<quint32>(),
+        manager_spy.first().last().value<quint32>(),
+        this);
+    QVERIFY(m_stackingOrderManager->isValid());
+
+    m_windowManagement->set_stacking_order_manager(m_stackingOrderManager);
+    m_connection->flush();
+    server.display->dispatchEvents();
+}
+
 void TestWindowManagement::testWindowTitle()
 {
     server.plasma_window->setTitle(QStringLiteral("Test Title"));
@@ -852,6 +886,81 @@ void TestWindowManagement::testStackingOrderUuid_empty()
     QCOMPARE(m_windowManagement->stacking_order_uuid().size(), 0);
 }
 
+void TestWindowManagement::testStackingOrderUuidDelta_data()
+{
+    using stack = std::vector<std::string>;
+    QTest::addColumn<stack>("initial");
+    QTest::addColumn<stack>("stack");
+
+    QTest::newRow("raise") << stack{"a", "b", "c", "d"} << stack{"a", "c", "d", "b"};
+    QTest::newRow("lower") << stack{"a", "b", "c", "d"} << stack{"d", "a", "b", "c"};
+    QTest::newRow("add") << stack{"a", "b"} << stack{"a", "x", "b"};
+    QTest::newRow("remove") << stack{"a", "b", "c"} << stack{"a", "c"};
+    QTest::newRow("reverse") << stack{"a", "b", "c", "d"} << stack{"d", "c", "b", "a"};
+    QTest::newRow("mixed") << stack{"a", "b", "c", "d", "e", "f", "g", "h"}
+                           << stack{"b", "x", "a", "d", "f", "g", "h", "y"};
+}
+
+void TestWindowManagement::testStackingOrderUuidDelta()
+{
+    // The initial stack is received in full. With the stacking order extension later changes are
+    // sent incrementally. The result must be the same.
+    QSignalSpy stacking_order_spy(m_windowManagement,
+                                  &Clt::PlasmaWindowManagement::stacking_order_uuid_changed);
+    QVERIFY(stacking_order_spy.isValid());
+
+    QFETCH(std::vector<std::string>, initial);
+    server.globals.plasma_window_manager->set_stacking_order_uuids(initial);
+
+    QVERIFY(stacking_order_spy.wait());
+    QCOMPARE(m_windowManagement->stacking_order_uuid(), initial);
+    stacking_order_spy.clear();
+
+    setup_stacking_order_manager();
+
+    QFETCH(std::vector<std::string>, stack);
+    server.globals.plasma_window_manager->set_stacking_order_uuids(stack);
+
+    QVERIFY(stacking_order_spy.wait());
+    QCOMPARE(stacking_order_spy.count(), 1);
+    QCOMPARE(m_windowManagement->stacking_order_uuid(), stack);
+}
+
+void TestWindowManagement::testStackingOrderUuidManyWindows()
+{
+    // Raises windows one after the other in a large stack. This goes through incremental updates
+    // and periodic resyncs of the complete stack.
+    setup_stacking_order_manager();
+
+    QSignalSpy stacking_order_spy(m_windowManagement,
+                                  &Clt::PlasmaWindowManagement::stacking_order_uuid_changed);
+    QVERIFY(stacking_order_spy.isValid());
+
+    std::vector<std::string> stack;
+    for (int i = 0; i < 300; i++) {
+        stack.push_back(QUuid::createUuid().toString().toStdString());
+    }
+    server.globals.plasma_window_manager->set_stacking_order_uuids(stack);
+    QVERIFY(stacking_order_spy.wait());
+    QCOMPARE(m_windowManagement->stacking_order_uuid(), stack);
+
+    for (int i = 0; i < 100; i++) {
+        std::rotate(stack.begin() + i, stack.begin() + i + 1, stack.end());
+        server.globals.plasma_window_manager->set_stacking_order_uuids(stack);
+
+        QVERIFY(stacking_order_spy.wait());
+        QCOMPARE(m_windowManagement->stacking_order_uuid(), stack);
+    }
+
+    // Windows are closed and new ones opened.
+    stack.erase(stack.begin() + 10, stack.begin() + 20);
+    stack.insert(stack.begin() + 50, "new window");
+    server.globals.plasma_window_manager->set_stacking_order_uuids(stack);
+
+    QVERIFY(stacking_order_spy.wait());
+    QCOMPARE(m_windowManagement->stacking_order_uuid(), stack);
+}
+
 void TestWindowManagement::testSendToOutput()
 {
     QSignalSpy sendToOutputSpy(server.plasma_window, &Srv::PlasmaWindow::sendToOutputRequested);
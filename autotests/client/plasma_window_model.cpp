@@ -94,6 +94,7 @@ private Q_SLOTS:
     void testAppId();
     void testPid();
     void testVirtualDesktops();
+    void testCoalescedDataChanged();
 
     // TODO icon: can we ensure a theme is installed on CI?
     void testRequests();
@@ -122,6 +123,16 @@ private:
 
 constexpr auto socket_name{"wrapland-test-fake-input-0"};
 
+// Returns the roles of all dataChanged signals received by @p spy.
+QVector<int> changed_roles(QSignalSpy const& spy)
+{
+    QVector<int> roles;
+    for (auto const& args : spy) {
+        roles.append(args.last().value<QVector<int>>());
+    }
+    return roles;
+}
+
 void PlasmaWindowModelTest::init()
 {
     server.display = std::make_unique<Wrapland::Server::Display>();
@@ -570,18 +581,11 @@ void PlasmaWindowModelTest::testGeometry()
 
     QVERIFY(dataChangedSpy.wait());
 
-    // An icon and the geometry will be sent.
-    QTRY_COMPARE(dataChangedSpy.count(), 2);
+    // The icon is received with QtConcurrent in the beginning. So it can arrive before, after or
+    // together with the geometry.
+    QTRY_VERIFY(changed_roles(dataChangedSpy).contains(Clt::PlasmaWindowModel::Geometry));
     QCOMPARE(dataChangedSpy.first().first().toModelIndex(), index);
 
-    // The icon is received with QtConcurrent in the beginning. So it can arrive before or after
-    // the geometry.
-    bool const last
-        = dataChangedSpy[0].last().value<QVector<int>>() == QVector<int>{int(Qt::DecorationRole)};
-
-    QCOMPARE(dataChangedSpy[last ? 1 : 0].last().value<QVector<int>>(),
-             QVector<int>{int(Clt::PlasmaWindowModel::Geometry)});
-
     QCOMPARE(model->data(index, Clt::PlasmaWindowModel::Geometry).toRect(), geom);
 }
 
@@ -609,17 +613,10 @@ void PlasmaWindowModelTest::testTitle()
     serverWindow->setTitle(QStringLiteral("foo"));
     QVERIFY(dataChangedSpy.wait());
 
-    // An icon and the title will be sent.
-    QTRY_COMPARE(dataChangedSpy.count(), 2);
+    // The icon is received with QtConcurrent in the beginning. So it can arrive before, after or
+    // together with the title.
+    QTRY_VERIFY(changed_roles(dataChangedSpy).contains(Qt::DisplayRole));
     QCOMPARE(dataChangedSpy.first().first().toModelIndex(), index);
-
-    // The icon is received with QtConcurrent in the beginning. So it can arrive before or after
-    // the title.
-    bool const last
-        = dataChangedSpy[0].last().value<QVector<int>>() == QVector<int>{int(Qt::DecorationRole)};
-
-    QCOMPARE(dataChangedSpy[last ? 1 : 0].last().value<QVector<int>>(),
-             QVector<int>{int(Qt::DisplayRole)});
     QCOMPARE(model->data(index, Qt::DisplayRole).toString(), QStringLiteral("foo"));
 }
 
@@ -647,17 +644,10 @@ void PlasmaWindowModelTest::testAppId()
     serverWindow->setAppId(QStringLiteral("org.kde.testapp"));
     QVERIFY(dataChangedSpy.count() || dataChangedSpy.wait());
 
-    // The App Id and the geometry will be sent.
-    QTRY_COMPARE(dataChangedSpy.count(), 2);
+    // The icon is received with QtConcurrent in the beginning. So it can arrive before, after or
+    // together with the app id.
+    QTRY_VERIFY(changed_roles(dataChangedSpy).contains(Clt::PlasmaWindowModel::AppId));
     QCOMPARE(dataChangedSpy.first().first().toModelIndex(), index);
-
-    // The icon is received with QtConcurrent in the beginning. So it can arrive before or after
-    // the app id.
-    bool const last
-        = dataChangedSpy[0].last().value<QVector<int>>() == QVector<int>{int(Qt::DecorationRole)};
-
-    QCOMPARE(dataChangedSpy[last ? 1 : 0].last().value<QVector<int>>(),
-             QVector<int>{int(Clt::PlasmaWindowModel::AppId)});
     QCOMPARE(model->data(index, Clt::PlasmaWindowModel::AppId).toString(),
              QStringLiteral("org.kde.testapp"));
 }
@@ -705,21 +695,15 @@ void PlasmaWindowModelTest::testVirtualDesktops()
 
     serverWindow->addPlasmaVirtualDesktop("desktop1");
     QVERIFY(dataChangedSpy.wait());
-    QTRY_COMPARE(dataChangedSpy.count(), 3);
+
+    // The icon is received with QtConcurrent in the beginning. So it can arrive before, after or
+    // together with the virtual desktop.
+    QTRY_VERIFY(changed_roles(dataChangedSpy).contains(Clt::PlasmaWindowModel::IsOnAllDesktops));
+    QVERIFY(changed_roles(dataChangedSpy).contains(Clt::PlasmaWindowModel::VirtualDesktops));
 
     QCOMPARE(dataChangedSpy.first().first().toModelIndex(), index);
     QCOMPARE(dataChangedSpy.last().first().toModelIndex(), index);
 
-    // The icon is received with QtConcurrent in the beginning. So it can arrive before or after
-    // the virtual desktop.
-    bool const last
-        = dataChangedSpy[0].last().value<QVector<int>>() == QVector<int>{int(Qt::DecorationRole)};
-
-    QCOMPARE(dataChangedSpy[last ? 1 : 0].last().value<QVector<int>>(),
-             QVector<int>{int(Clt::PlasmaWindowModel::VirtualDesktops)});
-    QCOMPARE(dataChangedSpy[last ? 2 : 1].last().value<QVector<int>>(),
-             QVector<int>{int(Clt::PlasmaWindowModel::IsOnAllDesktops)});
-
     QCOMPARE(model->data(index, Clt::PlasmaWindowModel::VirtualDesktops).toStringList(),
              QStringList({"desktop1"}));
     QCOMPARE(model->data(index, Clt::PlasmaWindowModel::IsOnAllDesktops).toBool(), false);
@@ -743,10 +727,7 @@ void PlasmaWindowModelTest::testVirtualDesktops()
     serverWindow->removePlasmaVirtualDesktop("desktop1");
 
     QVERIFY(dataChangedSpy.wait());
-    QTRY_COMPARE(dataChangedSpy.count(), 5);
-
-    QCOMPARE(dataChangedSpy.last().last().value<QVector<int>>(),
-             QVector<int>{int(Clt::PlasmaWindowModel::IsOnAllDesktops)});
+    QTRY_VERIFY(changed_roles(dataChangedSpy).contains(Clt::PlasmaWindowModel::IsOnAllDesktops));
 
     QCOMPARE(model->data(index, Clt::PlasmaWindowModel::VirtualDesktops).toStringList(),
              QStringList({}));
@@ -754,6 +735,46 @@ void PlasmaWindowModelTest::testVirtualDesktops()
     QVERIFY(!dataChangedSpy.wait(100));
 }
 
+void PlasmaWindowModelTest::testCoalescedDataChanged()
+{
+    // This test verifies that changes received together are announced with a single signal.
+    auto* model = m_pw->createWindowModel();
+    QVERIFY(model);
+
+    QSignalSpy rowInsertedSpy(model, &Clt::PlasmaWindowModel::rowsInserted);
+    QVERIFY(rowInsertedSpy.isValid());
+    QSignalSpy dataChangedSpy(model, &Clt::PlasmaWindowModel::dataChanged);
+    QVERIFY(dataChangedSpy.isValid());
+
+    auto serverWindow = server.globals.plasma_window_manager->createWindow();
+    QVERIFY(serverWindow);
+    QVERIFY(rowInsertedSpy.wait());
+
+    // Wait for the first event announcing the icon on resource creation.
+    QVERIFY(dataChangedSpy.count() == 1 || dataChangedSpy.wait());
+    dataChangedSpy.clear();
+
+    serverWindow->setTitle(QStringLiteral("foo"));
+    serverWindow->setActive(true);
+    serverWindow->setMaximized(true);
+    serverWindow->setActive(false);
+
+    QVERIFY(dataChangedSpy.wait());
+    QVERIFY(!dataChangedSpy.wait(100));
+    QCOMPARE(dataChangedSpy.count(), 1);
+
+    auto const index = model->index(0);
+    QCOMPARE(dataChangedSpy.first().first().toModelIndex(), index);
+    QCOMPARE(dataChangedSpy.first().last().value<QVector<int>>(),
+             QVector<int>({int(Qt::DisplayRole),
+                           int(Clt::PlasmaWindowModel::IsActive),
+                           int(Clt::PlasmaWindowModel::IsMaximized)}));
+
+    QCOMPARE(model->data(index, Qt::DisplayRole).toString(), QStringLiteral("foo"));
+    QCOMPARE(model->data(index, Clt::PlasmaWindowModel::IsActive).toBool(), false);
+    QCOMPARE(model->data(index, Clt::PlasmaWindowModel::IsMaximized).toBool(), true);
+}
+
 void PlasmaWindowModelTest::testRequests()
 {
     // This test verifies that the various requests are properly passed to the server.
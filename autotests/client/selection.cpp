@@ -39,6 +39,10 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "../../tests/globals.h"
 
+#include <array>
+#include <fcntl.h>
+#include <unistd.h>
+
 class SelectionTest : public QObject
 {
     Q_OBJECT
@@ -46,6 +50,8 @@ private Q_SLOTS:
     void init();
     void cleanup();
     void testClearOnEnter();
+    void testSelectionCache();
+    void testSelectionCacheSourceDestroyed();
 
 private:
     struct {
@@ -73,6 +79,26 @@ private:
 
 constexpr auto socket_name{"wrapland-test-selection-0"};
 
+int receive_selection(Wrapland::Server::Seat* seat, std::string const& mime_type)
+{
+    std::array<int, 2> pipe_fds{};
+    if (pipe2(pipe_fds.data(), O_CLOEXEC | O_NONBLOCK) != 0) {
+        return -1;
+    }
+    seat->selection()->request_data(mime_type, pipe_fds[1]);
+    return pipe_fds[0];
+}
+
+bool read_all(int fd, QByteArray& data)
+{
+    std::array<char, 64> buffer{};
+    ssize_t count{0};
+    while ((count = read(fd, buffer.data(), buffer.size())) > 0) {
+        data.append(buffer.data(), count);
+    }
+    return count == 0;
+}
+
 void SelectionTest::init()
 {
     qRegisterMetaType<Wrapland::Server::Surface*>();
@@ -294,5 +320,147 @@ void SelectionTest::testClearOnEnter()
     QVERIFY(selectionOfferedClient2Spy.empty());
 }
 
+void SelectionTest::testSelectionCache()
+{
+    // This test verifies that selection data is read once into the cache and served from there,
+    // also after the source went away.
+    server.seat->set_selection_cache({.max_size = 1024, .mime_types = {"text/plain"}});
+
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Wrapland::Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+    std::unique_ptr<Wrapland::Client::Surface> surface(m_client1.compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Wrapland::Server::Surface*>();
+    QVERIFY(serverSurface);
+
+    QSignalSpy keyboardEnteredSpy(m_client1.keyboard, &Wrapland::Client::Keyboard::entered);
+    QVERIFY(keyboardEnteredSpy.isValid());
+    server.seat->setFocusedKeyboardSurface(serverSurface);
+    QVERIFY(keyboardEnteredSpy.wait());
+
+    QSignalSpy selectionChangedSpy(server.seat, &Wrapland::Server::Seat::selectionChanged);
+    QVERIFY(selectionChangedSpy.isValid());
+
+    std::unique_ptr<Wrapland::Client::DataSource> dataSource(m_client1.ddm->createSource());
+    QSignalSpy sendRequestedSpy(dataSource.get(),
+                                &Wrapland::Client::DataSource::sendDataRequested);
+    QVERIFY(sendRequestedSpy.isValid());
+    dataSource->offer(QStringLiteral("text/plain"));
+    dataSource->offer(QStringLiteral("text/html"));
+    m_client1.dataDevice->setSelection(keyboardEnteredSpy.first().first().value<quint32>(),
+                                       dataSource.get());
+    QVERIFY(selectionChangedSpy.wait());
+
+    // The data for the cached mime type is requested right away.
+    QVERIFY(sendRequestedSpy.wait());
+    QCOMPARE(sendRequestedSpy.count(), 1);
+    QCOMPARE(sendRequestedSpy.first().first().toString(), QStringLiteral("text/plain"));
+
+    // Requested before the source provided the data.
+    auto early_fd = receive_selection(server.seat, "text/plain");
+    QVERIFY(early_fd >= 0);
+
+    auto source_fd = sendRequestedSpy.first().last().value<qint32>();
+    QCOMPARE(write(source_fd, "foo", 3), 3);
+    close(source_fd);
+
+    QByteArray early_data;
+    QTRY_VERIFY(read_all(early_fd, early_data));
+    close(early_fd);
+    QCOMPARE(early_data, QByteArray("foo"));
+
+    // Requested after the data was cached.
+    auto cached_fd = receive_selection(server.seat, "text/plain");
+    QVERIFY(cached_fd >= 0);
+    QByteArray cached_data;
+    QTRY_VERIFY(read_all(cached_fd, cached_data));
+    close(cached_fd);
+    QCOMPARE(cached_data, QByteArray("foo"));
+
+    // Both were served from the cache, but uncached types are still requested from the source.
+    QCOMPARE(sendRequestedSpy.count(), 1);
+    close(receive_selection(server.seat, "text/html"));
+    QVERIFY(sendRequestedSpy.wait());
+    QCOMPARE(sendRequestedSpy.count(), 2);
+    QCOMPARE(sendRequestedSpy.last().first().toString(), QStringLiteral("text/html"));
+    close(sendRequestedSpy.last().last().value<qint32>());
+
+    // Without the source the selection stays available with the cached mime type.
+    selectionChangedSpy.clear();
+    dataSource.reset();
+    QVERIFY(selectionChangedSpy.wait());
+    QVERIFY(server.seat->selection());
+    QCOMPARE(server.seat->selection()->mime_types(), std::vector<std::string>{"text/plain"});
+
+    auto kept_fd = receive_selection(server.seat, "text/plain");
+    QVERIFY(kept_fd >= 0);
+    QByteArray kept_data;
+    QTRY_VERIFY(read_all(kept_fd, kept_data));
+    close(kept_fd);
+    QCOMPARE(kept_data, QByteArray("foo"));
+}
+
+void SelectionTest::testSelectionCacheSourceDestroyed()
+{
+    // This test verifies that data still being written when the source is destroyed is cached
+    // completely.
+    server.seat->set_selection_cache({.max_size = 1024, .mime_types = {"text/plain"}});
+
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Wrapland::Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+    std::unique_ptr<Wrapland::Client::Surface> surface(m_client1.compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Wrapland::Server::Surface*>();
+    QVERIFY(serverSurface);
+
+    QSignalSpy keyboardEnteredSpy(m_client1.keyboard, &Wrapland::Client::Keyboard::entered);
+    QVERIFY(keyboardEnteredSpy.isValid());
+    server.seat->setFocusedKeyboardSurface(serverSurface);
+    QVERIFY(keyboardEnteredSpy.wait());
+
+    QSignalSpy selectionChangedSpy(server.seat, &Wrapland::Server::Seat::selectionChanged);
+    QVERIFY(selectionChangedSpy.isValid());
+
+    std::unique_ptr<Wrapland::Client::DataSource> dataSource(m_client1.ddm->createSource());
+    QSignalSpy sendRequestedSpy(dataSource.get(),
+                                &Wrapland::Client::DataSource::sendDataRequested);
+    QVERIFY(sendRequestedSpy.isValid());
+    dataSource->offer(QStringLiteral("text/plain"));
+    m_client1.dataDevice->setSelection(keyboardEnteredSpy.first().first().value<quint32>(),
+                                       dataSource.get());
+    QVERIFY(selectionChangedSpy.wait());
+    QVERIFY(sendRequestedSpy.wait());
+
+    auto source_fd = sendRequestedSpy.first().last().value<qint32>();
+    QCOMPARE(write(source_fd, "fo", 2), 2);
+
+    // The source goes away before all data has been written.
+    selectionChangedSpy.clear();
+    dataSource.reset();
+    QVERIFY(selectionChangedSpy.wait());
+    QVERIFY(server.seat->selection());
+    QCOMPARE(server.seat->selection()->mime_types(), std::vector<std::string>{"text/plain"});
+
+    auto early_fd = receive_selection(server.seat, "text/plain");
+    QVERIFY(early_fd >= 0);
+
+    QCOMPARE(write(source_fd, "o", 1), 1);
+    close(source_fd);
+
+    QByteArray early_data;
+    QTRY_VERIFY(read_all(early_fd, early_data));
+    close(early_fd);
+    QCOMPARE(early_data, QByteArray("foo"));
+
+    auto kept_fd = receive_selection(server.seat, "text/plain");
+    QVERIFY(kept_fd >= 0);
+    QByteArray kept_data;
+    QTRY_VERIFY(read_all(kept_fd, kept_data));
+    close(kept_fd);
+    QCOMPARE(kept_data, QByteArray("foo"));
+}
+
 QTEST_GUILESS_MAIN(SelectionTest)
 #include "selection.moc"
@@ -0,0 +1,283 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/shm_pool.h"
+#include "../../src/client/single_pixel_buffer_v1.h"
+#include "../../src/client/surface.h"
+
+#include "../../server/buffer.h"
+#include "../../server/compositor.h"
+#include "../../server/display.h"
+#include "../../server/single_pixel_buffer_v1.h"
+#include "../../server/surface.h"
+
+#include "../../tests/globals.h"
+
+#include <limits>
+#include <wayland-client-protocol.h>
+
+using namespace Wrapland;
+
+class TestSinglePixelBuffer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestSinglePixelBuffer(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testSinglePixelBuffer_data();
+    void testSinglePixelBuffer();
+    void testShmSolidColor_data();
+    void testShmSolidColor();
+    void testShmNotUniform();
+    void testShmTooLarge();
+
+private:
+    Server::Surface* create_surface(std::unique_ptr<Client::Surface>& surface);
+    std::shared_ptr<Server::Buffer> commit_image(QImage const& image);
+
+    struct {
+        std::unique_ptr<Server::Display> display;
+        Server::globals globals;
+    } server;
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::Compositor* m_compositor{nullptr};
+    Client::ShmPool* m_shm{nullptr};
+    Client::single_pixel_buffer_manager_v1* m_single_pixel{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-single-pixel-buffer-0"};
+
+TestSinglePixelBuffer::TestSinglePixelBuffer(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<Server::Surface*>();
+}
+
+void TestSinglePixelBuffer::init()
+{
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.display->createShm();
+
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.single_pixel_buffer_manager_v1
+        = std::make_unique<Server::single_pixel_buffer_manager_v1>(server.display.get());
+
+    // Setup connection.
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy establishedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(establishedSpy.wait());
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+    QVERIFY(m_queue->isValid());
+
+    Client::Registry registry;
+    QSignalSpy allAnnounced(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(allAnnounced.isValid());
+
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection->display());
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(allAnnounced.wait());
+
+    auto const compositor = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor = registry.createCompositor(compositor.name, compositor.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    auto const shm = registry.interface(Client::Registry::Interface::Shm);
+    m_shm = registry.createShmPool(shm.name, shm.version, this);
+    QVERIFY(m_shm->isValid());
+
+    auto const single_pixel
+        = registry.interface(Client::Registry::Interface::SinglePixelBufferManagerV1);
+    QVERIFY(single_pixel.name != 0);
+    m_single_pixel = registry.createSinglePixelBufferManagerV1(
+        single_pixel.name, single_pixel.version, this);
+    QVERIFY(m_single_pixel->isValid());
+}
+
+void TestSinglePixelBuffer::cleanup()
+{
+    delete m_single_pixel;
+    m_single_pixel = nullptr;
+    delete m_shm;
+    m_shm = nullptr;
+    delete m_compositor;
+    m_compositor = nullptr;
+    delete m_queue;
+    m_queue = nullptr;
+
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+    delete m_connection;
+    m_connection = nullptr;
+
+    server = {};
+}
+
+Server::Surface* TestSinglePixelBuffer::create_surface(std::unique_ptr<Client::Surface>& surface)
+{
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    if (!surfaceCreatedSpy.isValid()) {
+        return nullptr;
+    }
+
+    surface.reset(m_compositor->createSurface());
+    if (!surfaceCreatedSpy.wait()) {
+        return nullptr;
+    }
+    return surfaceCreatedSpy.first().first().value<Server::Surface*>();
+}
+
+std::shared_ptr<Server::Buffer> TestSinglePixelBuffer::commit_image(QImage const& image)
+{
+    std::unique_ptr<Client::Surface> surface;
+    auto serverSurface = create_surface(surface);
+    if (!serverSurface) {
+        return nullptr;
+    }
+
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    surface->attachBuffer(m_shm->createBuffer(image));
+    surface->damage(QRect(QPoint(), image.size()));
+    surface->commit(Client::Surface::CommitFlag::None);
+    if (!committedSpy.wait()) {
+        return nullptr;
+    }
+    return serverSurface->state().buffer;
+}
+
+void TestSinglePixelBuffer::testSinglePixelBuffer_data()
+{
+    QTest::addColumn<uint32_t>("alpha");
+    QTest::addColumn<QColor>("color");
+
+    auto constexpr max = std::numeric_limits<uint32_t>::max();
+
+    QTest::newRow("opaque") << max << QColor(255, 0, 0, 255);
+    QTest::newRow("translucent") << max / 5 << QColor(255, 0, 0, 51);
+    QTest::newRow("transparent") << 0U << QColor(0, 0, 0, 0);
+}
+
+void TestSinglePixelBuffer::testSinglePixelBuffer()
+{
+    // A single pixel buffer is exposed with its unpremultiplied color.
+    QFETCH(uint32_t, alpha);
+    QFETCH(QColor, color);
+
+    std::unique_ptr<Client::Surface> surface;
+    auto serverSurface = create_surface(surface);
+    QVERIFY(serverSurface);
+
+    // Red is premultiplied with the alpha value.
+    auto buffer = m_single_pixel->create_u32_rgba_buffer(alpha, 0, 0, alpha);
+    QVERIFY(buffer);
+
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+    surface->attachBuffer(buffer);
+    surface->damage(QRect(0, 0, 1, 1));
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+
+    auto serverBuffer = serverSurface->state().buffer;
+    QVERIFY(serverBuffer);
+    QVERIFY(!serverBuffer->shmBuffer());
+    QCOMPARE(serverBuffer->size(), QSize(1, 1));
+    QCOMPARE(serverBuffer->hasAlphaChannel(), color.alpha() < 255);
+
+    auto solid_color = serverBuffer->solid_color();
+    QVERIFY(solid_color);
+    QCOMPARE(solid_color->rgba(), color.rgba());
+
+    surface.reset();
+    wl_buffer_destroy(buffer);
+}
+
+void TestSinglePixelBuffer::testShmSolidColor_data()
+{
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<QColor>("fill");
+    QTest::addColumn<QColor>("color");
+
+    QTest::newRow("argb opaque")
+        << QImage::Format_ARGB32_Premultiplied << QColor(Qt::blue) << QColor(Qt::blue);
+    QTest::newRow("argb translucent") << QImage::Format_ARGB32_Premultiplied
+                                      << QColor(0, 255, 0, 51) << QColor(0, 255, 0, 51);
+    QTest::newRow("xrgb") << QImage::Format_RGB32 << QColor(Qt::green) << QColor(Qt::green);
+}
+
+void TestSinglePixelBuffer::testShmSolidColor()
+{
+    // A small uniformly filled shm buffer is detected as a solid color.
+    QFETCH(QImage::Format, format);
+    QFETCH(QColor, fill);
+    QFETCH(QColor, color);
+
+    QImage image(QSize(16, 8), format);
+    image.fill(fill);
+
+    auto buffer = commit_image(image);
+    QVERIFY(buffer);
+    QVERIFY(buffer->shmBuffer());
+
+    auto solid_color = buffer->solid_color();
+    QVERIFY(solid_color);
+    QCOMPARE(solid_color->rgba(), color.rgba());
+}
+
+void TestSinglePixelBuffer::testShmNotUniform()
+{
+    QImage image(QSize(16, 8), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::red);
+    image.setPixel(15, 7, qRgba(255, 0, 0, 254));
+
+    auto buffer = commit_image(image);
+    QVERIFY(buffer);
+    QVERIFY(!buffer->solid_color());
+}
+
+void TestSinglePixelBuffer::testShmTooLarge()
+{
+    // Big buffers are not inspected even if uniform.
+    QImage image(QSize(128, 128), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::red);
+
+    auto buffer = commit_image(image);
+    QVERIFY(buffer);
+    QVERIFY(!buffer->solid_color());
+}
+
+QTEST_GUILESS_MAIN(TestSinglePixelBuffer)
+#include "single_pixel_buffer.moc"
@@ -55,6 +55,7 @@ private Q_SLOTS:
     void testStaticAccessor();
     void testDamage();
     void testFrameCallback();
+    void testFrameCallbackVisibility();
     void testAttachBuffer();
     void testMultipleSurfaces();
     void testOpaque();
@@ -68,6 +69,10 @@ private Q_SLOTS:
     void testDestroyWithPendingCallback();
     void testDisconnect();
     void testOutput();
+    void testPreferredBufferState();
+    void testPreferredBufferStateOutputChange();
+    void testOffset();
+    void testInvalidAttachOffset();
     void testInhibit();
 
 private:
@@ -376,6 +381,59 @@ void TestSurface::testFrameCallback()
     QVERIFY(!frameRenderedSpy.isEmpty());
 }
 
+void TestSurface::testFrameCallbackVisibility()
+{
+    QSignalSpy serverSurfaceCreated(server.globals.compositor.get(),
+                                    &Wrapland::Server::Compositor::surfaceCreated);
+    QVERIFY(serverSurfaceCreated.isValid());
+    std::unique_ptr<Wrapland::Client::Surface> s{m_compositor->createSurface()};
+    QVERIFY(serverSurfaceCreated.wait());
+    auto serverSurface = serverSurfaceCreated.first().first().value<Wrapland::Server::Surface*>();
+    QVERIFY(serverSurface);
+    QCOMPARE(serverSurface->visibility(), Wrapland::Server::surface_visibility::visible);
+    QCOMPARE(serverSurface->occluded_frame_interval(), std::chrono::milliseconds(1000));
+
+    QSignalSpy commit_spy(serverSurface, &Wrapland::Server::Surface::committed);
+    QVERIFY(commit_spy.isValid());
+    QSignalSpy frameRenderedSpy(s.get(), &Wrapland::Client::Surface::frameRendered);
+    QVERIFY(frameRenderedSpy.isValid());
+
+    QImage img(QSize(10, 10), QImage::Format_ARGB32_Premultiplied);
+    img.fill(Qt::black);
+    auto b = m_shm->createBuffer(img);
+
+    auto commit_frame = [&] {
+        s->attachBuffer(b);
+        s->damage(QRect(0, 0, 10, 10));
+        s->commit();
+        return commit_spy.wait();
+    };
+
+    // Hidden surfaces get no frame callbacks.
+    serverSurface->set_visibility(Wrapland::Server::surface_visibility::hidden);
+    QVERIFY(commit_frame());
+    serverSurface->frameRendered(10);
+    QVERIFY(!frameRenderedSpy.wait(100));
+
+    // The withheld callback is sent once the surface is visible again.
+    serverSurface->set_visibility(Wrapland::Server::surface_visibility::visible);
+    serverSurface->frameRendered(20);
+    QVERIFY(frameRenderedSpy.wait());
+    QCOMPARE(frameRenderedSpy.count(), 1);
+
+    // Occluded surfaces get frame callbacks only in the occluded interval.
+    serverSurface->set_visibility(Wrapland::Server::surface_visibility::occluded);
+    serverSurface->set_occluded_frame_interval(std::chrono::milliseconds(100));
+
+    QVERIFY(commit_frame());
+    serverSurface->frameRendered(50);
+    QVERIFY(!frameRenderedSpy.wait(100));
+
+    serverSurface->frameRendered(120);
+    QVERIFY(frameRenderedSpy.wait());
+    QCOMPARE(frameRenderedSpy.count(), 2);
+}
+
 void TestSurface::testAttachBuffer()
 {
     // create the surface
@@ -1182,6 +1240,190 @@ void TestSurface::testOutput()
     QCOMPARE(serverSurface->outputs().size(), 0);
 }
 
+void TestSurface::testPreferredBufferState()
+{
+    // This test verifies that preferred buffer scale and transform follow the outputs unless set.
+    std::unique_ptr<Wrapland::Client::Surface> s(m_compositor->createSurface());
+    QSignalSpy scaleSpy(s.get(), &Wrapland::Client::Surface::preferredBufferScaleChanged);
+    QVERIFY(scaleSpy.isValid());
+    QSignalSpy transformSpy(s.get(), &Wrapland::Client::Surface::preferredBufferTransformChanged);
+    QVERIFY(transformSpy.isValid());
+
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Wrapland::Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Wrapland::Server::Surface*>();
+    QVERIFY(serverSurface);
+    QCOMPARE(serverSurface->preferred_buffer_scale(), 1);
+    QCOMPARE(serverSurface->preferred_buffer_transform(),
+             Wrapland::Server::output_transform::normal);
+
+    auto serverOutput = std::make_unique<Wrapland::Server::output>(*server.globals.output_manager);
+    serverOutput->add_mode({.size = QSize{1920, 1080}, .id = 0});
+    auto state = serverOutput->get_state();
+    state.enabled = true;
+    state.geometry = QRectF(0, 0, 960, 540);
+    state.transform = Wrapland::Server::output_transform::rotated_90;
+    serverOutput->set_state(state);
+    serverOutput->done();
+
+    serverSurface->setOutputs(std::vector<Wrapland::Server::output*>{serverOutput.get()});
+    QCOMPARE(serverSurface->preferred_buffer_scale(), 2);
+    QCOMPARE(serverSurface->preferred_buffer_transform(),
+             Wrapland::Server::output_transform::rotated_90);
+
+    QVERIFY(transformSpy.wait());
+    QCOMPARE(scaleSpy.count(), 1);
+    QCOMPARE(transformSpy.count(), 1);
+    QCOMPARE(s->preferredBufferScale(), 2);
+    QCOMPARE(s->preferredBufferTransform(), Wrapland::Client::Output::Transform::Rotated90);
+
+    // An explicitly set value overrides the one of the outputs.
+    serverSurface->set_preferred_buffer_scale(3);
+    QVERIFY(scaleSpy.wait());
+    QCOMPARE(s->preferredBufferScale(), 3);
+
+    serverSurface->set_preferred_buffer_scale(std::nullopt);
+    QVERIFY(scaleSpy.wait());
+    QCOMPARE(s->preferredBufferScale(), 2);
+
+    serverSurface->set_preferred_buffer_transform(Wrapland::Server::output_transform::normal);
+    QVERIFY(transformSpy.wait());
+    QCOMPARE(s->preferredBufferTransform(), Wrapland::Client::Output::Transform::Normal);
+
+    // Without outputs the scale falls back to 1.
+    serverSurface->setOutputs(std::vector<Wrapland::Server::output*>());
+    QVERIFY(scaleSpy.wait());
+    QCOMPARE(s->preferredBufferScale(), 1);
+    QCOMPARE(scaleSpy.count(), 4);
+    QCOMPARE(transformSpy.count(), 2);
+}
+
+void TestSurface::testPreferredBufferStateOutputChange()
+{
+    // This test verifies that preferred buffer scale and transform follow changes of the outputs
+    // the surface is on.
+    std::unique_ptr<Wrapland::Client::Surface> s(m_compositor->createSurface());
+    QSignalSpy scaleSpy(s.get(), &Wrapland::Client::Surface::preferredBufferScaleChanged);
+    QVERIFY(scaleSpy.isValid());
+    QSignalSpy transformSpy(s.get(), &Wrapland::Client::Surface::preferredBufferTransformChanged);
+    QVERIFY(transformSpy.isValid());
+
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Wrapland::Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Wrapland::Server::Surface*>();
+    QVERIFY(serverSurface);
+
+    auto serverOutput = std::make_unique<Wrapland::Server::output>(*server.globals.output_manager);
+    serverOutput->add_mode({.size = QSize{1920, 1080}, .id = 0});
+    auto state = serverOutput->get_state();
+    state.enabled = true;
+    state.geometry = QRectF(0, 0, 1920, 1080);
+    serverOutput->set_state(state);
+    serverOutput->done();
+
+    serverSurface->setOutputs(std::vector<Wrapland::Server::output*>{serverOutput.get()});
+    QCOMPARE(serverSurface->preferred_buffer_scale(), 1);
+    QCOMPARE(serverSurface->preferred_buffer_transform(),
+             Wrapland::Server::output_transform::normal);
+
+    // The output is rotated.
+    state.transform = Wrapland::Server::output_transform::rotated_270;
+    serverOutput->set_state(state);
+    serverOutput->done();
+
+    QCOMPARE(serverSurface->preferred_buffer_transform(),
+             Wrapland::Server::output_transform::rotated_270);
+    QVERIFY(transformSpy.wait());
+    QCOMPARE(transformSpy.count(), 1);
+    QCOMPARE(s->preferredBufferTransform(), Wrapland::Client::Output::Transform::Rotated270);
+    QCOMPARE(scaleSpy.count(), 0);
+
+    // The client scale of the output changes.
+    state.geometry = QRectF(0, 0, 960, 540);
+    serverOutput->set_state(state);
+    serverOutput->done();
+
+    QCOMPARE(serverSurface->preferred_buffer_scale(), 2);
+    QVERIFY(scaleSpy.wait());
+    QCOMPARE(scaleSpy.count(), 1);
+    QCOMPARE(s->preferredBufferScale(), 2);
+
+    // Changes of outputs the surface left are ignored.
+    serverSurface->setOutputs(std::vector<Wrapland::Server::output*>());
+    QVERIFY(scaleSpy.wait());
+    QCOMPARE(s->preferredBufferScale(), 1);
+    QTRY_COMPARE(transformSpy.count(), 2);
+    QCOMPARE(s->preferredBufferTransform(), Wrapland::Client::Output::Transform::Normal);
+
+    state.transform = Wrapland::Server::output_transform::rotated_90;
+    serverOutput->set_state(state);
+    serverOutput->done();
+    QCOMPARE(serverSurface->preferred_buffer_transform(),
+             Wrapland::Server::output_transform::normal);
+    QVERIFY(!transformSpy.wait(100));
+    QCOMPARE(transformSpy.count(), 2);
+}
+
+void TestSurface::testOffset()
+{
+    // This test verifies that the offset is double-buffered and only applies to one commit.
+    std::unique_ptr<Wrapland::Client::Surface> s(m_compositor->createSurface());
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Wrapland::Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Wrapland::Server::Surface*>();
+    QVERIFY(serverSurface);
+
+    QSignalSpy committedSpy(serverSurface, &Wrapland::Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+
+    QImage img(QSize(10, 10), QImage::Format_ARGB32_Premultiplied);
+    img.fill(Qt::black);
+
+    // With version 5 and later the client sends the offset with wl_surface.offset.
+    s->attachBuffer(m_shm->createBuffer(img), QPoint(5, -3));
+    s->damage(QRect(0, 0, 10, 10));
+    s->commit(Wrapland::Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().offset, QPoint(5, -3));
+    QVERIFY(serverSurface->state().updates & Wrapland::Server::surface_change::offset);
+
+    s->commit(Wrapland::Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().offset, QPoint());
+    QVERIFY(!(serverSurface->state().updates & Wrapland::Server::surface_change::offset));
+
+    // The offset is independent of attaching a buffer.
+    wl_surface_offset(*s, 2, 4);
+    s->commit(Wrapland::Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().offset, QPoint(2, 4));
+    QVERIFY(!(serverSurface->state().updates & Wrapland::Server::surface_change::buffer));
+}
+
+void TestSurface::testInvalidAttachOffset()
+{
+    // This test verifies that a non-zero attach offset is a protocol error since version 5.
+    std::unique_ptr<Wrapland::Client::Surface> s(m_compositor->createSurface());
+
+    QImage img(QSize(10, 10), QImage::Format_ARGB32_Premultiplied);
+    img.fill(Qt::black);
+    auto buffer = m_shm->createBuffer(img);
+
+    QSignalSpy errorSpy(m_connection, &Wrapland::Client::ConnectionThread::establishedChanged);
+    QVERIFY(errorSpy.isValid());
+
+    wl_surface_attach(*s, *buffer.lock(), 1, 1);
+    s->commit(Wrapland::Client::Surface::CommitFlag::None);
+    QVERIFY(errorSpy.wait());
+    QVERIFY(m_connection->error());
+}
+
 void TestSurface::testInhibit()
 {
     std::unique_ptr<Wrapland::Client::Surface> s(m_compositor->createSurface());
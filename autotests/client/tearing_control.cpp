@@ -0,0 +1,194 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../src/client/compositor.h"
+#include "../../src/client/connection_thread.h"
+#include "../../src/client/event_queue.h"
+#include "../../src/client/registry.h"
+#include "../../src/client/surface.h"
+#include "../../src/client/tearing_control_v1.h"
+
+#include "../../server/compositor.h"
+#include "../../server/display.h"
+#include "../../server/surface.h"
+#include "../../server/tearing_control_v1.h"
+
+#include "../../tests/globals.h"
+
+#include <wayland-tearing-control-v1-client-protocol.h>
+
+using namespace Wrapland;
+
+class TestTearingControl : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TestTearingControl(QObject* parent = nullptr);
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testPresentationHint();
+
+private:
+    struct {
+        std::unique_ptr<Server::Display> display;
+        Server::globals globals;
+    } server;
+
+    Client::ConnectionThread* m_connection{nullptr};
+    Client::EventQueue* m_queue{nullptr};
+    Client::Compositor* m_compositor{nullptr};
+    Client::tearing_control_manager_v1* m_tearing_control{nullptr};
+    QThread* m_thread{nullptr};
+};
+
+constexpr auto socket_name{"wrapland-test-tearing-control-0"};
+
+TestTearingControl::TestTearingControl(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<Server::Surface*>();
+}
+
+void TestTearingControl::init()
+{
+    server.display = std::make_unique<Server::Display>();
+    server.display->set_socket_name(socket_name);
+    server.display->start();
+    QVERIFY(server.display->running());
+
+    server.globals.compositor = std::make_unique<Server::Compositor>(server.display.get());
+    server.globals.tearing_control_manager_v1
+        = std::make_unique<Server::tearing_control_manager_v1>(server.display.get());
+
+    // setup connection
+    m_connection = new Client::ConnectionThread;
+    QSignalSpy connectedSpy(m_connection, &Client::ConnectionThread::establishedChanged);
+    QVERIFY(connectedSpy.isValid());
+    m_connection->setSocketName(socket_name);
+
+    m_thread = new QThread(this);
+    m_connection->moveToThread(m_thread);
+    m_thread->start();
+
+    m_connection->establishConnection();
+    QVERIFY(connectedSpy.count() || connectedSpy.wait());
+    QCOMPARE(connectedSpy.count(), 1);
+
+    m_queue = new Client::EventQueue(this);
+    m_queue->setup(m_connection);
+
+    Client::Registry registry;
+    QSignalSpy interfacesAnnouncedSpy(&registry, &Client::Registry::interfacesAnnounced);
+    QVERIFY(interfacesAnnouncedSpy.isValid());
+    registry.setEventQueue(m_queue);
+    registry.create(m_connection);
+    QVERIFY(registry.isValid());
+    registry.setup();
+    QVERIFY(interfacesAnnouncedSpy.wait());
+
+    auto const compositor = registry.interface(Client::Registry::Interface::Compositor);
+    m_compositor = registry.createCompositor(compositor.name, compositor.version, this);
+    QVERIFY(m_compositor->isValid());
+
+    auto const tearing_control
+        = registry.interface(Client::Registry::Interface::TearingControlManagerV1);
+    QVERIFY(tearing_control.name != 0);
+    m_tearing_control = registry.createTearingControlManagerV1(
+        tearing_control.name, tearing_control.version, this);
+    QVERIFY(m_tearing_control->isValid());
+}
+
+void TestTearingControl::cleanup()
+{
+#define CLEANUP(variable)                                                                          \
+    if (variable) {                                                                                \
+        delete variable;                                                                           \
+        variable = nullptr;                                                                        \
+    }
+    CLEANUP(m_tearing_control)
+    CLEANUP(m_compositor)
+    CLEANUP(m_queue)
+    if (m_connection) {
+        m_connection->deleteLater();
+        m_connection = nullptr;
+    }
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_thread;
+        m_thread = nullptr;
+    }
+#undef CLEANUP
+
+    server = {};
+}
+
+void TestTearingControl::testPresentationHint()
+{
+    QSignalSpy surfaceCreatedSpy(server.globals.compositor.get(),
+                                 &Server::Compositor::surfaceCreated);
+    QVERIFY(surfaceCreatedSpy.isValid());
+
+    std::unique_ptr<Client::Surface> surface(m_compositor->createSurface());
+    QVERIFY(surfaceCreatedSpy.wait());
+    auto serverSurface = surfaceCreatedSpy.first().first().value<Server::Surface*>();
+    QVERIFY(serverSurface);
+    QCOMPARE(serverSurface->state().presentation_hint, Server::surface_presentation_hint::vsync);
+
+    QSignalSpy committedSpy(serverSurface, &Server::Surface::committed);
+    QVERIFY(committedSpy.isValid());
+
+    // The hint is applied with the next commit.
+    auto control = m_tearing_control->get_tearing_control(surface.get());
+    wp_tearing_control_v1_set_presentation_hint(control,
+                                                WP_TEARING_CONTROL_V1_PRESENTATION_HINT_ASYNC);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+
+    QCOMPARE(serverSurface->state().presentation_hint, Server::surface_presentation_hint::async);
+    QVERIFY(serverSurface->state().updates & Server::surface_change::presentation_hint);
+
+    // Without a new hint the state is kept.
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().presentation_hint, Server::surface_presentation_hint::async);
+    QVERIFY(!(serverSurface->state().updates & Server::surface_change::presentation_hint));
+
+    wp_tearing_control_v1_set_presentation_hint(control,
+                                                WP_TEARING_CONTROL_V1_PRESENTATION_HINT_VSYNC);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().presentation_hint, Server::surface_presentation_hint::vsync);
+
+    wp_tearing_control_v1_set_presentation_hint(control,
+                                                WP_TEARING_CONTROL_V1_PRESENTATION_HINT_ASYNC);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().presentation_hint, Server::surface_presentation_hint::async);
+
+    // Destroying the object goes back to vsync.
+    wp_tearing_control_v1_destroy(control);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().presentation_hint, Server::surface_presentation_hint::vsync);
+
+    // The surface accepts a new tearing control object afterwards.
+    control = m_tearing_control->get_tearing_control(surface.get());
+    wp_tearing_control_v1_set_presentation_hint(control,
+                                                WP_TEARING_CONTROL_V1_PRESENTATION_HINT_ASYNC);
+    surface->commit(Client::Surface::CommitFlag::None);
+    QVERIFY(committedSpy.wait());
+    QCOMPARE(serverSurface->state().presentation_hint, Server::surface_presentation_hint::async);
+    QVERIFY(!m_connection->error());
+
+    wp_tearing_control_v1_destroy(control);
+}
+
+QTEST_GUILESS_MAIN(TestTearingControl)
+#include "tearing_control.moc"
@@ -62,6 +62,7 @@ private Q_SLOTS:
     void testDataError();
     void testBufferSizeChange();
     void testDestinationSizeChange();
+    void testBufferDamage();
     void testNoSurface();
 
 private:
@@ -695,6 +696,70 @@ void TestViewporter::testDestinationSizeChange()
     // TODO: compare protocol error code
 }
 
+void TestViewporter::testBufferDamage()
+{
+    // This test verifies that buffer damage is mapped through the viewport to surface coordinates.
+
+    // Create surface.
+    QSignalSpy serverSurfaceCreated(server.globals.compositor.get(),
+                                    &Srv::Compositor::surfaceCreated);
+    QVERIFY(serverSurfaceCreated.isValid());
+    std::unique_ptr<Clt::Surface> s(m_compositor->createSurface());
+
+    QVERIFY(serverSurfaceCreated.wait());
+    Srv::Surface* serverSurface = serverSurfaceCreated.first().first().value<Srv::Surface*>();
+    QVERIFY(serverSurface);
+
+    // Create viewport.
+    QSignalSpy serverViewportCreated(server.globals.viewporter.get(),
+                                     &Srv::Viewporter::viewportCreated);
+    QVERIFY(serverViewportCreated.isValid());
+    std::unique_ptr<Clt::Viewport> vp(m_viewporter->createViewport(s.get(), this));
+
+    QVERIFY(serverViewportCreated.wait());
+
+    // Attach a buffer rendered at scale 1.5 for a logical size of 400x200.
+    QSignalSpy commit_spy(serverSurface, &Srv::Surface::committed);
+    QVERIFY(commit_spy.isValid());
+    QImage image(QSize(600, 300), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::red);
+    s->attachBuffer(m_shm->createBuffer(image));
+    s->damageBuffer(QRect(0, 0, 600, 300));
+    vp->setDestinationSize(QSize(400, 200));
+    s->commit(Clt::Surface::CommitFlag::None);
+
+    QVERIFY(commit_spy.wait());
+    QCOMPARE(serverSurface->size(), QSize(400, 200));
+    QCOMPARE(serverSurface->state().damage, QRegion(0, 0, 400, 200));
+
+    // Partial buffer damage is scaled down as well.
+    image.fill(Qt::green);
+    s->attachBuffer(m_shm->createBuffer(image));
+    s->damageBuffer(QRect(150, 60, 300, 90));
+    s->commit(Clt::Surface::CommitFlag::None);
+
+    QVERIFY(commit_spy.wait());
+    QCOMPARE(serverSurface->state().damage, QRegion(100, 40, 200, 60));
+
+    // With a source rectangle the damage is relative to it and clipped to the surface.
+    image.fill(Qt::blue);
+    s->attachBuffer(m_shm->createBuffer(image));
+    s->damageBuffer(QRect(0, 0, 600, 300));
+    vp->setSourceRectangle(QRectF(QPointF(300, 150), QSizeF(300, 150)));
+    s->commit(Clt::Surface::CommitFlag::None);
+
+    QVERIFY(commit_spy.wait());
+    QCOMPARE(serverSurface->state().damage, QRegion(0, 0, 400, 200));
+
+    image.fill(Qt::red);
+    s->attachBuffer(m_shm->createBuffer(image));
+    s->damageBuffer(QRect(450, 225, 150, 75));
+    s->commit(Clt::Surface::CommitFlag::None);
+
+    QVERIFY(commit_spy.wait());
+    QCOMPARE(serverSurface->state().damage, QRegion(200, 100, 200, 100));
+}
+
 void TestViewporter::testNoSurface()
 {
     // This test verifies that setting the viewport for a surface twice results in a protocol error.
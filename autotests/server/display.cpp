@@ -25,6 +25,9 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "../../server/output_manager.h"
 #include "../../server/wl_output.h"
 
+#include <array>
+#include <chrono>
+#include <fcntl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -39,8 +42,12 @@ private Q_SLOTS:
     void testStartStop();
     void testAddRemoveOutput();
     void testClientConnection();
+    void testClientLookup();
     void testConnectNoSocket();
     void testAutoSocketName();
+    void testClientHangDetection_data();
+    void testClientHangDetection();
+    void testClientHangSlowReader();
 };
 
 void TestServerDisplay::init()
@@ -202,6 +209,49 @@ void TestServerDisplay::testClientConnection()
     QVERIFY(display.clients().empty());
 }
 
+void TestServerDisplay::testClientLookup()
+{
+    // Each client is found through its native wl_client.
+    Wrapland::Server::Display display;
+    display.set_socket_name(std::string("kwin-wayland-server-display-test-client-lookup"));
+    display.start();
+
+    constexpr size_t client_count{10};
+    std::vector<std::array<int, 2>> sockets(client_count);
+    std::vector<Wrapland::Server::Client*> clients;
+
+    for (auto& sv : sockets) {
+        QVERIFY(socketpair(AF_UNIX, SOCK_STREAM, 0, sv.data()) >= 0);
+        clients.push_back(display.createClient(sv[0]));
+        QVERIFY(clients.back());
+    }
+    QCOMPARE(display.clients().size(), client_count);
+
+    for (auto client : clients) {
+        QCOMPARE(display.getClient(client->native()), client);
+    }
+
+    // A client is not found anymore once it is destroyed.
+    auto const wlClient = clients.front()->native();
+    QSignalSpy disconnectedSpy(&display, &Wrapland::Server::Display::clientDisconnected);
+    QVERIFY(disconnectedSpy.isValid());
+
+    wl_client_destroy(wlClient);
+    QCOMPARE(disconnectedSpy.count(), 1);
+    QCOMPARE(display.clients().size(), client_count - 1);
+    QCOMPARE(display.getClient(clients.back()->native()), clients.back());
+
+    for (auto it = clients.begin() + 1; it != clients.end(); it++) {
+        (*it)->destroy();
+    }
+    QVERIFY(display.clients().empty());
+
+    for (auto& sv : sockets) {
+        close(sv[0]);
+        close(sv[1]);
+    }
+}
+
 void TestServerDisplay::testConnectNoSocket()
 {
     Wrapland::Server::Display display;
@@ -236,5 +286,117 @@ void TestServerDisplay::testAutoSocketName()
     QCOMPARE(display1.socket_name(), std::string("wayland-1"));
 }
 
+void TestServerDisplay::testClientHangDetection_data()
+{
+    QTest::addColumn<size_t>("max_queued_socket_bytes");
+    QTest::addColumn<int>("max_stall");
+    QTest::addColumn<int>("events");
+
+    QTest::newRow("queued-socket-bytes") << static_cast<size_t>(4096) << 0 << 1000;
+    QTest::newRow("stall") << static_cast<size_t>(0) << 100 << 10;
+}
+
+void TestServerDisplay::testClientHangDetection()
+{
+    Wrapland::Server::Display display;
+    display.start();
+    QVERIFY(display.running());
+
+    std::array<int, 2> sv{};
+    QVERIFY(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv.data()) >= 0);
+    fcntl(sv[1], F_SETFL, fcntl(sv[1], F_GETFL) | O_NONBLOCK);
+    auto client = display.createClient(sv[0]);
+    QVERIFY(client);
+
+    QFETCH(size_t, max_queued_socket_bytes);
+    QFETCH(int, max_stall);
+    QFETCH(int, events);
+
+    Wrapland::Server::client_hang_detection config;
+    config.max_queued_socket_bytes = max_queued_socket_bytes;
+    config.max_stall = std::chrono::milliseconds(max_stall);
+    client->set_hang_detection(config);
+    QCOMPARE(client->hang_detection().max_queued_socket_bytes, max_queued_socket_bytes);
+    QVERIFY(!client->hung());
+
+    QSignalSpy hung_spy(client, &Wrapland::Server::Client::hung_changed);
+    QVERIFY(hung_spy.isValid());
+
+    // The client never reads. Batches stay below what libwayland buffers on its own.
+    auto display_resource = wl_client_get_object(client->native(), 1);
+    QVERIFY(display_resource);
+    for (int i = 0; i < events; i++) {
+        wl_resource_post_event(display_resource, WL_DISPLAY_DELETE_ID, 1000 + i);
+        if (i % 100 == 0) {
+            display.flush();
+        }
+    }
+    display.flush();
+    QVERIFY(client->queued_socket_bytes() > 0);
+
+    QVERIFY(hung_spy.wait());
+    QVERIFY(client->hung());
+    QCOMPARE(hung_spy.last().first().toBool(), true);
+    QVERIFY(client->stall_time().count() > 0);
+
+    // Once the client reads everything it recovers.
+    std::array<char, 4096> buffer{};
+    while (read(sv[1], buffer.data(), buffer.size()) > 0) { }
+    QCOMPARE(client->queued_socket_bytes(), static_cast<size_t>(0));
+
+    QVERIFY(hung_spy.wait());
+    QVERIFY(!client->hung());
+    QCOMPARE(hung_spy.last().first().toBool(), false);
+    QCOMPARE(client->stall_time().count(), 0);
+
+    wl_client_destroy(client->native());
+    close(sv[1]);
+}
+
+void TestServerDisplay::testClientHangSlowReader()
+{
+    // A client reading steadily, but slower than the compositor writes, is not hung.
+    Wrapland::Server::Display display;
+    display.start();
+    QVERIFY(display.running());
+
+    std::array<int, 2> sv{};
+    QVERIFY(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv.data()) >= 0);
+    fcntl(sv[1], F_SETFL, fcntl(sv[1], F_GETFL) | O_NONBLOCK);
+    auto client = display.createClient(sv[0]);
+    QVERIFY(client);
+
+    Wrapland::Server::client_hang_detection config;
+    config.max_stall = std::chrono::milliseconds(200);
+    client->set_hang_detection(config);
+
+    QSignalSpy hung_spy(client, &Wrapland::Server::Client::hung_changed);
+    QVERIFY(hung_spy.isValid());
+
+    auto display_resource = wl_client_get_object(client->native(), 1);
+    QVERIFY(display_resource);
+
+    // Each round the client reads half of what was sent to it.
+    std::array<char, 4096> buffer{};
+    auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(800);
+    uint32_t id{1000};
+
+    while (std::chrono::steady_clock::now() < end) {
+        for (int i = 0; i < 20; i++) {
+            wl_resource_post_event(display_resource, WL_DISPLAY_DELETE_ID, id++);
+        }
+        display.flush();
+        QVERIFY(read(sv[1], buffer.data(), 120) > 0);
+        QTest::qWait(20);
+    }
+
+    QVERIFY(client->queued_socket_bytes() > 0);
+    QVERIFY(!client->hung());
+    QVERIFY(hung_spy.empty());
+
+    wl_client_destroy(client->native());
+    close(sv[1]);
+}
+
 QTEST_GUILESS_MAIN(TestServerDisplay)
 #include "display.moc"
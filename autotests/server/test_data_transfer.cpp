@@ -0,0 +1,146 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../server/data_transfer.h"
+#include "../../server/display.h"
+
+#include <algorithm>
+#include <array>
+#include <fcntl.h>
+#include <unistd.h>
+
+class TestDataTransfer : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testTransfer();
+    void testTimeout();
+    void testReceiverClosed();
+
+private:
+    std::unique_ptr<Wrapland::Server::Display> display;
+    std::array<int, 2> source_pipe{-1, -1};
+    std::array<int, 2> receiver_pipe{-1, -1};
+};
+
+constexpr auto socket_name{"wrapland-server-data-transfer-test-0"};
+
+void TestDataTransfer::init()
+{
+    display = std::make_unique<Wrapland::Server::Display>();
+    display->set_socket_name(socket_name);
+    display->start();
+    QVERIFY(display->running());
+
+    QCOMPARE(pipe2(source_pipe.data(), O_CLOEXEC | O_NONBLOCK), 0);
+    QCOMPARE(pipe2(receiver_pipe.data(), O_CLOEXEC | O_NONBLOCK), 0);
+}
+
+void TestDataTransfer::cleanup()
+{
+    // The read end of the source and the write end of the receiver belong to the transfer.
+    for (auto fd : {source_pipe[1], receiver_pipe[0]}) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    source_pipe = {-1, -1};
+    receiver_pipe = {-1, -1};
+    display.reset();
+}
+
+void TestDataTransfer::testTransfer()
+{
+    Wrapland::Server::data_transfer transfer(display.get(), source_pipe[0], receiver_pipe[1]);
+    QVERIFY(transfer.running());
+
+    QSignalSpy progressed_spy(&transfer, &Wrapland::Server::data_transfer::progressed);
+    QVERIFY(progressed_spy.isValid());
+    QSignalSpy finished_spy(&transfer, &Wrapland::Server::data_transfer::finished);
+    QVERIFY(finished_spy.isValid());
+    QSignalSpy failed_spy(&transfer, &Wrapland::Server::data_transfer::failed);
+    QVERIFY(failed_spy.isValid());
+
+    // More than fits into a pipe at once.
+    QByteArray data(1024 * 1024, '\0');
+    for (int i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i % 251);
+    }
+
+    qsizetype written{0};
+    QByteArray received;
+
+    auto step = [&] {
+        if (written < data.size()) {
+            auto const size = std::min<qsizetype>(data.size() - written, 65536);
+            auto const count = write(source_pipe[1], data.constData() + written, size);
+            if (count > 0) {
+                written += count;
+            }
+            if (written == data.size()) {
+                close(source_pipe[1]);
+                source_pipe[1] = -1;
+            }
+        }
+
+        std::array<char, 65536> buffer{};
+        ssize_t count{0};
+        while ((count = read(receiver_pipe[0], buffer.data(), buffer.size())) > 0) {
+            received.append(buffer.data(), count);
+        }
+        return count == 0;
+    };
+
+    QTRY_VERIFY_WITH_TIMEOUT(step(), 10000);
+
+    QCOMPARE(received, data);
+    QCOMPARE(finished_spy.count(), 1);
+    QVERIFY(failed_spy.empty());
+    QVERIFY(!transfer.running());
+    QCOMPARE(transfer.transferred(), static_cast<size_t>(data.size()));
+
+    QVERIFY(!progressed_spy.empty());
+    QCOMPARE(progressed_spy.last().first().value<size_t>(), static_cast<size_t>(data.size()));
+}
+
+void TestDataTransfer::testTimeout()
+{
+    Wrapland::Server::data_transfer transfer(
+        display.get(), source_pipe[0], receiver_pipe[1], std::chrono::milliseconds(100));
+
+    QSignalSpy timed_out_spy(&transfer, &Wrapland::Server::data_transfer::timed_out);
+    QVERIFY(timed_out_spy.isValid());
+
+    // The source never writes anything.
+    QVERIFY(timed_out_spy.wait());
+    QVERIFY(!transfer.running());
+    QCOMPARE(transfer.transferred(), static_cast<size_t>(0));
+}
+
+void TestDataTransfer::testReceiverClosed()
+{
+    Wrapland::Server::data_transfer transfer(display.get(), source_pipe[0], receiver_pipe[1]);
+
+    QSignalSpy failed_spy(&transfer, &Wrapland::Server::data_transfer::failed);
+    QVERIFY(failed_spy.isValid());
+    QSignalSpy finished_spy(&transfer, &Wrapland::Server::data_transfer::finished);
+    QVERIFY(finished_spy.isValid());
+
+    close(receiver_pipe[0]);
+    receiver_pipe[0] = -1;
+    QCOMPARE(write(source_pipe[1], "foo", 3), 3);
+
+    QVERIFY(failed_spy.wait());
+    QVERIFY(finished_spy.empty());
+    QVERIFY(!transfer.running());
+}
+
+QTEST_GUILESS_MAIN(TestDataTransfer)
+#include "test_data_transfer.moc"
@@ -0,0 +1,186 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include <QtTest>
+
+#include "../../server/display.h"
+#include "../../server/event_loop.h"
+
+#include <array>
+#include <fcntl.h>
+#include <unistd.h>
+
+class TestEventLoop : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testFdNotifier();
+    void testTimer();
+    void testWriteFd();
+    void testReadFd();
+    void testReadFdMaxSize();
+    void testReadFdContextDestroyed();
+
+private:
+    std::unique_ptr<Wrapland::Server::Display> display;
+    std::array<int, 2> pipe_fds{-1, -1};
+};
+
+constexpr auto socket_name{"wrapland-server-event-loop-test-0"};
+
+void TestEventLoop::init()
+{
+    display = std::make_unique<Wrapland::Server::Display>();
+    display->set_socket_name(socket_name);
+    display->start();
+    QVERIFY(display->running());
+
+    QCOMPARE(pipe2(pipe_fds.data(), O_CLOEXEC | O_NONBLOCK), 0);
+}
+
+void TestEventLoop::cleanup()
+{
+    for (auto fd : pipe_fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    pipe_fds = {-1, -1};
+    display.reset();
+}
+
+void TestEventLoop::testFdNotifier()
+{
+    using Wrapland::Server::fd_event;
+    using Wrapland::Server::fd_events;
+
+    std::vector<fd_events> received;
+    Wrapland::Server::fd_notifier notifier(
+        display.get(), pipe_fds[0], fd_event::readable, [&](auto events) {
+            received.push_back(events);
+            std::array<char, 16> buffer{};
+            while (read(pipe_fds[0], buffer.data(), buffer.size()) > 0) { }
+        });
+    QVERIFY(notifier.valid());
+    QCOMPARE(notifier.fd(), pipe_fds[0]);
+
+    QCOMPARE(write(pipe_fds[1], "foo", 3), 3);
+    QTRY_COMPARE(received.size(), static_cast<size_t>(1));
+    QVERIFY(received.back().testFlag(fd_event::readable));
+
+    // Not polled for data anymore, but the hang-up is reported.
+    notifier.set_events(fd_event::none);
+    QCOMPARE(write(pipe_fds[1], "bar", 3), 3);
+    close(pipe_fds[1]);
+    pipe_fds[1] = -1;
+
+    QTRY_VERIFY(received.size() >= 2);
+    QVERIFY(received.at(1).testFlag(fd_event::hangup));
+    QVERIFY(!received.at(1).testFlag(fd_event::readable));
+}
+
+void TestEventLoop::testTimer()
+{
+    int count{0};
+    Wrapland::Server::event_timer timer(display.get(), [&] { count++; });
+    QVERIFY(!timer.active());
+
+    timer.start(std::chrono::milliseconds(10));
+    QVERIFY(timer.active());
+    QTRY_COMPARE(count, 1);
+    QVERIFY(!timer.active());
+
+    // Single-shot.
+    QTest::qWait(50);
+    QCOMPARE(count, 1);
+
+    timer.start(std::chrono::milliseconds(10));
+    timer.stop();
+    QVERIFY(!timer.active());
+    QTest::qWait(50);
+    QCOMPARE(count, 1);
+}
+
+void TestEventLoop::testWriteFd()
+{
+    // More than fits into a pipe at once.
+    QByteArray data(1024 * 1024, 'x');
+    display->write_fd(pipe_fds[1], data);
+    pipe_fds[1] = -1;
+
+    QByteArray received;
+    auto receive = [&] {
+        std::array<char, 65536> buffer{};
+        ssize_t count{0};
+        while ((count = read(pipe_fds[0], buffer.data(), buffer.size())) > 0) {
+            received.append(buffer.data(), count);
+        }
+        return count == 0;
+    };
+
+    QTRY_VERIFY_WITH_TIMEOUT(receive(), 10000);
+    QCOMPARE(received, data);
+}
+
+void TestEventLoop::testReadFd()
+{
+    std::optional<QByteArray> result;
+    bool called{false};
+
+    display->read_fd(pipe_fds[0], 1024, nullptr, [&](auto data) {
+        called = true;
+        result = std::move(data);
+    });
+    pipe_fds[0] = -1;
+    QVERIFY(!called);
+
+    QCOMPARE(write(pipe_fds[1], "foo", 3), 3);
+    QCOMPARE(write(pipe_fds[1], "bar", 3), 3);
+    close(pipe_fds[1]);
+    pipe_fds[1] = -1;
+
+    QTRY_VERIFY(called);
+    QVERIFY(result);
+    QCOMPARE(*result, QByteArray("foobar"));
+}
+
+void TestEventLoop::testReadFdMaxSize()
+{
+    std::optional<QByteArray> result;
+    bool called{false};
+
+    display->read_fd(pipe_fds[0], 4, nullptr, [&](auto data) {
+        called = true;
+        result = std::move(data);
+    });
+    pipe_fds[0] = -1;
+
+    QCOMPARE(write(pipe_fds[1], "foobar", 6), 6);
+
+    QTRY_VERIFY(called);
+    QVERIFY(!result);
+}
+
+void TestEventLoop::testReadFdContextDestroyed()
+{
+    bool called{false};
+    auto context = std::make_unique<QObject>();
+
+    display->read_fd(pipe_fds[0], 1024, context.get(), [&](auto /*data*/) { called = true; });
+    pipe_fds[0] = -1;
+
+    context.reset();
+    close(pipe_fds[1]);
+    pipe_fds[1] = -1;
+
+    QTest::qWait(50);
+    QVERIFY(!called);
+}
+
+QTEST_GUILESS_MAIN(TestEventLoop)
+#include "test_event_loop.moc"
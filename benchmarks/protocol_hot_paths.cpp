@@ -0,0 +1,833 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "../src/client/compositor.h"
+#include "../src/client/connection_thread.h"
+#include "../src/client/event_queue.h"
+#include "../src/client/keyboard.h"
+#include "../src/client/plasmawindowmanagement.h"
+#include "../src/client/pointer.h"
+#include "../src/client/registry.h"
+#include "../src/client/seat.h"
+#include "../src/client/shm_pool.h"
+#include "../src/client/surface.h"
+
+#include "../server/blur.h"
+#include "../server/compositor.h"
+#include "../server/contrast.h"
+#include "../server/data_device_manager.h"
+#include "../server/display.h"
+#include "../server/filtered_display.h"
+#include "../server/idle_inhibit_v1.h"
+#include "../server/keyboard_pool.h"
+#include "../server/layer_shell_v1.h"
+#include "../server/plasma_shell.h"
+#include "../server/plasma_window.h"
+#include "../server/pointer_constraints_v1.h"
+#include "../server/pointer_gestures_v1.h"
+#include "../server/pointer_pool.h"
+#include "../server/presentation_time.h"
+#include "../server/relative_pointer_v1.h"
+#include "../server/seat.h"
+#include "../server/shadow.h"
+#include "../server/slide.h"
+#include "../server/subcompositor.h"
+#include "../server/surface.h"
+#include "../server/viewporter.h"
+#include "../server/xdg_shell.h"
+
+#include "wrapland_version.h"
+
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QDeadlineTimer>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QGuiApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+#include <QTimer>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include <wayland-client.h>
+
+namespace Clt = Wrapland::Client;
+namespace Srv = Wrapland::Server;
+
+namespace
+{
+
+constexpr auto socket_name{"wrapland-benchmark-protocol-0"};
+constexpr int wait_timeout{30000};
+constexpr int default_iterations{10000};
+constexpr int default_clients{8};
+constexpr int default_registry_clients{300};
+
+// Linux input event code of the A key. We do not require linux/input.h for the benchmark.
+constexpr uint32_t key_code_a{30};
+
+/**
+ * Processes events of the calling thread until @arg condition holds or the timeout expires.
+ */
+bool wait_for(std::function<bool()> const& condition, int timeout = wait_timeout)
+{
+    // Wake up periodically so we do not block indefinitely when no more events are coming in.
+    QTimer wakeup;
+    wakeup.start(10);
+
+    QDeadlineTimer deadline(timeout);
+    while (!condition()) {
+        if (deadline.hasExpired()) {
+            return false;
+        }
+        QCoreApplication::processEvents(QEventLoop::AllEvents | QEventLoop::WaitForMoreEvents);
+    }
+    return true;
+}
+
+template<auto bind>
+void* bind_proxy(Clt::Registry const& registry, uint32_t name, uint32_t version)
+{
+    return (registry.*bind)(name, version);
+}
+
+using bind_func = void* (*)(Clt::Registry const&, uint32_t, uint32_t);
+using Interface = Clt::Registry::Interface;
+
+std::vector<std::pair<Interface, bind_func>> const binders{
+    {Interface::Compositor, &bind_proxy<&Clt::Registry::bindCompositor>},
+    {Interface::SubCompositor, &bind_proxy<&Clt::Registry::bindSubCompositor>},
+    {Interface::Shm, &bind_proxy<&Clt::Registry::bindShm>},
+    {Interface::Seat, &bind_proxy<&Clt::Registry::bindSeat>},
+    {Interface::DataDeviceManager, &bind_proxy<&Clt::Registry::bindDataDeviceManager>},
+    {Interface::XdgShell, &bind_proxy<&Clt::Registry::bindXdgShell>},
+    {Interface::Viewporter, &bind_proxy<&Clt::Registry::bindViewporter>},
+    {Interface::PresentationManager, &bind_proxy<&Clt::Registry::bindPresentationManager>},
+    {Interface::Shadow, &bind_proxy<&Clt::Registry::bindShadowManager>},
+    {Interface::Blur, &bind_proxy<&Clt::Registry::bindBlurManager>},
+    {Interface::Contrast, &bind_proxy<&Clt::Registry::bindContrastManager>},
+    {Interface::Slide, &bind_proxy<&Clt::Registry::bindSlideManager>},
+    {Interface::RelativePointerManagerUnstableV1,
+     &bind_proxy<&Clt::Registry::bindRelativePointerManagerUnstableV1>},
+    {Interface::PointerGesturesUnstableV1,
+     &bind_proxy<&Clt::Registry::bindPointerGesturesUnstableV1>},
+    {Interface::PointerConstraintsUnstableV1,
+     &bind_proxy<&Clt::Registry::bindPointerConstraintsUnstableV1>},
+    {Interface::IdleInhibitManagerUnstableV1,
+     &bind_proxy<&Clt::Registry::bindIdleInhibitManagerUnstableV1>},
+    {Interface::LayerShellV1, &bind_proxy<&Clt::Registry::bindLayerShellV1>},
+    {Interface::PlasmaShell, &bind_proxy<&Clt::Registry::bindPlasmaShell>},
+    {Interface::PlasmaWindowManagement, &bind_proxy<&Clt::Registry::bindPlasmaWindowManagement>},
+};
+
+/**
+ * Binds all globals of @arg binders that @arg registry announced. Returns the bound proxies.
+ */
+std::vector<void*> bind_all(Clt::Registry const& registry)
+{
+    std::vector<void*> proxies;
+    for (auto const& [interface, bind] : binders) {
+        auto const announced_interface = registry.interface(interface);
+        if (!announced_interface.name) {
+            continue;
+        }
+        proxies.push_back(bind(registry, announced_interface.name, 1));
+    }
+    return proxies;
+}
+
+/**
+ * Shows all globals to all clients. Announcing and binding globals still goes through the filter.
+ */
+class filtered_display : public Srv::FilteredDisplay
+{
+public:
+    bool allowInterface(Srv::Client* /*client*/, QByteArray const& /*interfaceName*/) override
+    {
+        return true;
+    }
+};
+
+/**
+ * A Wrapland::Client connection running in its own thread with the basic globals bound.
+ */
+class client_connection
+{
+public:
+    client_connection()
+        : connection{new Clt::ConnectionThread}
+        , thread{new QThread}
+    {
+        connection->setSocketName(socket_name);
+        connection->moveToThread(thread);
+        thread->start();
+    }
+
+    client_connection(client_connection const&) = delete;
+    client_connection& operator=(client_connection const&) = delete;
+    client_connection(client_connection&&) noexcept = delete;
+    client_connection& operator=(client_connection&&) noexcept = delete;
+
+    ~client_connection()
+    {
+        seat.reset();
+        shm.reset();
+        compositor.reset();
+        registry.reset();
+        queue.reset();
+
+        thread->quit();
+        thread->wait();
+        delete thread;
+        delete connection;
+    }
+
+    /**
+     * Connects to the server and sets up the event queue without creating a registry.
+     */
+    bool connect()
+    {
+        QObject context;
+
+        bool established{false};
+        QObject::connect(connection,
+                         &Clt::ConnectionThread::establishedChanged,
+                         &context,
+                         [&established](bool est) { established = est; });
+        connection->establishConnection();
+        if (!wait_for([&established] { return established; })) {
+            return false;
+        }
+
+        queue = std::make_unique<Clt::EventQueue>();
+        queue->setup(connection);
+        return true;
+    }
+
+    bool establish()
+    {
+        if (!connect()) {
+            return false;
+        }
+
+        // Temporary connections are bound to this context and released when leaving the scope.
+        QObject context;
+
+        registry = std::make_unique<Clt::Registry>();
+        registry->setEventQueue(queue.get());
+
+        bool announced{false};
+        QObject::connect(registry.get(),
+                         &Clt::Registry::interfacesAnnounced,
+                         &context,
+                         [&announced] { announced = true; });
+        registry->create(connection->display());
+        registry->setup();
+        if (!wait_for([&announced] { return announced; })) {
+            return false;
+        }
+
+        auto const comp = registry->interface(Interface::Compositor);
+        compositor.reset(registry->createCompositor(comp.name, comp.version));
+
+        auto const shm_iface = registry->interface(Interface::Shm);
+        shm.reset(registry->createShmPool(shm_iface.name, shm_iface.version));
+
+        if (auto const seat_iface = registry->interface(Interface::Seat); seat_iface.name) {
+            seat.reset(registry->createSeat(seat_iface.name, seat_iface.version));
+        }
+
+        return compositor->isValid() && shm->isValid();
+    }
+
+    Clt::ConnectionThread* connection;
+    QThread* thread;
+
+    std::unique_ptr<Clt::EventQueue> queue;
+    std::unique_ptr<Clt::Registry> registry;
+    std::unique_ptr<Clt::Compositor> compositor;
+    std::unique_ptr<Clt::ShmPool> shm;
+    std::unique_ptr<Clt::Seat> seat;
+};
+
+struct benchmark_result {
+    QString name;
+    int iterations;
+    qint64 nsecs;
+    QJsonObject parameters;
+
+    QJsonObject to_json() const
+    {
+        auto const per_iteration = iterations ? static_cast<double>(nsecs) / iterations : 0.;
+        auto const per_second = nsecs ? iterations * 1e9 / static_cast<double>(nsecs) : 0.;
+
+        return QJsonObject{
+            {QStringLiteral("name"), name},
+            {QStringLiteral("iterations"), iterations},
+            {QStringLiteral("total_ns"), nsecs},
+            {QStringLiteral("ns_per_iteration"), per_iteration},
+            {QStringLiteral("iterations_per_second"), per_second},
+            {QStringLiteral("parameters"), parameters},
+        };
+    }
+};
+
+class benchmark_runner
+{
+public:
+    benchmark_runner(int iterations, int clients, int registry_clients)
+        : iterations{iterations}
+        , clients{clients}
+        , registry_clients{registry_clients}
+    {
+    }
+
+    bool setup()
+    {
+        server.display = std::make_unique<filtered_display>();
+        server.display->set_socket_name(socket_name);
+        server.display->start();
+        if (!server.display->running()) {
+            return false;
+        }
+        server.display->createShm();
+
+        server.compositor = std::make_unique<Srv::Compositor>(server.display.get());
+        server.seat = std::make_unique<Srv::Seat>(server.display.get());
+        server.seat->setName("seat0");
+        server.plasma_window_manager
+            = std::make_unique<Srv::PlasmaWindowManager>(server.display.get());
+
+        // Further globals that are only announced and bound in the registry benchmark.
+        auto display = server.display.get();
+        server.globals.emplace_back(std::make_unique<Srv::Subcompositor>(display));
+        server.globals.emplace_back(std::make_unique<Srv::data_device_manager>(display));
+        server.globals.emplace_back(std::make_unique<Srv::XdgShell>(display));
+        server.globals.emplace_back(std::make_unique<Srv::Viewporter>(display));
+        server.globals.emplace_back(std::make_unique<Srv::PresentationManager>(display));
+        server.globals.emplace_back(std::make_unique<Srv::ShadowManager>(display));
+        server.globals.emplace_back(std::make_unique<Srv::BlurManager>(display));
+        server.globals.emplace_back(std::make_unique<Srv::ContrastManager>(display));
+        server.globals.emplace_back(std::make_unique<Srv::SlideManager>(display));
+        server.globals.emplace_back(std::make_unique<Srv::RelativePointerManagerV1>(display));
+        server.globals.emplace_back(std::make_unique<Srv::PointerGesturesV1>(display));
+        server.globals.emplace_back(std::make_unique<Srv::PointerConstraintsV1>(display));
+        server.globals.emplace_back(std::make_unique<Srv::IdleInhibitManagerV1>(display));
+        server.globals.emplace_back(std::make_unique<Srv::LayerShellV1>(display));
+        server.globals.emplace_back(std::make_unique<Srv::PlasmaShell>(display));
+
+        return true;
+    }
+
+    void run_all()
+    {
+        run(QStringLiteral("surface_attach_damage_commit"), [this] { return surface_commit(); });
+        run(QStringLiteral("pointer_motion_fan_out"), [this] { return pointer_motion(); });
+        run(QStringLiteral("keyboard_key_delivery"), [this] { return keyboard_key(); });
+        run(QStringLiteral("registry_bind_all_globals"), [this] { return registry_bind(); });
+        run(QStringLiteral("registry_bind_many_clients"),
+            [this] { return registry_bind_many_clients(); });
+        run(QStringLiteral("plasma_window_create"), [this] { return plasma_window_create(); });
+    }
+
+    QJsonDocument report() const
+    {
+        QJsonArray benchmarks;
+        for (auto const& result : results) {
+            benchmarks.append(result.to_json());
+        }
+        QJsonArray failures;
+        for (auto const& name : failed) {
+            failures.append(name);
+        }
+
+        return QJsonDocument(QJsonObject{
+            {QStringLiteral("version"), QStringLiteral(WRAPLAND_VERSION_STRING)},
+            {QStringLiteral("timestamp"),
+             QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs)},
+            {QStringLiteral("benchmarks"), benchmarks},
+            {QStringLiteral("failed"), failures},
+        });
+    }
+
+    bool success() const
+    {
+        return failed.empty();
+    }
+
+private:
+    void run(QString const& name, std::function<std::optional<benchmark_result>()> const& bench)
+    {
+        auto result = bench();
+        if (!result) {
+            std::cerr << "Benchmark " << name.toStdString() << " failed." << std::endl;
+            failed.push_back(name);
+            return;
+        }
+        result->name = name;
+        results.push_back(*result);
+    }
+
+    Srv::Surface* create_surface(client_connection& client, std::unique_ptr<Clt::Surface>& surface)
+    {
+        QObject context;
+        Srv::Surface* server_surface{nullptr};
+
+        QObject::connect(server.compositor.get(),
+                         &Srv::Compositor::surfaceCreated,
+                         &context,
+                         [&server_surface](auto created) { server_surface = created; });
+
+        surface.reset(client.compositor->createSurface());
+        client.connection->flush();
+
+        if (!wait_for([&server_surface] { return server_surface != nullptr; })) {
+            return nullptr;
+        }
+        return server_surface;
+    }
+
+    std::optional<benchmark_result> surface_commit()
+    {
+        client_connection client;
+        if (!client.establish()) {
+            return {};
+        }
+
+        std::unique_ptr<Clt::Surface> surface;
+        auto server_surface = create_surface(client, surface);
+        if (!server_surface) {
+            return {};
+        }
+
+        QObject context;
+        int commits{0};
+        QObject::connect(
+            server_surface, &Srv::Surface::committed, &context, [&commits] { commits++; });
+
+        auto const size = QSize(256, 256);
+        auto buffer = client.shm->getBuffer(size, size.width() * 4);
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for (int i = 0; i < iterations; i++) {
+            surface->attachBuffer(buffer);
+            surface->damage(QRect(QPoint(i % size.width(), 0), QSize(1, size.height())));
+            surface->commit(Clt::Surface::CommitFlag::None);
+        }
+        client.connection->flush();
+
+        if (!wait_for([&commits, this] { return commits == iterations; })) {
+            return {};
+        }
+
+        return benchmark_result{{},
+                                iterations,
+                                timer.nsecsElapsed(),
+                                {{QStringLiteral("buffer_width"), size.width()},
+                                 {QStringLiteral("buffer_height"), size.height()}}};
+    }
+
+    std::optional<benchmark_result> pointer_motion()
+    {
+        client_connection client;
+        if (!client.establish() || !client.seat) {
+            return {};
+        }
+
+        QObject context;
+
+        bool has_pointer{false};
+        QObject::connect(client.seat.get(),
+                         &Clt::Seat::hasPointerChanged,
+                         &context,
+                         [&has_pointer](bool has) { has_pointer = has; });
+        server.seat->setHasPointer(true);
+        if (!wait_for([&has_pointer] { return has_pointer; })) {
+            return {};
+        }
+
+        std::unique_ptr<Clt::Surface> surface;
+        auto server_surface = create_surface(client, surface);
+        if (!server_surface) {
+            return {};
+        }
+
+        // The focused surface's client holds one wl_pointer per device. Motion fans out to all.
+        int server_pointers{0};
+        QObject::connect(server.seat.get(),
+                         &Srv::Seat::pointerCreated,
+                         &context,
+                         [&server_pointers] { server_pointers++; });
+
+        int motions{0};
+        std::vector<std::unique_ptr<Clt::Pointer>> pointers;
+        for (int i = 0; i < clients; i++) {
+            auto& pointer = pointers.emplace_back(client.seat->createPointer());
+            QObject::connect(pointer.get(), &Clt::Pointer::motion, &context, [&motions] {
+                motions++;
+            });
+        }
+        client.connection->flush();
+
+        if (!wait_for([&server_pointers, this] { return server_pointers == clients; })) {
+            return {};
+        }
+
+        auto& pool = server.seat->pointers();
+        pool.set_position(QPointF(0, 0));
+        pool.set_focused_surface(server_surface);
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for (int i = 0; i < iterations; i++) {
+            server.seat->setTimestamp(i);
+            pool.set_position(QPointF(1 + i % 100, 1 + i % 50));
+            pool.frame();
+        }
+        server.display->flush();
+
+        auto const expected = iterations * clients;
+        if (!wait_for([&motions, expected] { return motions == expected; })) {
+            return {};
+        }
+
+        auto const elapsed = timer.nsecsElapsed();
+
+        pool.set_focused_surface(nullptr);
+        server.seat->setHasPointer(false);
+
+        return benchmark_result{
+            {}, iterations, elapsed, {{QStringLiteral("pointer_devices"), clients}}};
+    }
+
+    std::optional<benchmark_result> keyboard_key()
+    {
+        client_connection client;
+        if (!client.establish() || !client.seat) {
+            return {};
+        }
+
+        QObject context;
+
+        bool has_keyboard{false};
+        QObject::connect(client.seat.get(),
+                         &Clt::Seat::hasKeyboardChanged,
+                         &context,
+                         [&has_keyboard](bool has) { has_keyboard = has; });
+        server.seat->setHasKeyboard(true);
+        if (!wait_for([&has_keyboard] { return has_keyboard; })) {
+            return {};
+        }
+
+        std::unique_ptr<Clt::Surface> surface;
+        auto server_surface = create_surface(client, surface);
+        if (!server_surface) {
+            return {};
+        }
+
+        bool keyboard_created{false};
+        QObject::connect(server.seat.get(),
+                         &Srv::Seat::keyboardCreated,
+                         &context,
+                         [&keyboard_created] { keyboard_created = true; });
+
+        std::unique_ptr<Clt::Keyboard> keyboard(client.seat->createKeyboard());
+        client.connection->flush();
+        if (!wait_for([&keyboard_created] { return keyboard_created; })) {
+            return {};
+        }
+
+        int keys{0};
+        QObject::connect(
+            keyboard.get(), &Clt::Keyboard::keyChanged, &context, [&keys] { keys++; });
+
+        auto& pool = server.seat->keyboards();
+        pool.set_focused_surface(server_surface);
+
+        QElapsedTimer timer;
+        timer.start();
+
+        // One iteration is a full key press and release.
+        for (int i = 0; i < iterations; i++) {
+            server.seat->setTimestamp(i);
+            pool.key(key_code_a, Srv::key_state::pressed);
+            pool.key(key_code_a, Srv::key_state::released);
+        }
+        server.display->flush();
+
+        auto const expected = 2 * iterations;
+        if (!wait_for([&keys, expected] { return keys == expected; })) {
+            return {};
+        }
+
+        auto const elapsed = timer.nsecsElapsed();
+
+        pool.set_focused_surface(nullptr);
+        server.seat->setHasKeyboard(false);
+
+        return benchmark_result{{}, iterations, elapsed, {}};
+    }
+
+    std::optional<benchmark_result> registry_bind()
+    {
+        // Announcing and binding is much more expensive than the other hot paths.
+        auto const rounds = std::max(1, iterations / 100);
+        qint64 elapsed{0};
+
+        for (int i = 0; i < rounds; i++) {
+            // Not all globals have a destructor request. Their resources are only released when
+            // the client disconnects, so every round uses a fresh connection. It is not measured.
+            client_connection client;
+            if (!client.establish()) {
+                return {};
+            }
+
+            QObject context;
+
+            QElapsedTimer timer;
+            timer.start();
+
+            Clt::Registry registry;
+            registry.setEventQueue(client.queue.get());
+
+            bool announced{false};
+            QObject::connect(&registry,
+                             &Clt::Registry::interfacesAnnounced,
+                             &context,
+                             [&announced] { announced = true; });
+            registry.create(client.connection->display());
+            registry.setup();
+            client.connection->flush();
+
+            if (!wait_for([&announced] { return announced; })) {
+                return {};
+            }
+
+            auto proxies = bind_all(registry);
+
+            // Requests are processed in order. Once the surface arrives all binds are processed.
+            std::unique_ptr<Clt::Surface> sync_surface;
+            if (!create_surface(client, sync_surface)) {
+                return {};
+            }
+
+            elapsed += timer.nsecsElapsed();
+
+            for (auto proxy : proxies) {
+                wl_proxy_destroy(static_cast<wl_proxy*>(proxy));
+            }
+        }
+
+        return benchmark_result{{},
+                                rounds,
+                                elapsed,
+                                {{QStringLiteral("globals"), static_cast<int>(binders.size())}}};
+    }
+
+    std::optional<benchmark_result> registry_bind_many_clients()
+    {
+        // Only announcing and binding is measured. The clients are connected up front.
+        std::vector<std::unique_ptr<client_connection>> connections;
+        for (int i = 0; i < registry_clients; i++) {
+            auto& client = connections.emplace_back(std::make_unique<client_connection>());
+            if (!client->connect()) {
+                return {};
+            }
+        }
+
+        QObject context;
+
+        int announced{0};
+        int surfaces{0};
+        QObject::connect(server.compositor.get(),
+                         &Srv::Compositor::surfaceCreated,
+                         &context,
+                         [&surfaces] { surfaces++; });
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for (auto& client : connections) {
+            client->registry = std::make_unique<Clt::Registry>();
+            client->registry->setEventQueue(client->queue.get());
+            QObject::connect(client->registry.get(),
+                             &Clt::Registry::interfacesAnnounced,
+                             &context,
+                             [&announced] { announced++; });
+            client->registry->create(client->connection->display());
+            client->registry->setup();
+            client->connection->flush();
+        }
+
+        if (!wait_for([&announced, this] { return announced == registry_clients; })) {
+            return {};
+        }
+
+        std::vector<std::vector<void*>> proxies;
+        std::vector<std::unique_ptr<Clt::Surface>> sync_surfaces;
+
+        for (auto& client : connections) {
+            proxies.push_back(bind_all(*client->registry));
+
+            // Requests are processed in order. Once the surface arrives all binds are processed.
+            auto const comp = client->registry->interface(Interface::Compositor);
+            client->compositor.reset(client->registry->createCompositor(comp.name, comp.version));
+            sync_surfaces.emplace_back(client->compositor->createSurface());
+            client->connection->flush();
+        }
+
+        if (!wait_for([&surfaces, this] { return surfaces == registry_clients; })) {
+            return {};
+        }
+
+        auto const elapsed = timer.nsecsElapsed();
+
+        sync_surfaces.clear();
+        for (auto const& client_proxies : proxies) {
+            for (auto proxy : client_proxies) {
+                wl_proxy_destroy(static_cast<wl_proxy*>(proxy));
+            }
+        }
+
+        return benchmark_result{{},
+                                registry_clients,
+                                elapsed,
+                                {{QStringLiteral("clients"), registry_clients},
+                                 {QStringLiteral("globals"), static_cast<int>(binders.size())},
+                                 {QStringLiteral("filtered"), true}}};
+    }
+
+    std::optional<benchmark_result> plasma_window_create()
+    {
+        client_connection client;
+        if (!client.establish()) {
+            return {};
+        }
+
+        auto const iface = client.registry->interface(Interface::PlasmaWindowManagement);
+        std::unique_ptr<Clt::PlasmaWindowManagement> management(
+            client.registry->createPlasmaWindowManagement(iface.name, iface.version));
+
+        QObject context;
+        int created{0};
+        QObject::connect(management.get(),
+                         &Clt::PlasmaWindowManagement::windowCreated,
+                         &context,
+                         [&created] { created++; });
+
+        auto const windows = std::max(1, iterations / 10);
+        std::vector<std::unique_ptr<Srv::PlasmaWindow>> server_windows;
+        server_windows.reserve(windows);
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for (int i = 0; i < windows; i++) {
+            auto window = server.plasma_window_manager->createWindow();
+            window->setTitle(QStringLiteral("window %1").arg(i));
+            window->setAppId(QStringLiteral("org.kde.wrapland.benchmark"));
+            window->setPid(i);
+            server_windows.emplace_back(window);
+        }
+        server.display->flush();
+
+        if (!wait_for([&created, windows] { return created == windows; })) {
+            return {};
+        }
+
+        auto const elapsed = timer.nsecsElapsed();
+
+        server_windows.clear();
+        server.display->flush();
+
+        return benchmark_result{{}, windows, elapsed, {}};
+    }
+
+    struct {
+        std::unique_ptr<Srv::Display> display;
+        std::unique_ptr<Srv::Compositor> compositor;
+        std::unique_ptr<Srv::Seat> seat;
+        std::unique_ptr<Srv::PlasmaWindowManager> plasma_window_manager;
+        std::vector<std::unique_ptr<QObject>> globals;
+    } server;
+
+    int iterations;
+    int clients;
+    int registry_clients;
+
+    std::vector<benchmark_result> results;
+    std::vector<QString> failed;
+};
+
+}
+
+int main(int argc, char** argv)
+{
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Measures Wrapland server protocol hot paths with an in-process client."));
+    parser.addHelpOption();
+
+    QCommandLineOption iterations_option(
+        QStringLiteral("iterations"),
+        QStringLiteral("Number of iterations per benchmark."),
+        QStringLiteral("count"),
+        QString::number(default_iterations));
+    QCommandLineOption clients_option(QStringLiteral("clients"),
+                                      QStringLiteral("Number of pointer devices motion fans out to."),
+                                      QStringLiteral("count"),
+                                      QString::number(default_clients));
+    QCommandLineOption registry_clients_option(
+        QStringLiteral("registry-clients"),
+        QStringLiteral("Number of clients announcing and binding globals at the same time."),
+        QStringLiteral("count"),
+        QString::number(default_registry_clients));
+    QCommandLineOption output_option(QStringLiteral("output"),
+                                     QStringLiteral("Write the JSON report to this file."),
+                                     QStringLiteral("file"));
+    parser.addOptions(
+        {iterations_option, clients_option, registry_clients_option, output_option});
+    parser.process(app);
+
+    auto const iterations = std::max(1, parser.value(iterations_option).toInt());
+    auto const clients = std::max(1, parser.value(clients_option).toInt());
+    auto const registry_clients = std::max(1, parser.value(registry_clients_option).toInt());
+
+    benchmark_runner runner(iterations, clients, registry_clients);
+    if (!runner.setup()) {
+        std::cerr << "Failed to start the Wayland server." << std::endl;
+        return 1;
+    }
+
+    runner.run_all();
+
+    auto const json = runner.report().toJson(QJsonDocument::Indented);
+
+    if (parser.isSet(output_option)) {
+        QFile file(parser.value(output_option));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            std::cerr << "Failed to open " << file.fileName().toStdString() << std::endl;
+            return 1;
+        }
+        file.write(json);
+    } else {
+        std::cout << json.toStdString();
+    }
+
+    return runner.success() ? 0 : 1;
+}
@@ -26,11 +26,15 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "surface.h"
 
 #include "wayland/buffer_manager.h"
+#include "wayland/client.h"
+#include "wayland/client_quota.h"
 #include "wayland/display.h"
 
 #include "linux_dmabuf_v1.h"
 #include "linux_dmabuf_v1_p.h"
+#include "single_pixel_buffer_v1_p.h"
 
+#include <cstring>
 #include <drm_fourcc.h>
 
 #include <EGL/egl.h>
@@ -47,6 +51,9 @@ namespace Wrapland::Server
 
 int constexpr default_bpp{32};
 
+// Scanning bigger buffers for uniformity costs more than it likely saves on upload.
+int constexpr solid_color_max_pixels{64 * 64};
+
 ShmImage::Private::Private(Buffer* buffer, ShmImage::Format format)
     : format{format}
     , stride{wl_shm_buffer_get_stride(buffer->d_ptr->shmBuffer)}
@@ -208,11 +215,12 @@ Buffer::Private::Private(Buffer* q_ptr,
     , display(display)
     , q_ptr{q_ptr}
 {
+    linux_dmabuf_buffer_v1_res* dmabuf_res{nullptr};
     if (!shmBuffer
         && wl_resource_instance_of(
             resource, &wl_buffer_interface, &linux_dmabuf_buffer_v1_res_impl::s_interface)) {
-        dmabufBuffer
-            = Wayland::Resource<linux_dmabuf_buffer_v1_res>::get_handle(resource)->handle.get();
+        dmabuf_res = Wayland::Resource<linux_dmabuf_buffer_v1_res>::get_handle(resource);
+        dmabufBuffer = dmabuf_res->handle.get();
     }
 
     destroyWrapper.buffer = q_ptr;
@@ -223,6 +231,15 @@ Buffer::Private::Private(Buffer* q_ptr,
 
     if (shmBuffer) {
         size = QSize(wl_shm_buffer_get_width(shmBuffer), wl_shm_buffer_get_height(shmBuffer));
+
+        if (surface) {
+            if (auto const& state = Wayland::Client::cast_client(surface->client())->quota) {
+                state->add_buffer(resource,
+                                  static_cast<size_t>(wl_shm_buffer_get_stride(shmBuffer))
+                                      * static_cast<size_t>(size.height()));
+            }
+        }
+
         // check alpha
         switch (wl_shm_buffer_get_format(shmBuffer)) {
         case WL_SHM_FORMAT_ARGB8888:
@@ -233,43 +250,29 @@ Buffer::Private::Private(Buffer* q_ptr,
             alpha = false;
             break;
         }
-    } else if (dmabufBuffer) {
-        switch (dmabufBuffer->format) {
-        case DRM_FORMAT_ARGB4444:
-        case DRM_FORMAT_ABGR4444:
-        case DRM_FORMAT_RGBA4444:
-        case DRM_FORMAT_BGRA4444:
-
-        case DRM_FORMAT_ARGB1555:
-        case DRM_FORMAT_ABGR1555:
-        case DRM_FORMAT_RGBA5551:
-        case DRM_FORMAT_BGRA5551:
-
-        case DRM_FORMAT_ARGB8888:
-        case DRM_FORMAT_ABGR8888:
-        case DRM_FORMAT_RGBA8888:
-        case DRM_FORMAT_BGRA8888:
-
-        case DRM_FORMAT_ARGB2101010:
-        case DRM_FORMAT_ABGR2101010:
-        case DRM_FORMAT_RGBA1010102:
-        case DRM_FORMAT_BGRA1010102:
-
-        case DRM_FORMAT_XRGB8888_A8:
-        case DRM_FORMAT_XBGR8888_A8:
-        case DRM_FORMAT_RGBX8888_A8:
-        case DRM_FORMAT_BGRX8888_A8:
-        case DRM_FORMAT_RGB888_A8:
-        case DRM_FORMAT_BGR888_A8:
-        case DRM_FORMAT_RGB565_A8:
-        case DRM_FORMAT_BGR565_A8:
-            alpha = true;
-            break;
-        default:
-            alpha = false;
-            break;
+    } else if (dmabuf_res) {
+        if (dmabufBuffer) {
+            update_dmabuf_state();
+        } else {
+            // Still importing asynchronously. Surfaces hold back commits with it until then.
+            pending_import = dmabuf_res;
+            QObject::connect(dmabuf_res,
+                             &linux_dmabuf_buffer_v1_res::imported,
+                             q_ptr,
+                             [this, dmabuf_res] {
+                                 dmabufBuffer = dmabuf_res->handle.get();
+                                 pending_import.clear();
+                                 update_dmabuf_state();
+                             });
         }
-        size = dmabufBuffer->size;
+    } else if (wl_resource_instance_of(
+                   resource, &wl_buffer_interface, &single_pixel_buffer_v1_res_impl::s_interface)) {
+        auto const& color
+            = Wayland::Resource<single_pixel_buffer_v1_res>::get_handle(resource)->color;
+        size = QSize(1, 1);
+        alpha = color.alpha() < 255;
+        solid_color.color = color;
+        solid_color.checked = true;
     } else if (surface) {
         EGLDisplay eglDisplay = surface->client()->display()->eglDisplay();
 
@@ -309,6 +312,97 @@ Buffer::Private::Private(Buffer* q_ptr,
     }
 }
 
+void Buffer::Private::update_dmabuf_state()
+{
+    switch (dmabufBuffer->format) {
+    case DRM_FORMAT_ARGB4444:
+    case DRM_FORMAT_ABGR4444:
+    case DRM_FORMAT_RGBA4444:
+    case DRM_FORMAT_BGRA4444:
+
+    case DRM_FORMAT_ARGB1555:
+    case DRM_FORMAT_ABGR1555:
+    case DRM_FORMAT_RGBA5551:
+    case DRM_FORMAT_BGRA5551:
+
+    case DRM_FORMAT_ARGB8888:
+    case DRM_FORMAT_ABGR8888:
+    case DRM_FORMAT_RGBA8888:
+    case DRM_FORMAT_BGRA8888:
+
+    case DRM_FORMAT_ARGB2101010:
+    case DRM_FORMAT_ABGR2101010:
+    case DRM_FORMAT_RGBA1010102:
+    case DRM_FORMAT_BGRA1010102:
+
+    case DRM_FORMAT_XRGB8888_A8:
+    case DRM_FORMAT_XBGR8888_A8:
+    case DRM_FORMAT_RGBX8888_A8:
+    case DRM_FORMAT_BGRX8888_A8:
+    case DRM_FORMAT_RGB888_A8:
+    case DRM_FORMAT_BGR888_A8:
+    case DRM_FORMAT_RGB565_A8:
+    case DRM_FORMAT_BGR565_A8:
+        alpha = true;
+        break;
+    default:
+        alpha = false;
+        break;
+    }
+    size = dmabufBuffer->size;
+}
+
+std::optional<QColor> Buffer::Private::detect_shm_solid_color() const
+{
+    if (!shmBuffer || size.isEmpty() || size.width() * size.height() > solid_color_max_pixels) {
+        return std::nullopt;
+    }
+
+    auto const format = getFormat(shmBuffer);
+    if (format == ShmImage::Format::invalid) {
+        return std::nullopt;
+    }
+
+    if (!display->bufferManager()->beginShmAccess(shmBuffer)) {
+        return std::nullopt;
+    }
+
+    auto const stride = wl_shm_buffer_get_stride(shmBuffer);
+    auto const data = static_cast<uchar const*>(wl_shm_buffer_get_data(shmBuffer));
+
+    // With xrgb8888 the alpha byte is undefined and must be ignored.
+    auto const mask = format == ShmImage::Format::xrgb8888 ? 0x00FFFFFFU : 0xFFFFFFFFU;
+
+    auto pixel = [&](int x, int y) {
+        uint32_t value{0};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(&value, data + y * stride + x * (default_bpp / 8), sizeof(uint32_t));
+        return value & mask;
+    };
+
+    auto const first = pixel(0, 0);
+    auto uniform = true;
+
+    for (int y = 0; y < size.height() && uniform; y++) {
+        for (int x = 0; x < size.width(); x++) {
+            if (pixel(x, y) != first) {
+                uniform = false;
+                break;
+            }
+        }
+    }
+
+    display->bufferManager()->endShmAccess();
+
+    if (!uniform) {
+        return std::nullopt;
+    }
+    if (format == ShmImage::Format::xrgb8888) {
+        return QColor::fromRgb(first);
+    }
+    return QColor::fromRgba(qUnpremultiply(first));
+}
+
 Buffer::Private::~Private()
 {
     wl_list_remove(&destroyWrapper.listener.link);
@@ -374,6 +468,9 @@ std::shared_ptr<Buffer> Buffer::get(Display* display, wl_resource* resource)
 
 Buffer::~Buffer()
 {
+    if (d_ptr->release_point) {
+        d_ptr->release_point->timeline->signal(d_ptr->release_point->value);
+    }
     if (d_ptr->committed && d_ptr->resource) {
         wl_buffer_send_release(d_ptr->resource);
         wl_client_flush(wl_resource_get_client(d_ptr->resource));
@@ -415,6 +512,15 @@ bool Buffer::hasAlphaChannel() const
     return d_ptr->alpha;
 }
 
+std::optional<QColor> Buffer::solid_color() const
+{
+    if (!d_ptr->solid_color.checked) {
+        d_ptr->solid_color.color = d_ptr->detect_shm_solid_color();
+        d_ptr->solid_color.checked = true;
+    }
+    return d_ptr->solid_color.color;
+}
+
 void Buffer::setCommitted()
 {
     d_ptr->committed = true;
@@ -19,6 +19,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 *********************************************************************/
 #pragma once
 
+#include <QColor>
 #include <QImage>
 #include <QObject>
 
@@ -88,6 +89,18 @@ public:
 
     bool hasAlphaChannel() const;
 
+    /**
+     * The color of the buffer in case all of its pixels have the same value. This is the case for
+     * buffers created through the single pixel buffer protocol and for small uniformly filled shm
+     * buffers. The renderer can then draw the surface with this color instead of uploading the
+     * buffer as a texture.
+     *
+     * The color is not premultiplied. For shm buffers the content is inspected on the first call.
+     *
+     * @return The color or no value if the buffer content is not uniform or unknown.
+     */
+    std::optional<QColor> solid_color() const;
+
     static std::shared_ptr<Buffer> get(Display* display, wl_resource* resource);
 
 Q_SIGNALS:
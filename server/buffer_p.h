@@ -19,11 +19,16 @@ You should have received a copy of the GNU Lesser General Public
 License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 *********************************************************************/
 #include "buffer.h"
+#include "linux_drm_syncobj_v1.h"
+
+#include <QPointer>
 
 #include <wayland-server.h>
 
 namespace Wrapland::Server
 {
+class linux_dmabuf_buffer_v1_res;
+
 namespace Wayland
 {
 class Display;
@@ -66,12 +71,25 @@ public:
     wl_shm_buffer* shmBuffer;
     linux_dmabuf_buffer_v1* dmabufBuffer{nullptr};
 
+    void update_dmabuf_state();
+    std::optional<QColor> detect_shm_solid_color() const;
+
     Surface* surface;
     int refCount{0};
     QSize size;
     bool alpha{false};
     bool committed{false};
 
+    std::optional<linux_drm_syncobj_point_v1> release_point;
+
+    // Set while the dmabuf of a buffer created with create_immed is still imported.
+    QPointer<linux_dmabuf_buffer_v1_res> pending_import;
+
+    struct {
+        std::optional<QColor> color;
+        bool checked{false};
+    } solid_color;
+
     Wayland::Display* display;
 
 private:
@@ -21,6 +21,9 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "client_p.h"
 
 #include "wayland/client.h"
+#include "wayland/client_hang_monitor.h"
+#include "wayland/client_quota.h"
+#include "wayland/display.h"
 
 #include "display.h"
 
@@ -88,4 +91,52 @@ void Client::set_security_context_app_id(std::string const& id)
     d_ptr->set_security_context_app_id(id);
 }
 
+client_quota Client::quota() const
+{
+    return d_ptr->quota ? d_ptr->quota->config : client_quota();
+}
+
+void Client::set_quota(client_quota const& quota)
+{
+    if (!d_ptr->quota) {
+        d_ptr->quota = std::make_shared<Wayland::client_quota_state>(d_ptr->native, this);
+    }
+    d_ptr->quota->set(quota);
+    Wayland::Display::backendCast(d_ptr->m_display)->update_request_logger();
+}
+
+client_hang_detection Client::hang_detection() const
+{
+    return d_ptr->hang_monitor ? d_ptr->hang_monitor->config : client_hang_detection();
+}
+
+void Client::set_hang_detection(client_hang_detection const& config)
+{
+    if (!d_ptr->hang_monitor) {
+        d_ptr->hang_monitor = std::make_unique<Wayland::client_hang_monitor>(d_ptr.get());
+    }
+    d_ptr->hang_monitor->set(config);
+}
+
+size_t Client::queued_socket_bytes() const
+{
+    if (!d_ptr->native) {
+        return 0;
+    }
+    return Wayland::client_hang_monitor::queued_socket_bytes(d_ptr->native);
+}
+
+std::chrono::milliseconds Client::stall_time() const
+{
+    if (!d_ptr->hang_monitor) {
+        return std::chrono::milliseconds::zero();
+    }
+    return d_ptr->hang_monitor->stall_time();
+}
+
+bool Client::hung() const
+{
+    return d_ptr->hang_monitor && d_ptr->hang_monitor->hung;
+}
+
 }
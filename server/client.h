@@ -23,6 +23,9 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <Wrapland/Server/wraplandserver_export.h>
 
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <sys/types.h>
@@ -42,6 +45,51 @@ class Client;
 class Display;
 }
 
+enum class client_quota_kind {
+    resources,
+    buffer_bytes,
+    request_rate,
+};
+
+enum class client_quota_action {
+    /// Only report the violation. The compositor decides how to deal with the client.
+    notify,
+    /// Post a protocol error, which disconnects the client.
+    error,
+};
+
+/**
+ * Limits what a single client may demand from the server. Zero values and interfaces not listed
+ * are not limited.
+ */
+struct client_quota {
+    /// Maximal number of live resources per interface name, for example "wl_surface".
+    std::map<std::string, size_t> max_resources;
+    /// Maximal size in bytes of the shm buffers the client attached and has not destroyed yet.
+    size_t max_buffer_bytes{0};
+    /// Token bucket for the requests of the client.
+    struct {
+        /// Requests per second refilling the bucket.
+        uint32_t rate{0};
+        /// Maximal number of requests at once. Defaults to the rate when zero.
+        uint32_t burst{0};
+    } requests;
+    client_quota_action action{client_quota_action::error};
+};
+
+/**
+ * Detects clients that stop reading from their connection. Zero values disable a check.
+ */
+struct client_hang_detection {
+    /// Queued socket memory, see Client::queued_socket_bytes, at which the client counts as hung.
+    size_t max_queued_socket_bytes{0};
+    /// Time the client may read nothing while data is queued before it counts as hung.
+    std::chrono::milliseconds max_stall{0};
+    /// Whether pointer motion and frame callbacks are held back while the client is hung.
+    /// Presentation feedback is reduced to discarded events.
+    bool throttle_events{false};
+};
+
 class WRAPLANDSERVER_EXPORT Client : public QObject
 {
     Q_OBJECT
@@ -62,9 +110,43 @@ public:
     std::string security_context_app_id() const;
     void set_security_context_app_id(std::string const& id);
 
+    client_quota quota() const;
+
+    /**
+     * Replaces the quota set through Display::set_client_quota for this client. Limits are checked
+     * when a resource is created, a buffer is attached or a request comes in.
+     */
+    void set_quota(client_quota const& quota);
+
+    client_hang_detection hang_detection() const;
+
+    /// Replaces the detection set through Display::set_client_hang_detection for this client.
+    void set_hang_detection(client_hang_detection const& config);
+
+    /**
+     * Memory the kernel holds for data sent to the client that it has not yet read. On Unix
+     * sockets this counts whole socket buffers, so it is larger than the unread payload. Data
+     * libwayland has not yet written to the socket is not included.
+     */
+    size_t queued_socket_bytes() const;
+
+    /// Time since the client last read data. Zero when nothing is queued or detection is off.
+    std::chrono::milliseconds stall_time() const;
+
+    bool hung() const;
+
 Q_SIGNALS:
     void disconnected(Client*);
 
+    /**
+     * Emitted while handling the request that exceeded a limit. The client must not be destroyed
+     * directly from here.
+     */
+    void quota_exceeded(Wrapland::Server::client_quota_kind kind);
+
+    /// Emitted queued when the client crosses the thresholds of its hang detection.
+    void hung_changed(bool hung);
+
 private:
     friend class Wayland::Client;
 
@@ -77,3 +159,4 @@ private:
 }
 
 Q_DECLARE_METATYPE(Wrapland::Server::Client*)
+Q_DECLARE_METATYPE(Wrapland::Server::client_quota_kind)
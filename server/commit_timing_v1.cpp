@@ -0,0 +1,124 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "commit_timing_v1_p.h"
+
+#include "client.h"
+#include "display.h"
+#include "surface_p.h"
+
+#include <chrono>
+
+namespace Wrapland::Server
+{
+
+struct wp_commit_timing_manager_v1_interface const
+    commit_timing_manager_v1::Private::s_interface
+    = {
+        resourceDestroyCallback,
+        cb<get_timer_callback>,
+};
+
+commit_timing_manager_v1::Private::Private(Display* display, commit_timing_manager_v1* q_ptr)
+    : commit_timing_manager_v1_global(q_ptr,
+                                      display,
+                                      &wp_commit_timing_manager_v1_interface,
+                                      &s_interface)
+{
+    create();
+}
+
+void commit_timing_manager_v1::Private::get_timer_callback(commit_timing_manager_v1_bind* bind,
+                                                           uint32_t id,
+                                                           wl_resource* wlSurface)
+{
+    auto surface = Wayland::Resource<Surface>::get_handle(wlSurface);
+
+    if (surface->d_ptr->commit_timer) {
+        bind->post_error(WP_COMMIT_TIMING_MANAGER_V1_ERROR_COMMIT_TIMER_EXISTS,
+                         "Surface already has a commit timer");
+        return;
+    }
+
+    auto timer = new commit_timer_v1_res(bind->client->handle, bind->version, id, surface);
+    surface->d_ptr->install_commit_timer(timer);
+}
+
+commit_timing_manager_v1::commit_timing_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+commit_timing_manager_v1::~commit_timing_manager_v1() = default;
+
+commit_timer_v1_res::commit_timer_v1_res(Client* client,
+                                         uint32_t version,
+                                         uint32_t id,
+                                         Surface* surface)
+    : surface{surface}
+    , impl{new commit_timer_v1_res_impl(client, version, id, this)}
+{
+    connect(surface, &Surface::resourceDestroyed, this, [this] { this->surface = nullptr; });
+}
+
+struct wp_commit_timer_v1_interface const commit_timer_v1_res_impl::s_interface = {
+    set_timestamp_callback,
+    destroyCallback,
+};
+
+commit_timer_v1_res_impl::commit_timer_v1_res_impl(Client* client,
+                                                   uint32_t version,
+                                                   uint32_t id,
+                                                   commit_timer_v1_res* q_ptr)
+    : Wayland::Resource<commit_timer_v1_res>(client,
+                                             version,
+                                             id,
+                                             &wp_commit_timer_v1_interface,
+                                             &s_interface,
+                                             q_ptr)
+{
+}
+
+void commit_timer_v1_res_impl::set_timestamp_callback([[maybe_unused]] wl_client* wlClient,
+                                                      wl_resource* wlResource,
+                                                      uint32_t tv_sec_hi,
+                                                      uint32_t tv_sec_lo,
+                                                      uint32_t tv_nsec)
+{
+    auto res = get_handle(wlResource);
+    if (!res->surface) {
+        res->impl->postError(WP_COMMIT_TIMER_V1_ERROR_SURFACE_DESTROYED, "Surface was destroyed");
+        return;
+    }
+
+    constexpr uint32_t nsec_per_sec{1000000000};
+    if (tv_nsec >= nsec_per_sec) {
+        res->impl->postError(WP_COMMIT_TIMER_V1_ERROR_INVALID_TIMESTAMP,
+                             "Nanoseconds must be less than one second");
+        return;
+    }
+
+    auto& pending = res->surface->d_ptr->pending;
+    if (pending.target_time) {
+        res->impl->postError(WP_COMMIT_TIMER_V1_ERROR_TIMESTAMP_EXISTS,
+                             "Timestamp already set for this commit");
+        return;
+    }
+
+    auto const secs = (static_cast<uint64_t>(tv_sec_hi) << 32) | tv_sec_lo;
+
+    // Timestamps past the range of nanoseconds are so far in the future that we saturate them.
+    constexpr auto max_secs
+        = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::nanoseconds::max()).count();
+    if (secs >= static_cast<uint64_t>(max_secs)) {
+        pending.target_time = std::chrono::nanoseconds::max();
+        return;
+    }
+
+    pending.target_time = std::chrono::seconds(static_cast<int64_t>(secs))
+        + std::chrono::nanoseconds(tv_nsec);
+}
+
+}
@@ -0,0 +1,36 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * Global for the wp_commit_timing_manager_v1 interface.
+ *
+ * Clients use it to set a target presentation time for a commit. The time is in the clock domain
+ * of the PresentationManager. Such commits are queued on the Surface until the compositor calls
+ * Surface::apply_queued_commits with a presentation time not before the target.
+ */
+class WRAPLANDSERVER_EXPORT commit_timing_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit commit_timing_manager_v1(Display* display);
+    ~commit_timing_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
@@ -0,0 +1,69 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "commit_timing_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <wayland-commit-timing-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+class Surface;
+
+constexpr uint32_t commit_timing_manager_v1_version = 1;
+using commit_timing_manager_v1_global
+    = Wayland::Global<commit_timing_manager_v1, commit_timing_manager_v1_version>;
+using commit_timing_manager_v1_bind = Wayland::Bind<commit_timing_manager_v1_global>;
+
+class commit_timing_manager_v1::Private : public commit_timing_manager_v1_global
+{
+public:
+    Private(Display* display, commit_timing_manager_v1* q_ptr);
+
+private:
+    static void
+    get_timer_callback(commit_timing_manager_v1_bind* bind, uint32_t id, wl_resource* wlSurface);
+
+    static struct wp_commit_timing_manager_v1_interface const s_interface;
+};
+
+class commit_timer_v1_res_impl;
+
+class commit_timer_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    commit_timer_v1_res(Client* client, uint32_t version, uint32_t id, Surface* surface);
+
+    Surface* surface;
+    commit_timer_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class commit_timer_v1_res_impl : public Wayland::Resource<commit_timer_v1_res>
+{
+public:
+    commit_timer_v1_res_impl(Client* client,
+                             uint32_t version,
+                             uint32_t id,
+                             commit_timer_v1_res* q_ptr);
+
+    static struct wp_commit_timer_v1_interface const s_interface;
+
+private:
+    static void set_timestamp_callback(wl_client* wlClient,
+                                       wl_resource* wlResource,
+                                       uint32_t tv_sec_hi,
+                                       uint32_t tv_sec_lo,
+                                       uint32_t tv_nsec);
+};
+
+}
@@ -32,7 +32,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 namespace Wrapland::Server
 {
 
-constexpr uint32_t CompositorVersion = 4;
+constexpr uint32_t CompositorVersion = 6;
 using CompositorGlobal = Wayland::Global<Compositor, CompositorVersion>;
 using CompositorBind = Wayland::Bind<CompositorGlobal>;
 
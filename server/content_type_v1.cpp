@@ -0,0 +1,107 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "content_type_v1_p.h"
+
+#include "client.h"
+#include "display.h"
+#include "surface_p.h"
+
+namespace Wrapland::Server
+{
+
+struct wp_content_type_manager_v1_interface const content_type_manager_v1::Private::s_interface
+    = {
+        resourceDestroyCallback,
+        cb<get_surface_content_type_callback>,
+};
+
+content_type_manager_v1::Private::Private(Display* display, content_type_manager_v1* q_ptr)
+    : content_type_manager_v1_global(q_ptr,
+                                     display,
+                                     &wp_content_type_manager_v1_interface,
+                                     &s_interface)
+{
+    create();
+}
+
+void content_type_manager_v1::Private::get_surface_content_type_callback(
+    content_type_manager_v1_bind* bind,
+    uint32_t id,
+    wl_resource* wlSurface)
+{
+    auto surface = Wayland::Resource<Surface>::get_handle(wlSurface);
+
+    if (surface->d_ptr->content_type) {
+        bind->post_error(WP_CONTENT_TYPE_MANAGER_V1_ERROR_ALREADY_CONSTRUCTED,
+                         "Surface already has a content type object");
+        return;
+    }
+
+    auto content_type = new content_type_v1_res(bind->client->handle, bind->version, id, surface);
+    surface->d_ptr->install_content_type(content_type);
+}
+
+content_type_manager_v1::content_type_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+content_type_manager_v1::~content_type_manager_v1() = default;
+
+content_type_v1_res::content_type_v1_res(Client* client,
+                                         uint32_t version,
+                                         uint32_t id,
+                                         Surface* surface)
+    : surface{surface}
+    , impl{new content_type_v1_res_impl(client, version, id, this)}
+{
+    connect(surface, &Surface::resourceDestroyed, this, [this] { this->surface = nullptr; });
+}
+
+struct wp_content_type_v1_interface const content_type_v1_res_impl::s_interface = {
+    destroyCallback,
+    set_content_type_callback,
+};
+
+content_type_v1_res_impl::content_type_v1_res_impl(Client* client,
+                                                   uint32_t version,
+                                                   uint32_t id,
+                                                   content_type_v1_res* q_ptr)
+    : Wayland::Resource<content_type_v1_res>(client,
+                                             version,
+                                             id,
+                                             &wp_content_type_v1_interface,
+                                             &s_interface,
+                                             q_ptr)
+{
+}
+
+void content_type_v1_res_impl::set_content_type_callback([[maybe_unused]] wl_client* wlClient,
+                                                         wl_resource* wlResource,
+                                                         uint32_t type)
+{
+    auto surface = get_handle(wlResource)->surface;
+    if (!surface) {
+        return;
+    }
+
+    switch (type) {
+    case WP_CONTENT_TYPE_V1_TYPE_PHOTO:
+        surface->d_ptr->set_content_type(surface_content_type::photo);
+        break;
+    case WP_CONTENT_TYPE_V1_TYPE_VIDEO:
+        surface->d_ptr->set_content_type(surface_content_type::video);
+        break;
+    case WP_CONTENT_TYPE_V1_TYPE_GAME:
+        surface->d_ptr->set_content_type(surface_content_type::game);
+        break;
+    default:
+        surface->d_ptr->set_content_type(surface_content_type::none);
+        break;
+    }
+}
+
+}
@@ -0,0 +1,36 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * Global for the wp_content_type_manager_v1 interface.
+ *
+ * Clients describe through it the kind of content their surfaces show, what compositors may
+ * consider for direct scanout, adaptive sync and power decisions. The hint is available through
+ * surface_state::content_type once committed.
+ */
+class WRAPLANDSERVER_EXPORT content_type_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit content_type_manager_v1(Display* display);
+    ~content_type_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
@@ -0,0 +1,67 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "content_type_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <wayland-content-type-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+class Surface;
+
+constexpr uint32_t content_type_manager_v1_version = 1;
+using content_type_manager_v1_global
+    = Wayland::Global<content_type_manager_v1, content_type_manager_v1_version>;
+using content_type_manager_v1_bind = Wayland::Bind<content_type_manager_v1_global>;
+
+class content_type_manager_v1::Private : public content_type_manager_v1_global
+{
+public:
+    Private(Display* display, content_type_manager_v1* q_ptr);
+
+private:
+    static void get_surface_content_type_callback(content_type_manager_v1_bind* bind,
+                                                  uint32_t id,
+                                                  wl_resource* wlSurface);
+
+    static struct wp_content_type_manager_v1_interface const s_interface;
+};
+
+class content_type_v1_res_impl;
+
+class content_type_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    content_type_v1_res(Client* client, uint32_t version, uint32_t id, Surface* surface);
+
+    Surface* surface;
+    content_type_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class content_type_v1_res_impl : public Wayland::Resource<content_type_v1_res>
+{
+public:
+    content_type_v1_res_impl(Client* client,
+                             uint32_t version,
+                             uint32_t id,
+                             content_type_v1_res* q_ptr);
+
+    static struct wp_content_type_v1_interface const s_interface;
+
+private:
+    static void
+    set_content_type_callback(wl_client* wlClient, wl_resource* wlResource, uint32_t type);
+};
+
+}
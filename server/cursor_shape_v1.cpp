@@ -0,0 +1,107 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "cursor_shape_v1_p.h"
+
+#include "client.h"
+#include "display.h"
+#include "pointer_p.h"
+
+namespace Wrapland::Server
+{
+
+struct wp_cursor_shape_manager_v1_interface const cursor_shape_manager_v1::Private::s_interface
+    = {
+        resourceDestroyCallback,
+        cb<get_pointer_callback>,
+        cb<get_tablet_tool_v2_callback>,
+};
+
+cursor_shape_manager_v1::Private::Private(Display* display, cursor_shape_manager_v1* q_ptr)
+    : cursor_shape_manager_v1_global(q_ptr,
+                                     display,
+                                     &wp_cursor_shape_manager_v1_interface,
+                                     &s_interface)
+{
+    create();
+}
+
+void cursor_shape_manager_v1::Private::get_pointer_callback(cursor_shape_manager_v1_bind* bind,
+                                                            uint32_t id,
+                                                            wl_resource* wlPointer)
+{
+    auto pointer = Wayland::Resource<Pointer>::get_handle(wlPointer);
+    new cursor_shape_device_v1_res(bind->client->handle, bind->version, id, pointer);
+}
+
+void cursor_shape_manager_v1::Private::get_tablet_tool_v2_callback(
+    cursor_shape_manager_v1_bind* bind,
+    uint32_t id,
+    [[maybe_unused]] wl_resource* wlTabletTool)
+{
+    // Tablet tools are not supported. The device stays inert.
+    new cursor_shape_device_v1_res(bind->client->handle, bind->version, id, nullptr);
+}
+
+cursor_shape_manager_v1::cursor_shape_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+cursor_shape_manager_v1::~cursor_shape_manager_v1() = default;
+
+cursor_shape_device_v1_res::cursor_shape_device_v1_res(Client* client,
+                                                       uint32_t version,
+                                                       uint32_t id,
+                                                       Pointer* pointer)
+    : pointer{pointer}
+    , impl{new cursor_shape_device_v1_res_impl(client, version, id, this)}
+{
+    if (pointer) {
+        connect(pointer, &Pointer::resourceDestroyed, this, [this] { this->pointer = nullptr; });
+    }
+}
+
+struct wp_cursor_shape_device_v1_interface const cursor_shape_device_v1_res_impl::s_interface = {
+    destroyCallback,
+    set_shape_callback,
+};
+
+cursor_shape_device_v1_res_impl::cursor_shape_device_v1_res_impl(Client* client,
+                                                                 uint32_t version,
+                                                                 uint32_t id,
+                                                                 cursor_shape_device_v1_res* q_ptr)
+    : Wayland::Resource<cursor_shape_device_v1_res>(client,
+                                                    version,
+                                                    id,
+                                                    &wp_cursor_shape_device_v1_interface,
+                                                    &s_interface,
+                                                    q_ptr)
+{
+}
+
+void cursor_shape_device_v1_res_impl::set_shape_callback([[maybe_unused]] wl_client* wlClient,
+                                                         wl_resource* wlResource,
+                                                         uint32_t serial,
+                                                         uint32_t shape)
+{
+    auto res = get_handle(wlResource);
+
+    if (shape < WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_DEFAULT
+        || shape > WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_ZOOM_OUT) {
+        res->impl->postError(WP_CURSOR_SHAPE_DEVICE_V1_ERROR_INVALID_SHAPE, "Invalid shape");
+        return;
+    }
+
+    if (!res->pointer) {
+        return;
+    }
+
+    // The protocol enumerates the shapes in the same order starting from 1.
+    res->pointer->d_ptr->set_cursor_shape(
+        serial, static_cast<cursor_shape>(shape - WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_DEFAULT));
+}
+
+}
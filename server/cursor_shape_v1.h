@@ -0,0 +1,36 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * Global for the wp_cursor_shape_manager_v1 interface.
+ *
+ * Clients set through it named cursor shapes instead of cursor surfaces with their own buffers.
+ * The shape is available through Cursor::shape. Tablet tools are not supported and shapes set
+ * for them are ignored.
+ */
+class WRAPLANDSERVER_EXPORT cursor_shape_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit cursor_shape_manager_v1(Display* display);
+    ~cursor_shape_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
@@ -0,0 +1,71 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "cursor_shape_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <wayland-cursor-shape-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+class Pointer;
+
+constexpr uint32_t cursor_shape_manager_v1_version = 1;
+using cursor_shape_manager_v1_global
+    = Wayland::Global<cursor_shape_manager_v1, cursor_shape_manager_v1_version>;
+using cursor_shape_manager_v1_bind = Wayland::Bind<cursor_shape_manager_v1_global>;
+
+class cursor_shape_manager_v1::Private : public cursor_shape_manager_v1_global
+{
+public:
+    Private(Display* display, cursor_shape_manager_v1* q_ptr);
+
+private:
+    static void
+    get_pointer_callback(cursor_shape_manager_v1_bind* bind, uint32_t id, wl_resource* wlPointer);
+    static void get_tablet_tool_v2_callback(cursor_shape_manager_v1_bind* bind,
+                                            uint32_t id,
+                                            wl_resource* wlTabletTool);
+
+    static struct wp_cursor_shape_manager_v1_interface const s_interface;
+};
+
+class cursor_shape_device_v1_res_impl;
+
+class cursor_shape_device_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    cursor_shape_device_v1_res(Client* client, uint32_t version, uint32_t id, Pointer* pointer);
+
+    Pointer* pointer;
+    cursor_shape_device_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class cursor_shape_device_v1_res_impl : public Wayland::Resource<cursor_shape_device_v1_res>
+{
+public:
+    cursor_shape_device_v1_res_impl(Client* client,
+                                    uint32_t version,
+                                    uint32_t id,
+                                    cursor_shape_device_v1_res* q_ptr);
+
+    static struct wp_cursor_shape_device_v1_interface const s_interface;
+
+private:
+    static void set_shape_callback(wl_client* wlClient,
+                                   wl_resource* wlResource,
+                                   uint32_t serial,
+                                   uint32_t shape);
+};
+
+}
@@ -22,6 +22,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "data_control_v1_p.h"
 #include "data_device_manager.h"
+#include "selection_cache.h"
 #include "selection_p.h"
 
 #include "wayland/resource.h"
@@ -192,6 +193,9 @@ void data_source::accept(std::string const& mimeType) const
 
 void data_source::request_data(std::string const& mimeType, int32_t fd) const
 {
+    if (d_ptr->cache && d_ptr->cache->send(mimeType, fd)) {
+        return;
+    }
     std::visit([&](auto&& res) { res->request_data(mimeType, fd); }, d_ptr->res);
 }
 
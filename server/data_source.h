@@ -57,6 +57,7 @@ private:
     friend class data_control_source_v1_res;
     friend class data_source_ext;
     friend class data_source_res;
+    friend class selection_cache;
     data_source();
 
     class Private;
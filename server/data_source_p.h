@@ -31,6 +31,7 @@ namespace Wrapland::Server
 class data_control_source_v1_res;
 class data_source_ext;
 class data_source_res;
+class selection_cache;
 
 class data_source::Private
 {
@@ -42,6 +43,7 @@ public:
     dnd_actions supportedDnDActions{dnd_action::none};
 
     std::variant<data_source_res*, data_control_source_v1_res*, data_source_ext*> res;
+    selection_cache* cache{nullptr};
 
     data_source* q_ptr;
 };
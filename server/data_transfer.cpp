@@ -0,0 +1,340 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "data_transfer.h"
+
+#include "display.h"
+#include "event_loop.h"
+
+#include <array>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+namespace Wrapland::Server
+{
+
+// Maximal amount of data in flight. Fits the default capacity of a pipe.
+constexpr size_t s_chunk_size{65536};
+
+class data_transfer::Private
+{
+public:
+    Private(Display* display,
+            int32_t source_fd,
+            int32_t receiver_fd,
+            std::chrono::milliseconds timeout,
+            data_transfer* q_ptr);
+    ~Private();
+
+    Private(Private const&) = delete;
+    Private& operator=(Private const&) = delete;
+    Private(Private&&) noexcept = delete;
+    Private& operator=(Private&&) noexcept = delete;
+
+    enum class step {
+        progress,
+        blocked,
+        done,
+        failed,
+    };
+
+    void pump();
+    step read_source();
+    step write_receiver();
+    bool fall_back_to_copy();
+
+    void poll_source();
+    void poll_receiver();
+    void restart_timer();
+
+    void finish();
+    void fail();
+    void end();
+
+    int32_t source_fd;
+    int32_t receiver_fd;
+
+    // Data is moved from the source into the pipe and from there into the receiver.
+    std::array<int, 2> pipe_fds{-1, -1};
+    bool use_splice{true};
+
+    // Used instead of the pipe when a descriptor does not support splice.
+    std::vector<char> buffer;
+    size_t buffer_offset{0};
+
+    // Data read from the source but not yet written to the receiver.
+    size_t pending{0};
+    size_t transferred{0};
+    bool running{true};
+
+    std::chrono::milliseconds timeout;
+
+    std::unique_ptr<fd_notifier> source_notifier;
+    std::unique_ptr<fd_notifier> receiver_notifier;
+    std::unique_ptr<event_timer> timer;
+
+    data_transfer* q_ptr;
+};
+
+data_transfer::Private::Private(Display* display,
+                                int32_t source_fd,
+                                int32_t receiver_fd,
+                                std::chrono::milliseconds timeout,
+                                data_transfer* q_ptr)
+    : source_fd{source_fd}
+    , receiver_fd{receiver_fd}
+    , timeout{timeout}
+    , q_ptr{q_ptr}
+{
+    fcntl(source_fd, F_SETFL, fcntl(source_fd, F_GETFL) | O_NONBLOCK);     // NOLINT
+    fcntl(receiver_fd, F_SETFL, fcntl(receiver_fd, F_GETFL) | O_NONBLOCK); // NOLINT
+
+    if (pipe2(pipe_fds.data(), O_CLOEXEC | O_NONBLOCK) != 0) {
+        pipe_fds = {-1, -1};
+        use_splice = false;
+        buffer.resize(s_chunk_size);
+    }
+
+    source_notifier = std::make_unique<fd_notifier>(
+        display, source_fd, fd_event::readable, [this](auto events) {
+            if (!(events & fd_event::readable) && pending > 0) {
+                // A hang-up is reported even when not polling for data. The source is readable
+                // until its end from now on, so it does not need to be polled anymore.
+                source_notifier.reset();
+                return;
+            }
+            pump();
+        });
+    receiver_notifier = std::make_unique<fd_notifier>(
+        display, receiver_fd, fd_event::none, [this](auto events) {
+            if (events & (fd_event::hangup | fd_event::error)) {
+                fail();
+                return;
+            }
+            pump();
+        });
+
+    if (timeout.count() > 0) {
+        timer = std::make_unique<event_timer>(display, [this] {
+            // Ending destroys the timer together with this callback.
+            auto q_ptr = this->q_ptr;
+            end();
+            Q_EMIT q_ptr->timed_out();
+        });
+    }
+
+    if (!source_notifier->valid() || !receiver_notifier->valid()) {
+        // For example regular files can not be polled. Report it once connections are made.
+        QMetaObject::invokeMethod(
+            q_ptr, [this] { fail(); }, Qt::QueuedConnection);
+        return;
+    }
+
+    restart_timer();
+}
+
+data_transfer::Private::~Private()
+{
+    end();
+}
+
+void data_transfer::Private::pump()
+{
+    auto const before = transferred;
+    auto result = step::progress;
+
+    while (result == step::progress) {
+        result = pending == 0 ? read_source() : write_receiver();
+    }
+
+    if (transferred != before) {
+        restart_timer();
+        Q_EMIT q_ptr->progressed(transferred);
+    }
+
+    if (result == step::done) {
+        finish();
+    } else if (result == step::failed) {
+        fail();
+    }
+}
+
+data_transfer::Private::step data_transfer::Private::read_source()
+{
+    while (true) {
+        ssize_t count{0};
+        if (use_splice) {
+            count = splice(source_fd,
+                           nullptr,
+                           pipe_fds[1],
+                           nullptr,
+                           s_chunk_size,
+                           SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        } else {
+            count = ::read(source_fd, buffer.data(), buffer.size());
+        }
+
+        if (count > 0) {
+            pending = static_cast<size_t>(count);
+            buffer_offset = 0;
+            restart_timer();
+            return step::progress;
+        }
+        if (count == 0) {
+            return step::done;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN) {
+            poll_source();
+            return step::blocked;
+        }
+        if (errno == EINVAL && use_splice && fall_back_to_copy()) {
+            continue;
+        }
+        return step::failed;
+    }
+}
+
+data_transfer::Private::step data_transfer::Private::write_receiver()
+{
+    while (true) {
+        ssize_t count{0};
+        if (use_splice) {
+            count = splice(pipe_fds[0],
+                           nullptr,
+                           receiver_fd,
+                           nullptr,
+                           pending,
+                           SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        } else {
+            count = ::write(receiver_fd, buffer.data() + buffer_offset, pending);
+        }
+
+        if (count > 0) {
+            pending -= static_cast<size_t>(count);
+            buffer_offset += static_cast<size_t>(count);
+            transferred += static_cast<size_t>(count);
+            return step::progress;
+        }
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count < 0 && errno == EAGAIN) {
+            poll_receiver();
+            return step::blocked;
+        }
+        if (count < 0 && errno == EINVAL && use_splice && fall_back_to_copy()) {
+            continue;
+        }
+        return step::failed;
+    }
+}
+
+bool data_transfer::Private::fall_back_to_copy()
+{
+    buffer.resize(s_chunk_size);
+    buffer_offset = 0;
+
+    // Data already in the pipe is moved over to the buffer.
+    size_t drained{0};
+    while (drained < pending) {
+        auto const count = ::read(pipe_fds[0], buffer.data() + drained, pending - drained);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        drained += static_cast<size_t>(count);
+    }
+
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+    pipe_fds = {-1, -1};
+    use_splice = false;
+    return true;
+}
+
+void data_transfer::Private::poll_source()
+{
+    receiver_notifier->set_events(fd_event::none);
+    if (source_notifier) {
+        source_notifier->set_events(fd_event::readable);
+    }
+}
+
+void data_transfer::Private::poll_receiver()
+{
+    if (source_notifier) {
+        source_notifier->set_events(fd_event::none);
+    }
+    receiver_notifier->set_events(fd_event::writable);
+}
+
+void data_transfer::Private::restart_timer()
+{
+    if (timer) {
+        timer->start(timeout);
+    }
+}
+
+void data_transfer::Private::finish()
+{
+    end();
+    Q_EMIT q_ptr->finished();
+}
+
+void data_transfer::Private::fail()
+{
+    if (!running) {
+        return;
+    }
+    end();
+    Q_EMIT q_ptr->failed();
+}
+
+void data_transfer::Private::end()
+{
+    if (!running) {
+        return;
+    }
+    running = false;
+
+    source_notifier.reset();
+    receiver_notifier.reset();
+    timer.reset();
+
+    for (auto fd : {source_fd, receiver_fd, pipe_fds[0], pipe_fds[1]}) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+data_transfer::data_transfer(Display* display,
+                             int32_t source_fd,
+                             int32_t receiver_fd,
+                             std::chrono::milliseconds timeout)
+    : d_ptr{new Private(display, source_fd, receiver_fd, timeout, this)}
+{
+}
+
+data_transfer::~data_transfer() = default;
+
+size_t data_transfer::transferred() const
+{
+    return d_ptr->transferred;
+}
+
+bool data_transfer::running() const
+{
+    return d_ptr->running;
+}
+
+}
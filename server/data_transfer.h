@@ -0,0 +1,62 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace Wrapland::Server
+{
+
+class Display;
+
+/**
+ * Moves selection or drag-and-drop data from a source file descriptor to a receiver file
+ * descriptor. Meant for compositors forwarding data themselves, for example when bridging to X11
+ * or providing a data_source_ext.
+ *
+ * The data is spliced through a pipe in the kernel without copying it to user space. Descriptors
+ * not supporting splice fall back to plain reads and writes. The transfer is driven by the event
+ * loop of the Wayland display and never blocks.
+ *
+ * Ownership of both descriptors is taken and they are closed when the transfer ends. The transfer
+ * ends with exactly one of the signals finished, failed or timed_out. Delete the object with
+ * deleteLater when connected to its signals.
+ */
+class WRAPLANDSERVER_EXPORT data_transfer : public QObject
+{
+    Q_OBJECT
+public:
+    /**
+     * Starts the transfer. It times out when no data could be moved for @p timeout. A zero
+     * timeout disables the timeout.
+     */
+    data_transfer(Display* display,
+                  int32_t source_fd,
+                  int32_t receiver_fd,
+                  std::chrono::milliseconds timeout = std::chrono::seconds(5));
+    ~data_transfer() override;
+
+    /// Bytes written to the receiver so far.
+    size_t transferred() const;
+    bool running() const;
+
+Q_SIGNALS:
+    void progressed(size_t transferred);
+    void finished();
+    void failed();
+    void timed_out();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
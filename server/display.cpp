@@ -21,6 +21,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "client.h"
 #include "client_p.h"
+#include "event_loop_p.h"
 
 #include "wayland/client.h"
 #include "wayland/display.h"
@@ -73,6 +74,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include <EGL/egl.h>
 
 #include <algorithm>
+#include <csignal>
 #include <wayland-server.h>
 
 namespace Wrapland::Server
@@ -81,6 +83,8 @@ namespace Wrapland::Server
 Display::Display()
     : d_ptr(new Wayland::Display(this))
 {
+    // Installed once for the process, see the class documentation.
+    signal(SIGPIPE, SIG_IGN); // NOLINT
 }
 
 Display::~Display() = default;
@@ -190,6 +194,22 @@ Client* Display::createClient(int fd)
     return createClient(wl_client);
 }
 
+void Display::set_client_quota(client_quota const& quota)
+{
+    d_ptr->default_quota = quota;
+    for (auto client : d_ptr->clients()) {
+        client->handle->set_quota(quota);
+    }
+}
+
+void Display::set_client_hang_detection(client_hang_detection const& config)
+{
+    d_ptr->default_hang_detection = config;
+    for (auto client : d_ptr->clients()) {
+        client->handle->set_hang_detection(config);
+    }
+}
+
 void Display::setEglDisplay(void* display)
 {
     if (d_ptr->eglDisplay != EGL_NO_DISPLAY) {
@@ -204,4 +224,17 @@ void* Display::eglDisplay() const
     return d_ptr->eglDisplay;
 }
 
+void Display::write_fd(int fd, QByteArray const& data)
+{
+    fd_writer::start(this, fd, data);
+}
+
+void Display::read_fd(int fd,
+                      size_t max_size,
+                      QObject* context,
+                      std::function<void(std::optional<QByteArray>)> callback)
+{
+    fd_reader::start(this, fd, max_size, context, std::move(callback));
+}
+
 }
@@ -21,9 +21,12 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <Wrapland/Server/wraplandserver_export.h>
 
+#include <QByteArray>
 #include <QObject>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -34,28 +37,39 @@ namespace Wrapland::Server
 {
 
 class Client;
+struct client_hang_detection;
+struct client_quota;
 class WlOutput;
 
 class AppmenuManager;
 class BlurManager;
+class commit_timing_manager_v1;
 class Compositor;
+class content_type_manager_v1;
 class ContrastManager;
+class cursor_shape_manager_v1;
 class data_control_manager_v1;
 class data_device_manager;
 class DpmsManager;
 class drm_lease_device_v1;
 class FakeInput;
+class fifo_manager_v1;
+class fractional_scale_manager_v1;
 class IdleInhibitManagerV1;
 class idle_notifier_v1;
+class image_copy_capture_manager_v1;
 class input_method_manager_v2;
 class kde_idle;
 class KeyboardShortcutsInhibitManagerV1;
 class KeyState;
 class LayerShellV1;
 class linux_dmabuf_v1;
+class linux_drm_syncobj_manager_v1;
 class output;
+class output_image_capture_source_manager_v1;
 class plasma_activation_feedback;
 class PlasmaShell;
+class plasma_stacking_order_manager_v1;
 class PlasmaVirtualDesktopManager;
 class PlasmaWindowManager;
 class PointerConstraintsV1;
@@ -67,8 +81,10 @@ class Seat;
 class security_context_manager_v1;
 class ServerSideDecorationPaletteManager;
 class ShadowManager;
+class single_pixel_buffer_manager_v1;
 class SlideManager;
 class Subcompositor;
+class tearing_control_manager_v1;
 class text_input_manager_v2;
 class text_input_manager_v3;
 class Viewporter;
@@ -84,6 +100,12 @@ namespace Wayland
 {
 class Display;
 }
+/**
+ * The Wayland display of the compositor.
+ *
+ * Creating it ignores SIGPIPE for the whole process. Data is passed between clients through pipes
+ * they provide, and writing to a pipe whose reader went away must not terminate the compositor.
+ */
 class WRAPLANDSERVER_EXPORT Display : public QObject
 {
     Q_OBJECT
@@ -118,9 +140,39 @@ public:
     Client* createClient(wl_client* client);
     Client* createClient(int fd);
 
+    /**
+     * Applies @p quota to all connected clients and to clients connecting later. It can be
+     * overridden per client with Client::set_quota.
+     */
+    void set_client_quota(client_quota const& quota);
+
+    /**
+     * Applies @p config to all connected clients and to clients connecting later. It can be
+     * overridden per client with Client::set_hang_detection.
+     */
+    void set_client_hang_detection(client_hang_detection const& config);
+
     void setEglDisplay(void* display);
     void* eglDisplay() const;
 
+    /**
+     * Writes @p data to @p fd on the event loop without blocking. Takes ownership of @p fd and
+     * closes it when all data is written or the receiver went away. The display must be started.
+     *
+     * See also fd_notifier and event_timer for other asynchronous work on the event loop.
+     */
+    void write_fd(int fd, QByteArray const& data);
+
+    /**
+     * Reads from @p fd on the event loop until its end without blocking. Takes ownership of @p fd.
+     * The data is passed to @p callback, or nothing on error or when it exceeds @p max_size bytes.
+     * Reading is cancelled when @p context is destroyed before. The display must be started.
+     */
+    void read_fd(int fd,
+                 size_t max_size,
+                 QObject* context,
+                 std::function<void(std::optional<QByteArray>)> callback);
+
     struct {
         /// Basic graphical operations
         Server::Compositor* compositor{nullptr};
@@ -128,6 +180,17 @@ public:
         Server::linux_dmabuf_v1* linux_dmabuf_v1{nullptr};
         Server::Viewporter* viewporter{nullptr};
         Server::PresentationManager* presentation_manager{nullptr};
+        Server::single_pixel_buffer_manager_v1* single_pixel_buffer_manager_v1{nullptr};
+        Server::linux_drm_syncobj_manager_v1* linux_drm_syncobj_manager_v1{nullptr};
+        Server::tearing_control_manager_v1* tearing_control_manager_v1{nullptr};
+        Server::fractional_scale_manager_v1* fractional_scale_manager_v1{nullptr};
+        Server::fifo_manager_v1* fifo_manager_v1{nullptr};
+        Server::commit_timing_manager_v1* commit_timing_manager_v1{nullptr};
+        Server::content_type_manager_v1* content_type_manager_v1{nullptr};
+        Server::cursor_shape_manager_v1* cursor_shape_manager_v1{nullptr};
+        Server::output_image_capture_source_manager_v1* output_image_capture_source_manager_v1{
+            nullptr};
+        Server::image_copy_capture_manager_v1* image_copy_capture_manager_v1{nullptr};
 
         /// Additional graphical effects
         Server::ShadowManager* shadow_manager{nullptr};
@@ -178,6 +241,7 @@ public:
         Server::PlasmaVirtualDesktopManager* plasma_virtual_desktop_manager{nullptr};
         Server::PlasmaShell* plasma_shell{nullptr};
         Server::PlasmaWindowManager* plasma_window_manager{nullptr};
+        Server::plasma_stacking_order_manager_v1* plasma_stacking_order_manager_v1{nullptr};
 
         /// Hardware take-over and blocking
         Server::idle_notifier_v1* idle_notifier_v1{nullptr};
@@ -0,0 +1,355 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "event_loop.h"
+#include "event_loop_p.h"
+
+#include "display.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Wrapland::Server
+{
+
+namespace
+{
+
+uint32_t to_wl_mask(fd_events events)
+{
+    uint32_t mask{0};
+    if (events.testFlag(fd_event::readable)) {
+        mask |= WL_EVENT_READABLE;
+    }
+    if (events.testFlag(fd_event::writable)) {
+        mask |= WL_EVENT_WRITABLE;
+    }
+    return mask;
+}
+
+fd_events from_wl_mask(uint32_t mask)
+{
+    fd_events events;
+    if (mask & WL_EVENT_READABLE) {
+        events |= fd_event::readable;
+    }
+    if (mask & WL_EVENT_WRITABLE) {
+        events |= fd_event::writable;
+    }
+    if (mask & WL_EVENT_HANGUP) {
+        events |= fd_event::hangup;
+    }
+    if (mask & WL_EVENT_ERROR) {
+        events |= fd_event::error;
+    }
+    return events;
+}
+
+void set_non_blocking(int fd)
+{
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK); // NOLINT
+}
+
+wl_event_loop* get_event_loop(Display* display)
+{
+    // The native display only exists after the display has been started.
+    assert(display->native());
+    return wl_display_get_event_loop(display->native());
+}
+
+}
+
+loop_source::loop_source(Display* display, std::function<void()> loop_destroyed)
+    : loop{get_event_loop(display)}
+    , loop_destroyed{std::move(loop_destroyed)}
+{
+    destroy_wrapper.source = this;
+    destroy_wrapper.listener.notify = destroy_callback;
+    wl_event_loop_add_destroy_listener(loop, &destroy_wrapper.listener);
+}
+
+loop_source::~loop_source()
+{
+    remove();
+}
+
+void loop_source::add_fd(int fd, uint32_t mask, wl_event_loop_fd_func_t func, void* data)
+{
+    source = wl_event_loop_add_fd(loop, fd, mask, func, data);
+}
+
+void loop_source::add_timer(wl_event_loop_timer_func_t func, void* data)
+{
+    source = wl_event_loop_add_timer(loop, func, data);
+}
+
+void loop_source::remove()
+{
+    if (!loop) {
+        return;
+    }
+    if (source) {
+        wl_event_source_remove(source);
+        source = nullptr;
+    }
+    wl_list_remove(&destroy_wrapper.listener.link);
+    loop = nullptr;
+}
+
+void loop_source::destroy_callback(wl_listener* listener, void* /*data*/)
+{
+    // See Wayland::Client::destroyListenerCallback for why wl_container_of is used this way.
+    // NOLINTNEXTLINE
+    decltype(destroy_wrapper)* wrapper = wl_container_of(listener, wrapper, listener);
+    auto src = wrapper->source;
+
+    src->remove();
+    if (src->loop_destroyed) {
+        src->loop_destroyed();
+    }
+}
+
+class fd_notifier::Private
+{
+public:
+    Private(Display* display, int fd, std::function<void(fd_events)> callback)
+        : fd{fd}
+        , callback{std::move(callback)}
+        , src{display}
+    {
+    }
+
+    static int fd_callback(int /*fd*/, uint32_t mask, void* data)
+    {
+        // The notifier might be destroyed in the callback. Nothing is accessed afterwards.
+        auto priv = static_cast<Private*>(data);
+        priv->callback(from_wl_mask(mask));
+        return 0;
+    }
+
+    int fd;
+    std::function<void(fd_events)> callback;
+    loop_source src;
+};
+
+fd_notifier::fd_notifier(Display* display,
+                         int fd,
+                         fd_events events,
+                         std::function<void(fd_events)> callback)
+    : d_ptr{new Private(display, fd, std::move(callback))}
+{
+    d_ptr->src.add_fd(fd, to_wl_mask(events), Private::fd_callback, d_ptr.get());
+}
+
+fd_notifier::~fd_notifier() = default;
+
+int fd_notifier::fd() const
+{
+    return d_ptr->fd;
+}
+
+void fd_notifier::set_events(fd_events events)
+{
+    if (d_ptr->src.source) {
+        wl_event_source_fd_update(d_ptr->src.source, to_wl_mask(events));
+    }
+}
+
+bool fd_notifier::valid() const
+{
+    return d_ptr->src.source;
+}
+
+class event_timer::Private
+{
+public:
+    Private(Display* display, std::function<void()> callback)
+        : callback{std::move(callback)}
+        , src{display}
+    {
+        src.add_timer(timer_callback, this);
+    }
+
+    static int timer_callback(void* data)
+    {
+        // The timer might be destroyed in the callback. Nothing is accessed afterwards.
+        auto priv = static_cast<Private*>(data);
+        priv->active = false;
+        priv->callback();
+        return 0;
+    }
+
+    std::function<void()> callback;
+    bool active{false};
+    loop_source src;
+};
+
+event_timer::event_timer(Display* display, std::function<void()> callback)
+    : d_ptr{new Private(display, std::move(callback))}
+{
+}
+
+event_timer::~event_timer() = default;
+
+void event_timer::start(std::chrono::milliseconds interval)
+{
+    if (!d_ptr->src.source) {
+        return;
+    }
+
+    // Zero would disarm the timer.
+    auto const msec = std::max<int64_t>(interval.count(), 1);
+    wl_event_source_timer_update(d_ptr->src.source, static_cast<int>(msec));
+    d_ptr->active = true;
+}
+
+void event_timer::stop()
+{
+    if (d_ptr->src.source) {
+        wl_event_source_timer_update(d_ptr->src.source, 0);
+    }
+    d_ptr->active = false;
+}
+
+bool event_timer::active() const
+{
+    return d_ptr->active;
+}
+
+void fd_writer::start(Display* display, int fd, QByteArray const& data)
+{
+    auto writer = new fd_writer(display, fd, data);
+    writer->write();
+}
+
+fd_writer::fd_writer(Display* display, int fd, QByteArray const& data)
+    : fd{fd}
+    , data{data}
+    , src{display, [this] { delete this; }}
+{
+    set_non_blocking(fd);
+    src.add_fd(fd, WL_EVENT_WRITABLE, fd_callback, this);
+}
+
+fd_writer::~fd_writer()
+{
+    close(fd);
+}
+
+void fd_writer::write()
+{
+    while (offset < data.size()) {
+        auto const count = ::write(
+            fd, data.constData() + offset, static_cast<size_t>(data.size() - offset));
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN && src.source) {
+                return;
+            }
+            break;
+        }
+        offset += count;
+    }
+
+    // All written or the receiver went away.
+    delete this;
+}
+
+int fd_writer::fd_callback(int /*fd*/, uint32_t mask, void* data)
+{
+    auto writer = static_cast<fd_writer*>(data);
+    if (mask & (WL_EVENT_HANGUP | WL_EVENT_ERROR)) {
+        delete writer;
+        return 0;
+    }
+    writer->write();
+    return 0;
+}
+
+void fd_reader::start(Display* display,
+                      int fd,
+                      size_t max_size,
+                      QObject* context,
+                      callback_t callback)
+{
+    auto reader = new fd_reader(display, fd, max_size, context, std::move(callback));
+    reader->read();
+}
+
+fd_reader::fd_reader(Display* display,
+                     int fd,
+                     size_t max_size,
+                     QObject* context,
+                     callback_t callback)
+    : fd{fd}
+    , max_size{max_size}
+    , callback{std::move(callback)}
+    , src{display, [this] { delete this; }}
+{
+    if (context) {
+        context_connection
+            = QObject::connect(context, &QObject::destroyed, [this] { delete this; });
+    }
+
+    set_non_blocking(fd);
+    src.add_fd(fd, WL_EVENT_READABLE, fd_callback, this);
+}
+
+fd_reader::~fd_reader()
+{
+    QObject::disconnect(context_connection);
+    close(fd);
+}
+
+void fd_reader::read()
+{
+    std::array<char, 4096> buffer{};
+
+    while (true) {
+        auto const count = ::read(fd, buffer.data(), buffer.size());
+        if (count > 0) {
+            if (static_cast<size_t>(data.size() + count) > max_size) {
+                finish(std::nullopt);
+                return;
+            }
+            data.append(buffer.data(), count);
+            continue;
+        }
+        if (count == 0) {
+            finish(data);
+            return;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno != EAGAIN || !src.source) {
+            finish(std::nullopt);
+        }
+        return;
+    }
+}
+
+void fd_reader::finish(std::optional<QByteArray> result)
+{
+    // The callback might start new reads. This one is gone before.
+    auto finish_callback = std::move(callback);
+    delete this;
+    finish_callback(std::move(result));
+}
+
+int fd_reader::fd_callback(int /*fd*/, uint32_t /*mask*/, void* data)
+{
+    // On a hang-up data might still be available. Reading tells the end.
+    static_cast<fd_reader*>(data)->read();
+    return 0;
+}
+
+}
@@ -0,0 +1,87 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QFlags>
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace Wrapland::Server
+{
+
+class Display;
+
+enum class fd_event {
+    none = 0,
+    readable = 1 << 0,
+    writable = 1 << 1,
+    hangup = 1 << 2,
+    error = 1 << 3,
+};
+Q_DECLARE_FLAGS(fd_events, fd_event)
+
+/**
+ * Watches a file descriptor on the event loop of a started Display. The callback is called with
+ * the events that occurred. Hang-ups and errors are reported also when not asked for.
+ *
+ * The file descriptor is not owned. Watching stops when the notifier is destroyed or the display
+ * is terminated.
+ */
+class WRAPLANDSERVER_EXPORT fd_notifier
+{
+public:
+    fd_notifier(Display* display,
+                int fd,
+                fd_events events,
+                std::function<void(fd_events)> callback);
+    ~fd_notifier();
+
+    fd_notifier(fd_notifier const&) = delete;
+    fd_notifier& operator=(fd_notifier const&) = delete;
+    fd_notifier(fd_notifier&&) noexcept = delete;
+    fd_notifier& operator=(fd_notifier&&) noexcept = delete;
+
+    int fd() const;
+    void set_events(fd_events events);
+
+    /// Whether the file descriptor is watched. False when it can not be polled.
+    bool valid() const;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+/**
+ * Single-shot timer on the event loop of a started Display.
+ */
+class WRAPLANDSERVER_EXPORT event_timer
+{
+public:
+    event_timer(Display* display, std::function<void()> callback);
+    ~event_timer();
+
+    event_timer(event_timer const&) = delete;
+    event_timer& operator=(event_timer const&) = delete;
+    event_timer(event_timer&&) noexcept = delete;
+    event_timer& operator=(event_timer&&) noexcept = delete;
+
+    /// Starts the timer or restarts it when already running.
+    void start(std::chrono::milliseconds interval);
+    void stop();
+    bool active() const;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(Wrapland::Server::fd_events)
@@ -0,0 +1,104 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "event_loop.h"
+
+#include <QByteArray>
+#include <QObject>
+#include <optional>
+#include <wayland-server.h>
+
+namespace Wrapland::Server
+{
+
+/**
+ * An event source that is removed together with its loop. Then @p loop_destroyed is called.
+ */
+class loop_source
+{
+public:
+    loop_source(Display* display, std::function<void()> loop_destroyed = {});
+    ~loop_source();
+
+    loop_source(loop_source const&) = delete;
+    loop_source& operator=(loop_source const&) = delete;
+    loop_source(loop_source&&) noexcept = delete;
+    loop_source& operator=(loop_source&&) noexcept = delete;
+
+    void add_fd(int fd, uint32_t mask, wl_event_loop_fd_func_t func, void* data);
+    void add_timer(wl_event_loop_timer_func_t func, void* data);
+
+    wl_event_source* source{nullptr};
+
+private:
+    void remove();
+    static void destroy_callback(wl_listener* listener, void* data);
+
+    wl_event_loop* loop{nullptr};
+    std::function<void()> loop_destroyed;
+
+    struct {
+        wl_listener listener;
+        loop_source* source;
+    } destroy_wrapper;
+};
+
+/// Writes data to a file descriptor without blocking and closes it afterwards.
+class fd_writer
+{
+public:
+    static void start(Display* display, int fd, QByteArray const& data);
+
+    fd_writer(fd_writer const&) = delete;
+    fd_writer& operator=(fd_writer const&) = delete;
+    fd_writer(fd_writer&&) noexcept = delete;
+    fd_writer& operator=(fd_writer&&) noexcept = delete;
+
+private:
+    fd_writer(Display* display, int fd, QByteArray const& data);
+    ~fd_writer();
+
+    void write();
+    static int fd_callback(int fd, uint32_t mask, void* data);
+
+    int fd;
+    QByteArray data;
+    qsizetype offset{0};
+    loop_source src;
+};
+
+/// Reads from a file descriptor until its end without blocking and closes it afterwards.
+class fd_reader
+{
+public:
+    using callback_t = std::function<void(std::optional<QByteArray>)>;
+
+    static void
+    start(Display* display, int fd, size_t max_size, QObject* context, callback_t callback);
+
+    fd_reader(fd_reader const&) = delete;
+    fd_reader& operator=(fd_reader const&) = delete;
+    fd_reader(fd_reader&&) noexcept = delete;
+    fd_reader& operator=(fd_reader&&) noexcept = delete;
+
+private:
+    fd_reader(Display* display, int fd, size_t max_size, QObject* context, callback_t callback);
+    ~fd_reader();
+
+    void read();
+    void finish(std::optional<QByteArray> result);
+    static int fd_callback(int fd, uint32_t mask, void* data);
+
+    int fd;
+    size_t max_size;
+    QByteArray data;
+    callback_t callback;
+    QMetaObject::Connection context_connection;
+    loop_source src;
+};
+
+}
@@ -0,0 +1,100 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "fifo_v1_p.h"
+
+#include "client.h"
+#include "display.h"
+#include "surface_p.h"
+
+namespace Wrapland::Server
+{
+
+struct wp_fifo_manager_v1_interface const fifo_manager_v1::Private::s_interface = {
+    resourceDestroyCallback,
+    cb<get_fifo_callback>,
+};
+
+fifo_manager_v1::Private::Private(Display* display, fifo_manager_v1* q_ptr)
+    : fifo_manager_v1_global(q_ptr, display, &wp_fifo_manager_v1_interface, &s_interface)
+{
+    create();
+}
+
+void fifo_manager_v1::Private::get_fifo_callback(fifo_manager_v1_bind* bind,
+                                                 uint32_t id,
+                                                 wl_resource* wlSurface)
+{
+    auto surface = Wayland::Resource<Surface>::get_handle(wlSurface);
+
+    if (surface->d_ptr->fifo) {
+        bind->post_error(WP_FIFO_MANAGER_V1_ERROR_ALREADY_EXISTS,
+                         "Surface already has a fifo object");
+        return;
+    }
+
+    auto fifo = new fifo_v1_res(bind->client->handle, bind->version, id, surface);
+    surface->d_ptr->install_fifo(fifo);
+}
+
+fifo_manager_v1::fifo_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+fifo_manager_v1::~fifo_manager_v1() = default;
+
+fifo_v1_res::fifo_v1_res(Client* client, uint32_t version, uint32_t id, Surface* surface)
+    : surface{surface}
+    , impl{new fifo_v1_res_impl(client, version, id, this)}
+{
+    connect(surface, &Surface::resourceDestroyed, this, [this] { this->surface = nullptr; });
+}
+
+struct wp_fifo_v1_interface const fifo_v1_res_impl::s_interface = {
+    set_barrier_callback,
+    wait_barrier_callback,
+    destroyCallback,
+};
+
+fifo_v1_res_impl::fifo_v1_res_impl(Client* client,
+                                   uint32_t version,
+                                   uint32_t id,
+                                   fifo_v1_res* q_ptr)
+    : Wayland::Resource<fifo_v1_res>(client,
+                                     version,
+                                     id,
+                                     &wp_fifo_v1_interface,
+                                     &s_interface,
+                                     q_ptr)
+{
+}
+
+Surface* fifo_v1_res_impl::get_surface(wl_resource* wlResource)
+{
+    auto res = get_handle(wlResource);
+    if (!res->surface) {
+        res->impl->postError(WP_FIFO_V1_ERROR_SURFACE_DESTROYED, "Surface was destroyed");
+    }
+    return res->surface;
+}
+
+void fifo_v1_res_impl::set_barrier_callback([[maybe_unused]] wl_client* wlClient,
+                                            wl_resource* wlResource)
+{
+    if (auto surface = get_surface(wlResource)) {
+        surface->d_ptr->pending.fifo_barrier = true;
+    }
+}
+
+void fifo_v1_res_impl::wait_barrier_callback([[maybe_unused]] wl_client* wlClient,
+                                             wl_resource* wlResource)
+{
+    if (auto surface = get_surface(wlResource)) {
+        surface->d_ptr->pending.fifo_wait = true;
+    }
+}
+
+}
@@ -0,0 +1,35 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * Global for the wp_fifo_manager_v1 interface.
+ *
+ * Clients use it to present at most one commit per refresh cycle. Commits waiting on a FIFO
+ * barrier are queued on the Surface until the compositor calls Surface::apply_queued_commits.
+ */
+class WRAPLANDSERVER_EXPORT fifo_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit fifo_manager_v1(Display* display);
+    ~fifo_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
@@ -0,0 +1,63 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "fifo_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <wayland-fifo-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+class Surface;
+
+constexpr uint32_t fifo_manager_v1_version = 1;
+using fifo_manager_v1_global = Wayland::Global<fifo_manager_v1, fifo_manager_v1_version>;
+using fifo_manager_v1_bind = Wayland::Bind<fifo_manager_v1_global>;
+
+class fifo_manager_v1::Private : public fifo_manager_v1_global
+{
+public:
+    Private(Display* display, fifo_manager_v1* q_ptr);
+
+private:
+    static void get_fifo_callback(fifo_manager_v1_bind* bind, uint32_t id, wl_resource* wlSurface);
+
+    static struct wp_fifo_manager_v1_interface const s_interface;
+};
+
+class fifo_v1_res_impl;
+
+class fifo_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    fifo_v1_res(Client* client, uint32_t version, uint32_t id, Surface* surface);
+
+    Surface* surface;
+    fifo_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class fifo_v1_res_impl : public Wayland::Resource<fifo_v1_res>
+{
+public:
+    fifo_v1_res_impl(Client* client, uint32_t version, uint32_t id, fifo_v1_res* q_ptr);
+
+    static struct wp_fifo_v1_interface const s_interface;
+
+private:
+    static Surface* get_surface(wl_resource* wlResource);
+
+    static void set_barrier_callback(wl_client* wlClient, wl_resource* wlResource);
+    static void wait_barrier_callback(wl_client* wlClient, wl_resource* wlResource);
+};
+
+}
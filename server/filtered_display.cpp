@@ -24,6 +24,8 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <QByteArray>
 
+#include <unordered_map>
+
 namespace Wrapland::Server
 {
 
@@ -34,6 +36,8 @@ public:
 
     static bool filterCallback(wl_client const* wlClient, wl_global const* wlGlobal, void* data);
 
+    std::unordered_map<Client*, std::unordered_map<wl_interface const*, bool>> decisions;
+
 private:
     FilteredDisplay* q_ptr;
 };
@@ -60,9 +64,17 @@ bool FilteredDisplay::Private::filterCallback(wl_client const* wlClient,
     }
 
     auto interface = wl_global_get_interface(wlGlobal);
+    auto& client_decisions = priv->decisions[client];
+
+    if (auto it = client_decisions.find(interface); it != client_decisions.end()) {
+        return it->second;
+    }
+
     auto name = QByteArray::fromRawData(interface->name, static_cast<int>(strlen(interface->name)));
+    auto const allowed = priv->q_ptr->allowInterface(client, name);
 
-    return priv->q_ptr->allowInterface(client, name);
+    client_decisions.insert({interface, allowed});
+    return allowed;
 }
 
 FilteredDisplay::FilteredDisplay()
@@ -71,6 +83,9 @@ FilteredDisplay::FilteredDisplay()
     connect(this, &Display::started, [this]() {
         wl_display_set_global_filter(native(), Private::filterCallback, d_ptr.get());
     });
+    connect(this, &Display::clientDisconnected, this, [this](auto client) {
+        d_ptr->decisions.erase(client);
+    });
 }
 
 FilteredDisplay::~FilteredDisplay()
@@ -78,4 +93,9 @@ FilteredDisplay::~FilteredDisplay()
     wl_display_set_global_filter(native(), nullptr, nullptr);
 }
 
+void FilteredDisplay::invalidate_filter(Client* client)
+{
+    d_ptr->decisions.erase(client);
+}
+
 }
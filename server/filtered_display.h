@@ -48,9 +48,18 @@ public:
      *
      * @return true if the client should be able to access the global with the following
      * interfaceName
+     *
+     * The decision is cached per client and interface. Call @ref invalidate_filter when it
+     * changes for a client.
      */
     virtual bool allowInterface(Client* client, QByteArray const& interfaceName) = 0;
 
+    /**
+     * Drops the cached decisions of @ref allowInterface for @arg client. They are queried again
+     * the next time globals are announced to or bound by the client.
+     */
+    void invalidate_filter(Client* client);
+
 private:
     class Private;
     std::unique_ptr<Private> d_ptr;
@@ -0,0 +1,87 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "fractional_scale_v1_p.h"
+
+#include "client.h"
+#include "display.h"
+#include "surface_p.h"
+
+#include <cmath>
+
+namespace Wrapland::Server
+{
+
+struct wp_fractional_scale_manager_v1_interface const
+    fractional_scale_manager_v1::Private::s_interface
+    = {
+        resourceDestroyCallback,
+        cb<get_fractional_scale_callback>,
+};
+
+fractional_scale_manager_v1::Private::Private(Display* display,
+                                              fractional_scale_manager_v1* q_ptr)
+    : fractional_scale_manager_v1_global(q_ptr,
+                                         display,
+                                         &wp_fractional_scale_manager_v1_interface,
+                                         &s_interface)
+{
+    create();
+}
+
+void fractional_scale_manager_v1::Private::get_fractional_scale_callback(
+    fractional_scale_manager_v1_bind* bind,
+    uint32_t id,
+    wl_resource* wlSurface)
+{
+    auto surface = Wayland::Resource<Surface>::get_handle(wlSurface);
+
+    if (surface->d_ptr->fractional_scale) {
+        bind->post_error(WP_FRACTIONAL_SCALE_MANAGER_V1_ERROR_FRACTIONAL_SCALE_EXISTS,
+                         "Surface already has a fractional scale object");
+        return;
+    }
+
+    auto fractional_scale = new fractional_scale_v1_res(bind->client->handle, bind->version, id);
+    surface->d_ptr->install_fractional_scale(fractional_scale);
+}
+
+fractional_scale_manager_v1::fractional_scale_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+fractional_scale_manager_v1::~fractional_scale_manager_v1() = default;
+
+fractional_scale_v1_res::fractional_scale_v1_res(Client* client, uint32_t version, uint32_t id)
+    : impl{new fractional_scale_v1_res_impl(client, version, id, this)}
+{
+}
+
+void fractional_scale_v1_res::send_preferred_scale(double scale)
+{
+    // The scale is sent as numerator of a fraction with denominator 120.
+    impl->send<wp_fractional_scale_v1_send_preferred_scale>(
+        static_cast<uint32_t>(std::lround(scale * 120)));
+}
+
+struct wp_fractional_scale_v1_interface const fractional_scale_v1_res_impl::s_interface = {
+    destroyCallback,
+};
+
+fractional_scale_v1_res_impl::fractional_scale_v1_res_impl(Client* client,
+                                                           uint32_t version,
+                                                           uint32_t id,
+                                                           fractional_scale_v1_res* q_ptr)
+    : Wayland::Resource<fractional_scale_v1_res>(client,
+                                                 version,
+                                                 id,
+                                                 &wp_fractional_scale_v1_interface,
+                                                 &s_interface,
+                                                 q_ptr)
+{
+}
+
+}
@@ -0,0 +1,35 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * Global for the wp_fractional_scale_manager_v1 interface.
+ *
+ * Clients use it to receive the scale set with Surface::set_preferred_scale. They then render
+ * their buffers at that scale and set the logical size through a Viewport destination size.
+ */
+class WRAPLANDSERVER_EXPORT fractional_scale_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit fractional_scale_manager_v1(Display* display);
+    ~fractional_scale_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
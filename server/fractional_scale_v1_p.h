@@ -0,0 +1,64 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "fractional_scale_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <wayland-fractional-scale-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+class Surface;
+
+constexpr uint32_t fractional_scale_manager_v1_version = 1;
+using fractional_scale_manager_v1_global
+    = Wayland::Global<fractional_scale_manager_v1, fractional_scale_manager_v1_version>;
+using fractional_scale_manager_v1_bind = Wayland::Bind<fractional_scale_manager_v1_global>;
+
+class fractional_scale_manager_v1::Private : public fractional_scale_manager_v1_global
+{
+public:
+    Private(Display* display, fractional_scale_manager_v1* q_ptr);
+
+private:
+    static void get_fractional_scale_callback(fractional_scale_manager_v1_bind* bind,
+                                              uint32_t id,
+                                              wl_resource* wlSurface);
+
+    static struct wp_fractional_scale_manager_v1_interface const s_interface;
+};
+
+class fractional_scale_v1_res_impl;
+
+class fractional_scale_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    fractional_scale_v1_res(Client* client, uint32_t version, uint32_t id);
+
+    void send_preferred_scale(double scale);
+
+    fractional_scale_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class fractional_scale_v1_res_impl : public Wayland::Resource<fractional_scale_v1_res>
+{
+public:
+    fractional_scale_v1_res_impl(Client* client,
+                                 uint32_t version,
+                                 uint32_t id,
+                                 fractional_scale_v1_res* q_ptr);
+
+    static struct wp_fractional_scale_v1_interface const s_interface;
+};
+
+}
@@ -0,0 +1,171 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "frame_callback_scheduler.h"
+
+#include "compositor.h"
+#include "output.h"
+#include "subcompositor.h"
+#include "surface_p.h"
+
+#include <QTimer>
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+namespace Wrapland::Server
+{
+
+class frame_callback_scheduler::Private
+{
+public:
+    Private(Compositor* compositor, frame_callback_scheduler* q_ptr);
+
+    void add_surface(Surface* surface);
+    void remove_surface(Surface* surface);
+
+    template<typename Predicate>
+    void flush_if(Predicate predicate, uint32_t msec);
+    void flush_offscreen();
+
+    static Surface* root_surface(Surface* surface);
+
+    void push_pending(Surface* surface);
+
+    // Surfaces with committed frame callbacks in commit order.
+    std::vector<Surface*> pending;
+    // The same surfaces for checking on every commit if a surface is pending already.
+    std::unordered_set<Surface*> pending_set;
+
+    std::chrono::milliseconds offscreen_interval{0};
+    QTimer offscreen_timer;
+
+private:
+    frame_callback_scheduler* q_ptr;
+};
+
+frame_callback_scheduler::Private::Private(Compositor* compositor,
+                                           frame_callback_scheduler* q_ptr)
+    : q_ptr{q_ptr}
+{
+    QObject::connect(compositor, &Compositor::surfaceCreated, q_ptr, [this](auto surface) {
+        add_surface(surface);
+    });
+    QObject::connect(&offscreen_timer, &QTimer::timeout, q_ptr, [this] { flush_offscreen(); });
+}
+
+void frame_callback_scheduler::Private::add_surface(Surface* surface)
+{
+    QObject::connect(surface, &Surface::committed, q_ptr, [this, surface] {
+        if (!(surface->state().updates & surface_change::frame)) {
+            return;
+        }
+        push_pending(surface);
+    });
+    QObject::connect(surface, &Surface::resourceDestroyed, q_ptr, [this, surface] {
+        remove_surface(surface);
+    });
+}
+
+void frame_callback_scheduler::Private::remove_surface(Surface* surface)
+{
+    if (pending_set.erase(surface)) {
+        pending.erase(std::remove(pending.begin(), pending.end(), surface), pending.end());
+    }
+}
+
+void frame_callback_scheduler::Private::push_pending(Surface* surface)
+{
+    if (pending_set.insert(surface).second) {
+        pending.push_back(surface);
+    }
+}
+
+template<typename Predicate>
+void frame_callback_scheduler::Private::flush_if(Predicate predicate, uint32_t msec)
+{
+    auto it = std::stable_partition(
+        pending.begin(), pending.end(), [&predicate](auto surface) { return !predicate(surface); });
+
+    std::vector<Surface*> flushed(it, pending.end());
+    pending.erase(it, pending.end());
+    for (auto surface : flushed) {
+        pending_set.erase(surface);
+    }
+
+    for (auto surface : flushed) {
+        if (!surface->d_ptr->send_frame_callbacks(msec)) {
+            // Withheld because of the visibility hint. Try again on a later flush.
+            push_pending(surface);
+        }
+    }
+}
+
+void frame_callback_scheduler::Private::flush_offscreen()
+{
+    auto const now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch());
+
+    flush_if([](auto surface) { return root_surface(surface)->outputs().empty(); },
+             static_cast<uint32_t>(now.count()));
+}
+
+Surface* frame_callback_scheduler::Private::root_surface(Surface* surface)
+{
+    while (surface->subsurface() && surface->subsurface()->parentSurface()) {
+        surface = surface->subsurface()->parentSurface();
+    }
+    return surface;
+}
+
+frame_callback_scheduler::frame_callback_scheduler(Compositor* compositor)
+    : d_ptr(new Private(compositor, this))
+{
+}
+
+frame_callback_scheduler::~frame_callback_scheduler() = default;
+
+void frame_callback_scheduler::flush(output* output, uint32_t msec)
+{
+    auto wayland_output = output->wayland_output();
+
+    d_ptr->flush_if(
+        [wayland_output](auto surface) {
+            auto const outputs = Private::root_surface(surface)->outputs();
+            return std::find(outputs.cbegin(), outputs.cend(), wayland_output) != outputs.cend();
+        },
+        msec);
+}
+
+void frame_callback_scheduler::flush(Surface* surface, uint32_t msec)
+{
+    if (surface->d_ptr->send_frame_callbacks(msec)) {
+        d_ptr->remove_surface(surface);
+    }
+}
+
+bool frame_callback_scheduler::has_pending(Surface* surface) const
+{
+    return d_ptr->pending_set.count(surface) > 0;
+}
+
+std::chrono::milliseconds frame_callback_scheduler::offscreen_interval() const
+{
+    return d_ptr->offscreen_interval;
+}
+
+void frame_callback_scheduler::set_offscreen_interval(std::chrono::milliseconds interval)
+{
+    d_ptr->offscreen_interval = std::max(interval, std::chrono::milliseconds::zero());
+
+    if (d_ptr->offscreen_interval.count() == 0) {
+        d_ptr->offscreen_timer.stop();
+        return;
+    }
+    d_ptr->offscreen_timer.start(d_ptr->offscreen_interval);
+}
+
+}
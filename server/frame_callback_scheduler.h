@@ -0,0 +1,66 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <chrono>
+#include <memory>
+
+namespace Wrapland::Server
+{
+
+class Compositor;
+class output;
+class Surface;
+
+/**
+ * Tracks surfaces with pending frame callbacks and sends them per output.
+ *
+ * Instead of calling Surface::frameRendered on every visible surface after a repaint a compositor
+ * calls flush once per output vblank. Only surfaces that committed frame callbacks are visited.
+ * A surface is flushed with the output its top-most parent surface is on. Only surfaces created
+ * after the scheduler are tracked.
+ *
+ * Surfaces withheld by their visibility hint stay pending for later flushes.
+ *
+ * Surfaces on no output at all are off-screen. Their callbacks are by default only sent through
+ * Surface::frameRendered. Optionally they can be flushed in a low fixed interval instead.
+ */
+class WRAPLANDSERVER_EXPORT frame_callback_scheduler : public QObject
+{
+    Q_OBJECT
+public:
+    explicit frame_callback_scheduler(Compositor* compositor);
+    ~frame_callback_scheduler() override;
+
+    /**
+     * Sends the done event to all pending frame callbacks of surfaces on @p output.
+     */
+    void flush(output* output, uint32_t msec);
+
+    /**
+     * Sends the done event to all pending frame callbacks of @p surface. Its subsurfaces are not
+     * included.
+     */
+    void flush(Surface* surface, uint32_t msec);
+
+    bool has_pending(Surface* surface) const;
+
+    /**
+     * Interval in which frame callbacks of off-screen surfaces are sent. The default of zero
+     * disables sending them through the scheduler.
+     */
+    std::chrono::milliseconds offscreen_interval() const;
+    void set_offscreen_interval(std::chrono::milliseconds interval);
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
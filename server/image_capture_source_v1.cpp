@@ -0,0 +1,82 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "image_capture_source_v1_p.h"
+
+#include "client.h"
+#include "display.h"
+#include "output.h"
+#include "wl_output_p.h"
+
+namespace Wrapland::Server
+{
+
+struct ext_output_image_capture_source_manager_v1_interface const
+    output_image_capture_source_manager_v1::Private::s_interface
+    = {
+        cb<create_source_callback>,
+        resourceDestroyCallback,
+};
+
+output_image_capture_source_manager_v1::Private::Private(
+    Display* display,
+    output_image_capture_source_manager_v1* q_ptr)
+    : output_image_capture_source_manager_v1_global(
+        q_ptr,
+        display,
+        &ext_output_image_capture_source_manager_v1_interface,
+        &s_interface)
+{
+    create();
+}
+
+void output_image_capture_source_manager_v1::Private::create_source_callback(
+    output_image_capture_source_manager_v1_bind* bind,
+    uint32_t id,
+    wl_resource* wlOutput)
+{
+    auto wayland_output = WlOutputGlobal::get_handle(wlOutput);
+    auto output = wayland_output ? wayland_output->output() : nullptr;
+
+    new image_capture_source_v1_res(bind->client->handle, bind->version, id, output);
+}
+
+output_image_capture_source_manager_v1::output_image_capture_source_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+output_image_capture_source_manager_v1::~output_image_capture_source_manager_v1() = default;
+
+image_capture_source_v1_res::image_capture_source_v1_res(Client* client,
+                                                         uint32_t version,
+                                                         uint32_t id,
+                                                         Server::output* output)
+    : output{output}
+    , impl{new image_capture_source_v1_res_impl(client, version, id, this)}
+{
+    if (output) {
+        connect(output, &QObject::destroyed, this, [this] { this->output = nullptr; });
+    }
+}
+
+struct ext_image_capture_source_v1_interface const image_capture_source_v1_res_impl::s_interface
+    = {destroyCallback};
+
+image_capture_source_v1_res_impl::image_capture_source_v1_res_impl(
+    Client* client,
+    uint32_t version,
+    uint32_t id,
+    image_capture_source_v1_res* q_ptr)
+    : Wayland::Resource<image_capture_source_v1_res>(client,
+                                                     version,
+                                                     id,
+                                                     &ext_image_capture_source_v1_interface,
+                                                     &s_interface,
+                                                     q_ptr)
+{
+}
+
+}
@@ -0,0 +1,35 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * Global for the ext_output_image_capture_source_manager_v1 interface.
+ *
+ * Clients create through it capture sources for outputs. Sessions for these sources are created
+ * with the image_copy_capture_manager_v1.
+ */
+class WRAPLANDSERVER_EXPORT output_image_capture_source_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit output_image_capture_source_manager_v1(Display* display);
+    ~output_image_capture_source_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
@@ -0,0 +1,69 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "image_capture_source_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <wayland-ext-image-capture-source-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+class output;
+
+constexpr uint32_t output_image_capture_source_manager_v1_version = 1;
+using output_image_capture_source_manager_v1_global
+    = Wayland::Global<output_image_capture_source_manager_v1,
+                      output_image_capture_source_manager_v1_version>;
+using output_image_capture_source_manager_v1_bind
+    = Wayland::Bind<output_image_capture_source_manager_v1_global>;
+
+class output_image_capture_source_manager_v1::Private
+    : public output_image_capture_source_manager_v1_global
+{
+public:
+    Private(Display* display, output_image_capture_source_manager_v1* q_ptr);
+
+private:
+    static void create_source_callback(output_image_capture_source_manager_v1_bind* bind,
+                                       uint32_t id,
+                                       wl_resource* wlOutput);
+
+    static struct ext_output_image_capture_source_manager_v1_interface const s_interface;
+};
+
+class image_capture_source_v1_res_impl;
+
+class image_capture_source_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    image_capture_source_v1_res(Client* client,
+                                uint32_t version,
+                                uint32_t id,
+                                Server::output* output);
+
+    Server::output* output;
+    image_capture_source_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class image_capture_source_v1_res_impl : public Wayland::Resource<image_capture_source_v1_res>
+{
+public:
+    image_capture_source_v1_res_impl(Client* client,
+                                     uint32_t version,
+                                     uint32_t id,
+                                     image_capture_source_v1_res* q_ptr);
+
+    static struct ext_image_capture_source_v1_interface const s_interface;
+};
+
+}
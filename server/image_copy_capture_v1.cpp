@@ -0,0 +1,509 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "image_copy_capture_v1_p.h"
+
+#include "buffer.h"
+#include "client.h"
+#include "display.h"
+#include "image_capture_source_v1_p.h"
+
+#include <algorithm>
+#include <wayland-server.h>
+
+namespace Wrapland::Server
+{
+
+struct ext_image_copy_capture_manager_v1_interface const
+    image_copy_capture_manager_v1::Private::s_interface
+    = {
+        cb<create_session_callback>,
+        cb<create_pointer_cursor_session_callback>,
+        resourceDestroyCallback,
+};
+
+image_copy_capture_manager_v1::Private::Private(Display* display,
+                                                image_copy_capture_manager_v1* q_ptr)
+    : image_copy_capture_manager_v1_global(q_ptr,
+                                           display,
+                                           &ext_image_copy_capture_manager_v1_interface,
+                                           &s_interface)
+{
+    create();
+}
+
+void image_copy_capture_manager_v1::Private::create_session_callback(
+    image_copy_capture_manager_v1_bind* bind,
+    uint32_t id,
+    wl_resource* wlSource,
+    uint32_t options)
+{
+    if (options & ~EXT_IMAGE_COPY_CAPTURE_MANAGER_V1_OPTIONS_PAINT_CURSORS) {
+        bind->post_error(EXT_IMAGE_COPY_CAPTURE_MANAGER_V1_ERROR_INVALID_OPTION,
+                         "Invalid options");
+        return;
+    }
+
+    auto source = Wayland::Resource<image_capture_source_v1_res>::get_handle(wlSource);
+    auto paint_cursors = (options & EXT_IMAGE_COPY_CAPTURE_MANAGER_V1_OPTIONS_PAINT_CURSORS) != 0;
+
+    auto session = new image_copy_capture_session_v1(
+        bind->client->handle, bind->version, id, source->output, paint_cursors);
+
+    if (!source->output) {
+        session->stop();
+        return;
+    }
+
+    Q_EMIT bind->global()->handle->session_created(session);
+}
+
+void image_copy_capture_manager_v1::Private::create_pointer_cursor_session_callback(
+    image_copy_capture_manager_v1_bind* bind,
+    uint32_t id,
+    [[maybe_unused]] wl_resource* wlSource,
+    [[maybe_unused]] wl_resource* wlPointer)
+{
+    new image_copy_capture_cursor_session_v1_res(bind->client->handle, bind->version, id);
+}
+
+image_copy_capture_manager_v1::image_copy_capture_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+image_copy_capture_manager_v1::~image_copy_capture_manager_v1() = default;
+
+struct ext_image_copy_capture_session_v1_interface const
+    image_copy_capture_session_v1::Private::s_interface
+    = {
+        create_frame_callback,
+        destroyCallback,
+};
+
+image_copy_capture_session_v1::Private::Private(Client* client,
+                                                uint32_t version,
+                                                uint32_t id,
+                                                Server::output* output,
+                                                bool paint_cursors,
+                                                image_copy_capture_session_v1* q_ptr)
+    : Wayland::Resource<image_copy_capture_session_v1>(
+        client,
+        version,
+        id,
+        &ext_image_copy_capture_session_v1_interface,
+        &s_interface,
+        q_ptr)
+    , output{output}
+    , paint_cursors{paint_cursors}
+{
+    if (output) {
+        QObject::connect(output, &QObject::destroyed, handle, [this] {
+            this->output = nullptr;
+            handle->stop();
+        });
+    }
+}
+
+image_copy_capture_session_v1::Private::~Private()
+{
+    if (!frame) {
+        return;
+    }
+
+    frame->d_ptr->session = nullptr;
+    if (frame->d_ptr->state == image_copy_capture_frame_v1::Private::capture_state::captured) {
+        frame->fail(image_copy_capture_frame_failure_v1::stopped);
+    }
+}
+
+void image_copy_capture_session_v1::Private::create_frame_callback(
+    [[maybe_unused]] wl_client* wlClient,
+    wl_resource* wlResource,
+    uint32_t id)
+{
+    auto priv = get_handle(wlResource)->d_ptr;
+
+    if (priv->frame) {
+        priv->postError(EXT_IMAGE_COPY_CAPTURE_SESSION_V1_ERROR_DUPLICATE_FRAME,
+                        "Previous frame not yet destroyed");
+        return;
+    }
+
+    priv->frame
+        = new image_copy_capture_frame_v1(priv->client->handle, priv->version, id, priv->handle);
+}
+
+void image_copy_capture_session_v1::Private::request_capture(image_copy_capture_frame_v1* frame)
+{
+    if (stopped) {
+        frame->fail(image_copy_capture_frame_failure_v1::stopped);
+        return;
+    }
+    if (!check_buffer(*frame->d_ptr->buffer)) {
+        frame->fail(image_copy_capture_frame_failure_v1::buffer_constraints);
+        return;
+    }
+
+    update_capture();
+}
+
+void image_copy_capture_session_v1::Private::update_capture()
+{
+    using capture_state = image_copy_capture_frame_v1::Private::capture_state;
+
+    if (!frame || frame->d_ptr->state != capture_state::captured || damage.isEmpty()) {
+        // Without damage the content did not change since the last frame. Wait for new damage.
+        return;
+    }
+
+    frame->d_ptr->state = capture_state::requested;
+    frame->d_ptr->content_damage = damage;
+    damage = QRegion();
+
+    Q_EMIT handle->capture_requested(frame);
+}
+
+bool image_copy_capture_session_v1::Private::check_buffer(Buffer& buffer) const
+{
+    if (buffer.size() != constraints.size) {
+        return false;
+    }
+
+    if (auto shm = buffer.shmBuffer()) {
+        auto const& formats = constraints.shm_formats;
+        return std::find(formats.cbegin(), formats.cend(), wl_shm_buffer_get_format(shm))
+            != formats.cend();
+    }
+
+    if (auto dmabuf = buffer.linuxDmabufBuffer(); dmabuf && constraints.dmabuf_device) {
+        auto const& formats = constraints.dmabuf_formats;
+        return std::any_of(formats.cbegin(), formats.cend(), [dmabuf](auto const& format) {
+            return format.format == dmabuf->format && format.modifiers.contains(dmabuf->modifier);
+        });
+    }
+
+    return false;
+}
+
+image_copy_capture_session_v1::image_copy_capture_session_v1(Client* client,
+                                                             uint32_t version,
+                                                             uint32_t id,
+                                                             Server::output* output,
+                                                             bool paint_cursors)
+    : d_ptr(new Private(client, version, id, output, paint_cursors, this))
+{
+}
+
+image_copy_capture_session_v1::~image_copy_capture_session_v1() = default;
+
+Server::output* image_copy_capture_session_v1::output() const
+{
+    return d_ptr->output;
+}
+
+bool image_copy_capture_session_v1::paint_cursors() const
+{
+    return d_ptr->paint_cursors;
+}
+
+image_copy_capture_buffer_constraints_v1 const&
+image_copy_capture_session_v1::constraints() const
+{
+    return d_ptr->constraints;
+}
+
+void image_copy_capture_session_v1::set_constraints(
+    image_copy_capture_buffer_constraints_v1 const& constraints)
+{
+    if (d_ptr->stopped) {
+        return;
+    }
+
+    d_ptr->constraints = constraints;
+
+    d_ptr->send<ext_image_copy_capture_session_v1_send_buffer_size>(constraints.size.width(),
+                                                                     constraints.size.height());
+    for (auto format : constraints.shm_formats) {
+        d_ptr->send<ext_image_copy_capture_session_v1_send_shm_format>(format);
+    }
+
+    if (constraints.dmabuf_device) {
+        // The arrays only wrap existing memory for sending and are not released.
+        auto device_id = constraints.dmabuf_device;
+        wl_array device{.size = sizeof(dev_t), .alloc = sizeof(dev_t), .data = &device_id};
+        d_ptr->send<ext_image_copy_capture_session_v1_send_dmabuf_device>(&device);
+
+        for (auto const& format : constraints.dmabuf_formats) {
+            std::vector<uint64_t> modifiers(format.modifiers.cbegin(), format.modifiers.cend());
+            wl_array modifiers_array{
+                .size = modifiers.size() * sizeof(uint64_t),
+                .alloc = modifiers.size() * sizeof(uint64_t),
+                .data = modifiers.data(),
+            };
+            d_ptr->send<ext_image_copy_capture_session_v1_send_dmabuf_format>(format.format,
+                                                                              &modifiers_array);
+        }
+    }
+
+    d_ptr->send<ext_image_copy_capture_session_v1_send_done>();
+
+    d_ptr->damage = QRegion(QRect(QPoint(), constraints.size));
+    d_ptr->update_capture();
+}
+
+void image_copy_capture_session_v1::add_damage(QRegion const& damage)
+{
+    d_ptr->damage |= damage.intersected(QRect(QPoint(), d_ptr->constraints.size));
+    d_ptr->update_capture();
+}
+
+void image_copy_capture_session_v1::stop()
+{
+    if (d_ptr->stopped) {
+        return;
+    }
+
+    d_ptr->stopped = true;
+    d_ptr->send<ext_image_copy_capture_session_v1_send_stopped>();
+
+    if (auto frame = d_ptr->frame;
+        frame
+        && frame->d_ptr->state == image_copy_capture_frame_v1::Private::capture_state::captured) {
+        frame->fail(image_copy_capture_frame_failure_v1::stopped);
+    }
+}
+
+struct ext_image_copy_capture_frame_v1_interface const
+    image_copy_capture_frame_v1::Private::s_interface
+    = {
+        destroyCallback,
+        attach_buffer_callback,
+        damage_buffer_callback,
+        capture_callback,
+};
+
+image_copy_capture_frame_v1::Private::Private(Client* client,
+                                              uint32_t version,
+                                              uint32_t id,
+                                              image_copy_capture_session_v1* session,
+                                              image_copy_capture_frame_v1* q_ptr)
+    : Wayland::Resource<image_copy_capture_frame_v1>(client,
+                                                     version,
+                                                     id,
+                                                     &ext_image_copy_capture_frame_v1_interface,
+                                                     &s_interface,
+                                                     q_ptr)
+    , session{session}
+{
+}
+
+image_copy_capture_frame_v1::Private::~Private()
+{
+    if (!session) {
+        return;
+    }
+
+    auto session_priv = session->d_ptr;
+    if (state == capture_state::requested) {
+        // The content was not delivered. Keep its damage for the next frame.
+        session_priv->damage |= content_damage;
+    }
+    if (session_priv->frame == handle) {
+        session_priv->frame = nullptr;
+    }
+}
+
+void image_copy_capture_frame_v1::Private::attach_buffer_callback(
+    [[maybe_unused]] wl_client* wlClient,
+    wl_resource* wlResource,
+    wl_resource* wlBuffer)
+{
+    auto priv = get_handle(wlResource)->d_ptr;
+
+    if (priv->state != capture_state::pending) {
+        priv->postError(EXT_IMAGE_COPY_CAPTURE_FRAME_V1_ERROR_ALREADY_CAPTURED,
+                        "Frame was already captured");
+        return;
+    }
+
+    priv->buffer = Buffer::get(priv->client->handle->display(), wlBuffer);
+}
+
+void image_copy_capture_frame_v1::Private::damage_buffer_callback(
+    [[maybe_unused]] wl_client* wlClient,
+    wl_resource* wlResource,
+    int32_t x,
+    int32_t y,
+    int32_t width,
+    int32_t height)
+{
+    auto priv = get_handle(wlResource)->d_ptr;
+
+    if (priv->state != capture_state::pending) {
+        priv->postError(EXT_IMAGE_COPY_CAPTURE_FRAME_V1_ERROR_ALREADY_CAPTURED,
+                        "Frame was already captured");
+        return;
+    }
+    if (x < 0 || y < 0 || width <= 0 || height <= 0) {
+        priv->postError(EXT_IMAGE_COPY_CAPTURE_FRAME_V1_ERROR_INVALID_BUFFER_DAMAGE,
+                        "Invalid buffer damage");
+        return;
+    }
+
+    priv->buffer_damage |= QRect(x, y, width, height);
+}
+
+void image_copy_capture_frame_v1::Private::capture_callback([[maybe_unused]] wl_client* wlClient,
+                                                            wl_resource* wlResource)
+{
+    auto priv = get_handle(wlResource)->d_ptr;
+
+    if (priv->state != capture_state::pending) {
+        priv->postError(EXT_IMAGE_COPY_CAPTURE_FRAME_V1_ERROR_ALREADY_CAPTURED,
+                        "Frame was already captured");
+        return;
+    }
+    if (!priv->buffer) {
+        priv->postError(EXT_IMAGE_COPY_CAPTURE_FRAME_V1_ERROR_NO_BUFFER, "No buffer attached");
+        return;
+    }
+
+    priv->state = capture_state::captured;
+
+    if (!priv->session) {
+        priv->handle->fail(image_copy_capture_frame_failure_v1::stopped);
+        return;
+    }
+
+    priv->session->d_ptr->request_capture(priv->handle);
+}
+
+image_copy_capture_frame_v1::image_copy_capture_frame_v1(Client* client,
+                                                         uint32_t version,
+                                                         uint32_t id,
+                                                         image_copy_capture_session_v1* session)
+    : d_ptr(new Private(client, version, id, session, this))
+{
+}
+
+image_copy_capture_frame_v1::~image_copy_capture_frame_v1() = default;
+
+image_copy_capture_session_v1* image_copy_capture_frame_v1::session() const
+{
+    return d_ptr->session;
+}
+
+std::shared_ptr<Buffer> image_copy_capture_frame_v1::buffer() const
+{
+    return d_ptr->buffer;
+}
+
+QRegion image_copy_capture_frame_v1::damage() const
+{
+    auto const buffer_rect = QRect(QPoint(), d_ptr->buffer->size());
+
+    if (d_ptr->buffer_damage.isEmpty()) {
+        return buffer_rect;
+    }
+    return (d_ptr->buffer_damage | d_ptr->content_damage).intersected(buffer_rect);
+}
+
+void image_copy_capture_frame_v1::ready(output_transform transform,
+                                        std::chrono::nanoseconds presentation_time)
+{
+    if (d_ptr->state == Private::capture_state::done) {
+        return;
+    }
+
+    d_ptr->send<ext_image_copy_capture_frame_v1_send_transform>(static_cast<uint32_t>(transform));
+
+    for (auto const& rect : d_ptr->content_damage) {
+        d_ptr->send<ext_image_copy_capture_frame_v1_send_damage>(
+            rect.x(), rect.y(), rect.width(), rect.height());
+    }
+
+    auto const secs = std::chrono::duration_cast<std::chrono::seconds>(presentation_time);
+    auto const nsecs = presentation_time - secs;
+    auto const secs_count = static_cast<uint64_t>(secs.count());
+    d_ptr->send<ext_image_copy_capture_frame_v1_send_presentation_time>(
+        static_cast<uint32_t>(secs_count >> 32),
+        static_cast<uint32_t>(secs_count & 0xffffffff),
+        static_cast<uint32_t>(nsecs.count()));
+
+    d_ptr->send<ext_image_copy_capture_frame_v1_send_ready>();
+
+    d_ptr->state = Private::capture_state::done;
+    d_ptr->content_damage = QRegion();
+}
+
+void image_copy_capture_frame_v1::fail(image_copy_capture_frame_failure_v1 reason)
+{
+    if (d_ptr->state == Private::capture_state::done) {
+        return;
+    }
+
+    if (d_ptr->state == Private::capture_state::requested && d_ptr->session) {
+        // The content was not delivered. Keep its damage for the next frame.
+        d_ptr->session->d_ptr->damage |= d_ptr->content_damage;
+    }
+
+    d_ptr->send<ext_image_copy_capture_frame_v1_send_failed>(static_cast<uint32_t>(reason));
+
+    d_ptr->state = Private::capture_state::done;
+    d_ptr->content_damage = QRegion();
+}
+
+image_copy_capture_cursor_session_v1_res::image_copy_capture_cursor_session_v1_res(
+    Client* client,
+    uint32_t version,
+    uint32_t id)
+    : impl{new image_copy_capture_cursor_session_v1_res_impl(client, version, id, this)}
+{
+}
+
+struct ext_image_copy_capture_cursor_session_v1_interface const
+    image_copy_capture_cursor_session_v1_res_impl::s_interface
+    = {
+        destroyCallback,
+        get_capture_session_callback,
+};
+
+image_copy_capture_cursor_session_v1_res_impl::image_copy_capture_cursor_session_v1_res_impl(
+    Client* client,
+    uint32_t version,
+    uint32_t id,
+    image_copy_capture_cursor_session_v1_res* q_ptr)
+    : Wayland::Resource<image_copy_capture_cursor_session_v1_res>(
+        client,
+        version,
+        id,
+        &ext_image_copy_capture_cursor_session_v1_interface,
+        &s_interface,
+        q_ptr)
+{
+}
+
+void image_copy_capture_cursor_session_v1_res_impl::get_capture_session_callback(
+    [[maybe_unused]] wl_client* wlClient,
+    wl_resource* wlResource,
+    uint32_t id)
+{
+    auto res = get_handle(wlResource);
+
+    if (res->has_session) {
+        res->impl->postError(EXT_IMAGE_COPY_CAPTURE_CURSOR_SESSION_V1_ERROR_DUPLICATE_SESSION,
+                             "Capture session already created");
+        return;
+    }
+    res->has_session = true;
+
+    // Capturing cursors is not supported. The session ends right away.
+    auto session = new image_copy_capture_session_v1(
+        res->impl->client->handle, res->impl->version, id, nullptr, false);
+    session->stop();
+}
+
+}
@@ -0,0 +1,167 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "linux_dmabuf_v1.h"
+#include "output.h"
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <QRegion>
+#include <QSize>
+#include <chrono>
+#include <memory>
+#include <sys/types.h>
+#include <vector>
+
+namespace Wrapland::Server
+{
+class Buffer;
+class Client;
+class Display;
+class image_copy_capture_frame_v1;
+class image_copy_capture_session_v1;
+
+/**
+ * Buffers clients may attach to frames of a session.
+ */
+struct image_copy_capture_buffer_constraints_v1 {
+    QSize size;
+    /// Supported formats of shm buffers as wl_shm formats.
+    std::vector<uint32_t> shm_formats;
+    /// Device dmabuf buffers must be accessible by. Dmabuf buffers are only supported if set.
+    dev_t dmabuf_device{0};
+    std::vector<drm_format> dmabuf_formats;
+};
+
+enum class image_copy_capture_frame_failure_v1 {
+    unknown,
+    buffer_constraints,
+    stopped,
+};
+
+/**
+ * Global for the ext_image_copy_capture_manager_v1 interface.
+ *
+ * Clients capture through it the content of sources created with the
+ * output_image_capture_source_manager_v1. Capturing cursors separately is not supported.
+ */
+class WRAPLANDSERVER_EXPORT image_copy_capture_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit image_copy_capture_manager_v1(Display* display);
+    ~image_copy_capture_manager_v1() override;
+
+Q_SIGNALS:
+    /**
+     * The compositor must answer with image_copy_capture_session_v1::set_constraints or stop the
+     * session.
+     */
+    void session_created(Wrapland::Server::image_copy_capture_session_v1* session);
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+/**
+ * A capture session on an output.
+ *
+ * The session tracks the damage of the output since the last frame. The compositor adds damage
+ * with add_damage whenever the content of the output changes. Frames the client requests are
+ * only handed to the compositor through capture_requested once there is damage, so idle outputs
+ * are not copied again.
+ */
+class WRAPLANDSERVER_EXPORT image_copy_capture_session_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    ~image_copy_capture_session_v1() override;
+
+    /// The captured output or null if it was removed.
+    Server::output* output() const;
+    bool paint_cursors() const;
+
+    image_copy_capture_buffer_constraints_v1 const& constraints() const;
+    /**
+     * Sends the buffer constraints to the client. Must be called once after creation and
+     * whenever they change. The whole buffer is considered damaged afterwards.
+     */
+    void set_constraints(image_copy_capture_buffer_constraints_v1 const& constraints);
+
+    /**
+     * Adds @p damage in buffer coordinates to the region changed since the last frame.
+     */
+    void add_damage(QRegion const& damage);
+
+    /**
+     * Ends the session. Pending and future frames fail.
+     */
+    void stop();
+
+Q_SIGNALS:
+    /**
+     * The compositor copies the damaged region of the output into the buffer of @p frame and
+     * then calls image_copy_capture_frame_v1::ready or image_copy_capture_frame_v1::fail.
+     */
+    void capture_requested(Wrapland::Server::image_copy_capture_frame_v1* frame);
+    void resourceDestroyed();
+
+private:
+    friend class image_copy_capture_cursor_session_v1_res_impl;
+    friend class image_copy_capture_frame_v1;
+    friend class image_copy_capture_manager_v1;
+    image_copy_capture_session_v1(Client* client,
+                                  uint32_t version,
+                                  uint32_t id,
+                                  Server::output* output,
+                                  bool paint_cursors);
+
+    class Private;
+    Private* d_ptr;
+};
+
+class WRAPLANDSERVER_EXPORT image_copy_capture_frame_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    ~image_copy_capture_frame_v1() override;
+
+    /// The session of the frame or null if it was destroyed.
+    image_copy_capture_session_v1* session() const;
+    std::shared_ptr<Buffer> buffer() const;
+
+    /**
+     * The region of the buffer that must be copied. It is the damage of the output since the
+     * last frame together with the damage the client reported for the buffer. Without such
+     * report it is the whole buffer.
+     */
+    QRegion damage() const;
+
+    /**
+     * Tells the client that the buffer holds the content of the output. The @p presentation_time
+     * is the time the content was shown on the output in the clock of the PresentationManager.
+     */
+    void ready(output_transform transform, std::chrono::nanoseconds presentation_time);
+    void fail(image_copy_capture_frame_failure_v1 reason);
+
+Q_SIGNALS:
+    void resourceDestroyed();
+
+private:
+    friend class image_copy_capture_session_v1;
+    image_copy_capture_frame_v1(Client* client,
+                                uint32_t version,
+                                uint32_t id,
+                                image_copy_capture_session_v1* session);
+
+    class Private;
+    Private* d_ptr;
+};
+
+}
@@ -0,0 +1,143 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "image_copy_capture_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <wayland-ext-image-copy-capture-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+
+constexpr uint32_t image_copy_capture_manager_v1_version = 1;
+using image_copy_capture_manager_v1_global
+    = Wayland::Global<image_copy_capture_manager_v1, image_copy_capture_manager_v1_version>;
+using image_copy_capture_manager_v1_bind = Wayland::Bind<image_copy_capture_manager_v1_global>;
+
+class image_copy_capture_manager_v1::Private : public image_copy_capture_manager_v1_global
+{
+public:
+    Private(Display* display, image_copy_capture_manager_v1* q_ptr);
+
+private:
+    static void create_session_callback(image_copy_capture_manager_v1_bind* bind,
+                                        uint32_t id,
+                                        wl_resource* wlSource,
+                                        uint32_t options);
+    static void create_pointer_cursor_session_callback(image_copy_capture_manager_v1_bind* bind,
+                                                       uint32_t id,
+                                                       wl_resource* wlSource,
+                                                       wl_resource* wlPointer);
+
+    static struct ext_image_copy_capture_manager_v1_interface const s_interface;
+};
+
+class image_copy_capture_session_v1::Private
+    : public Wayland::Resource<image_copy_capture_session_v1>
+{
+public:
+    Private(Client* client,
+            uint32_t version,
+            uint32_t id,
+            Server::output* output,
+            bool paint_cursors,
+            image_copy_capture_session_v1* q_ptr);
+    ~Private() override;
+
+    void request_capture(image_copy_capture_frame_v1* frame);
+    void update_capture();
+
+    Server::output* output;
+    bool paint_cursors;
+    image_copy_capture_buffer_constraints_v1 constraints;
+    bool stopped{false};
+
+    // Damage of the output since the content of the last frame was taken.
+    QRegion damage;
+    image_copy_capture_frame_v1* frame{nullptr};
+
+private:
+    bool check_buffer(Buffer& buffer) const;
+
+    static void create_frame_callback(wl_client* wlClient, wl_resource* wlResource, uint32_t id);
+
+    static struct ext_image_copy_capture_session_v1_interface const s_interface;
+};
+
+class image_copy_capture_frame_v1::Private : public Wayland::Resource<image_copy_capture_frame_v1>
+{
+public:
+    Private(Client* client,
+            uint32_t version,
+            uint32_t id,
+            image_copy_capture_session_v1* session,
+            image_copy_capture_frame_v1* q_ptr);
+    ~Private() override;
+
+    enum class capture_state {
+        pending,
+        captured,
+        requested,
+        done,
+    };
+
+    image_copy_capture_session_v1* session;
+    capture_state state{capture_state::pending};
+
+    std::shared_ptr<Buffer> buffer;
+    QRegion buffer_damage;
+    // Damage of the output taken from the session when the capture was requested.
+    QRegion content_damage;
+
+private:
+    static void
+    attach_buffer_callback(wl_client* wlClient, wl_resource* wlResource, wl_resource* wlBuffer);
+    static void damage_buffer_callback(wl_client* wlClient,
+                                       wl_resource* wlResource,
+                                       int32_t x,
+                                       int32_t y,
+                                       int32_t width,
+                                       int32_t height);
+    static void capture_callback(wl_client* wlClient, wl_resource* wlResource);
+
+    static struct ext_image_copy_capture_frame_v1_interface const s_interface;
+};
+
+class image_copy_capture_cursor_session_v1_res_impl;
+
+class image_copy_capture_cursor_session_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    image_copy_capture_cursor_session_v1_res(Client* client, uint32_t version, uint32_t id);
+
+    bool has_session{false};
+    image_copy_capture_cursor_session_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class image_copy_capture_cursor_session_v1_res_impl
+    : public Wayland::Resource<image_copy_capture_cursor_session_v1_res>
+{
+public:
+    image_copy_capture_cursor_session_v1_res_impl(Client* client,
+                                                  uint32_t version,
+                                                  uint32_t id,
+                                                  image_copy_capture_cursor_session_v1_res* q_ptr);
+
+    static struct ext_image_copy_capture_cursor_session_v1_interface const s_interface;
+
+private:
+    static void
+    get_capture_session_callback(wl_client* wlClient, wl_resource* wlResource, uint32_t id);
+};
+
+}
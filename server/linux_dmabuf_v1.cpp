@@ -25,25 +25,44 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "linux_dmabuf_v1_p.h"
 
 #include "display.h"
+#include "logging.h"
+#include "surface.h"
 #include "utils.h"
 #include "wayland/display.h"
 
 #include "wayland-server-protocol.h"
 
+#include <QPointer>
 #include <QVector>
 
 #include <array>
 #include <cassert>
+#include <fcntl.h>
+#include <limits>
+#include <map>
+#include <sys/mman.h>
 
 namespace Wrapland::Server
 {
 
 linux_dmabuf_v1::Private::Private(linux_dmabuf_v1* q_ptr,
                                   Display* display,
-                                  linux_dmabuf_import_v1 import)
+                                  linux_dmabuf_async_import_v1 import,
+                                  std::optional<linux_dmabuf_feedback_v1> const& default_feedback)
     : linux_dmabuf_v1_global(q_ptr, display, &zwp_linux_dmabuf_v1_interface, &s_interface)
     , import{std::move(import)}
 {
+    if (!default_feedback) {
+        create(ZWP_LINUX_DMABUF_V1_GET_DEFAULT_FEEDBACK_SINCE_VERSION - 1);
+        return;
+    }
+    if (!default_feedback->main_device) {
+        qCWarning(WRAPLAND_SERVER) << "Dmabuf feedback without main device. Using version 3.";
+        create(ZWP_LINUX_DMABUF_V1_GET_DEFAULT_FEEDBACK_SINCE_VERSION - 1);
+        return;
+    }
+
+    this->default_feedback = std::make_unique<linux_dmabuf_feedback_v1_data>(*default_feedback);
     create();
 }
 
@@ -57,8 +76,8 @@ linux_dmabuf_v1::Private::~Private()
 const struct zwp_linux_dmabuf_v1_interface linux_dmabuf_v1::Private::s_interface = {
     resourceDestroyCallback,
     cb<create_params_callback>,
-    // TODO(romangg): Update linux-dmabuf protocol version (currently at 3).
-    // NOLINTNEXTLINE(clang-diagnostic-missing-field-initializers)
+    cb<get_default_feedback_callback>,
+    cb<get_surface_feedback_callback>,
 };
 
 constexpr size_t modifier_shift = 32;
@@ -66,6 +85,13 @@ constexpr uint32_t modifier_cut = 0xFFFFFFFF;
 
 void linux_dmabuf_v1::Private::bindInit(linux_dmabuf_v1_bind* bind)
 {
+    if (bind->version >= ZWP_LINUX_DMABUF_V1_GET_DEFAULT_FEEDBACK_SINCE_VERSION) {
+        // Formats and modifiers are only sent through feedback objects. Version 4 is only
+        // advertised with a default feedback, so there is always one to send.
+        assert(default_feedback);
+        return;
+    }
+
     // Send formats & modifiers.
     if (bind->version < ZWP_LINUX_DMABUF_V1_MODIFIER_SINCE_VERSION) {
         for (auto const& fmt : supported_formats) {
@@ -113,8 +139,81 @@ void linux_dmabuf_v1::Private::create_params_callback(linux_dmabuf_v1_bind* bind
     priv->pending_params.push_back(params);
 }
 
-linux_dmabuf_v1::linux_dmabuf_v1(Display* display, linux_dmabuf_import_v1 import)
-    : d_ptr(new Private(this, display, std::move(import)))
+void linux_dmabuf_v1::Private::get_default_feedback_callback(linux_dmabuf_v1_bind* bind,
+                                                             uint32_t id)
+{
+    auto priv = bind->global()->handle->d_ptr.get();
+    priv->add_feedback(
+        new linux_dmabuf_feedback_v1_res(bind->client->handle, bind->version, id, nullptr));
+}
+
+void linux_dmabuf_v1::Private::get_surface_feedback_callback(linux_dmabuf_v1_bind* bind,
+                                                             uint32_t id,
+                                                             wl_resource* wlSurface)
+{
+    auto priv = bind->global()->handle->d_ptr.get();
+    auto surface = Wayland::Resource<Surface>::get_handle(wlSurface);
+    auto res = new linux_dmabuf_feedback_v1_res(bind->client->handle, bind->version, id, surface);
+
+    // Once the surface is gone the feedback object becomes inert.
+    QObject::connect(surface, &Surface::resourceDestroyed, priv->handle, [priv, res] {
+        remove_all(priv->feedbacks, res);
+    });
+    priv->add_feedback(res);
+}
+
+linux_dmabuf_feedback_v1_data const& linux_dmabuf_v1::Private::get_feedback(Surface* surface) const
+{
+    if (surface) {
+        if (auto it = surface_feedbacks.find(surface); it != surface_feedbacks.end()) {
+            return *it->second.data;
+        }
+    }
+    return *default_feedback;
+}
+
+void linux_dmabuf_v1::Private::add_feedback(linux_dmabuf_feedback_v1_res* res)
+{
+    feedbacks.push_back(res);
+    QObject::connect(res, &linux_dmabuf_feedback_v1_res::resourceDestroyed, handle, [this, res] {
+        remove_all(feedbacks, res);
+    });
+    res->impl->send_feedback(get_feedback(res->surface));
+}
+
+void linux_dmabuf_v1::Private::update_feedbacks(Surface* surface)
+{
+    for (auto res : feedbacks) {
+        auto const match = surface
+            ? res->surface == surface
+            : !res->surface || surface_feedbacks.find(res->surface) == surface_feedbacks.end();
+        if (match) {
+            res->impl->send_feedback(get_feedback(res->surface));
+        }
+    }
+}
+
+linux_dmabuf_v1::linux_dmabuf_v1(Display* display,
+                                 linux_dmabuf_import_v1 import,
+                                 std::optional<linux_dmabuf_feedback_v1> const& default_feedback)
+    : linux_dmabuf_v1(
+        display,
+        [import = std::move(import)](auto const& planes,
+                                     auto format,
+                                     auto modifier,
+                                     auto const& size,
+                                     auto flags,
+                                     auto const& done) {
+            done(import(planes, format, modifier, size, flags));
+        },
+        default_feedback)
+{
+}
+
+linux_dmabuf_v1::linux_dmabuf_v1(Display* display,
+                                 linux_dmabuf_async_import_v1 import,
+                                 std::optional<linux_dmabuf_feedback_v1> const& default_feedback)
+    : d_ptr(new Private(this, display, std::move(import), default_feedback))
 {
 }
 
@@ -125,6 +224,114 @@ void linux_dmabuf_v1::set_formats(std::vector<drm_format> const& formats)
     d_ptr->supported_formats = formats;
 }
 
+void linux_dmabuf_v1::set_default_feedback(linux_dmabuf_feedback_v1 const& feedback)
+{
+    if (!d_ptr->default_feedback) {
+        qCWarning(WRAPLAND_SERVER) << "Dmabuf global created without feedback. Ignoring it.";
+        return;
+    }
+    if (!feedback.main_device) {
+        qCWarning(WRAPLAND_SERVER) << "Dmabuf feedback without main device. Ignoring it.";
+        return;
+    }
+
+    d_ptr->default_feedback = std::make_unique<linux_dmabuf_feedback_v1_data>(feedback);
+    d_ptr->update_feedbacks(nullptr);
+}
+
+void linux_dmabuf_v1::set_surface_feedback(Surface* surface,
+                                           std::optional<linux_dmabuf_feedback_v1> const& feedback)
+{
+    assert(surface);
+
+    if (!feedback) {
+        auto& feedbacks = d_ptr->surface_feedbacks;
+        if (auto it = feedbacks.find(surface); it != feedbacks.end()) {
+            disconnect(it->second.destroy_notifier);
+            feedbacks.erase(it);
+            d_ptr->update_feedbacks(surface);
+        }
+        return;
+    }
+
+    if (!feedback->main_device) {
+        qCWarning(WRAPLAND_SERVER) << "Dmabuf feedback without main device. Ignoring it.";
+        return;
+    }
+
+    auto& entry = d_ptr->surface_feedbacks[surface];
+    entry.data = std::make_unique<linux_dmabuf_feedback_v1_data>(*feedback);
+    if (!entry.destroy_notifier) {
+        entry.destroy_notifier
+            = connect(surface, &Surface::resourceDestroyed, this, [this, surface] {
+                  d_ptr->surface_feedbacks.erase(surface);
+              });
+    }
+    d_ptr->update_feedbacks(surface);
+}
+
+struct linux_dmabuf_format_table_entry_v1 {
+    uint32_t format;
+    uint32_t padding;
+    uint64_t modifier;
+};
+
+static_assert(sizeof(linux_dmabuf_format_table_entry_v1) == 16);
+
+linux_dmabuf_feedback_v1_data::linux_dmabuf_feedback_v1_data(linux_dmabuf_feedback_v1 feedback)
+    : feedback{std::move(feedback)}
+{
+    // Format-modifier pairs appearing in multiple tranches share a table entry.
+    std::vector<linux_dmabuf_format_table_entry_v1> entries;
+    std::map<std::pair<uint32_t, uint64_t>, uint16_t> indices;
+
+    for (auto const& tranche : this->feedback.tranches) {
+        auto& tranche_idx = tranche_indices.emplace_back();
+
+        for (auto const& fmt : tranche.formats) {
+            for (auto const mod : fmt.modifiers) {
+                auto it = indices.find({fmt.format, mod});
+                if (it == indices.end()) {
+                    if (entries.size() > std::numeric_limits<uint16_t>::max()) {
+                        qCWarning(WRAPLAND_SERVER) << "Too many formats for dmabuf feedback.";
+                        continue;
+                    }
+                    it = indices.insert({{fmt.format, mod}, static_cast<uint16_t>(entries.size())})
+                             .first;
+                    entries.push_back({fmt.format, 0, mod});
+                }
+                tranche_idx.push_back(it->second);
+            }
+        }
+    }
+
+    auto const size = entries.size() * sizeof(linux_dmabuf_format_table_entry_v1);
+
+    table_fd = memfd_create("wrapland-dmabuf-format-table", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (table_fd < 0) {
+        qCWarning(WRAPLAND_SERVER) << "Could not create dmabuf format table.";
+        return;
+    }
+
+    if (::write(table_fd, entries.data(), size) != static_cast<ssize_t>(size)) {
+        qCWarning(WRAPLAND_SERVER) << "Could not write dmabuf format table.";
+        ::close(table_fd);
+        table_fd = -1;
+        return;
+    }
+
+    // Clients map the table. It must not change afterwards.
+    fcntl(table_fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL);
+    table_size = static_cast<uint32_t>(size);
+}
+
+linux_dmabuf_feedback_v1_data::~linux_dmabuf_feedback_v1_data()
+{
+    if (table_fd >= 0) {
+        ::close(table_fd);
+    }
+}
+
 linux_dmabuf_params_v1::linux_dmabuf_params_v1(Client* client,
                                                uint32_t version,
                                                uint32_t id,
@@ -238,35 +445,63 @@ void linux_dmabuf_params_v1_impl::create(uint32_t buffer_id,
         planes.push_back(m_planes.at(i));
     }
 
-    auto buffer = m_dmabuf->import(planes, format, modifier, size, linux_dmabuf_flags_v1(flags));
-    if (!buffer) {
-        if (buffer_id == 0) {
-            send<zwp_linux_buffer_params_v1_send_failed>();
-            return;
-        }
-        // Since the behavior is left implementation defined by the protocol in case of create_immed
-        // failure due to an unknown cause, we choose to treat it as a fatal error and immediately
-        // kill the client instead of creating an invalid handle and waiting for it to be used.
-        postError(ZWP_LINUX_BUFFER_PARAMS_V1_ERROR_INVALID_WL_BUFFER,
-                  "importing the supplied dmabufs failed");
-        return;
-    }
-
-    // The buffer has ownership of the file descriptors now
+    // The import owns the file descriptors now. On success they are passed on to the buffer.
     for (auto& plane : m_planes) {
         plane.fd = -1;
     }
 
-    // We import the buffer from the consumer. The consumer ensures the buffer exists.
-    // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
-    auto res = new linux_dmabuf_buffer_v1_res(client->handle, 1, buffer_id, std::move(buffer));
+    // For create_immed the wl_buffer exists right away and gets its handle once imported.
+    QPointer<linux_dmabuf_buffer_v1_res> immed_res;
+    if (buffer_id != 0) {
+        immed_res = new linux_dmabuf_buffer_v1_res(client->handle, 1, buffer_id, nullptr);
+    }
 
-    // TODO(romangg): error handling
+    QPointer<linux_dmabuf_params_v1> params = handle;
+    auto done = [params, immed_res, immed = buffer_id != 0, planes](auto buffer) {
+        if (!buffer) {
+            for (auto const& plane : planes) {
+                ::close(plane.fd);
+            }
+            if (!immed) {
+                if (params) {
+                    params->d_ptr->send<zwp_linux_buffer_params_v1_send_failed>();
+                }
+                return;
+            }
 
-    // Send a 'created' event when the request is not for an immediate import, i.e. buffer_id is 0.
-    if (buffer_id == 0) {
-        send<zwp_linux_buffer_params_v1_send_created>(res->impl->resource);
-    }
+            // Since the behavior is left implementation defined by the protocol in case of
+            // create_immed failure due to an unknown cause, we choose to treat it as a fatal error
+            // and kill the client instead of waiting for the invalid buffer to be used.
+            if (params) {
+                params->d_ptr->postError(ZWP_LINUX_BUFFER_PARAMS_V1_ERROR_INVALID_WL_BUFFER,
+                                         "importing the supplied dmabufs failed");
+            } else if (immed_res) {
+                wl_client_post_implementation_error(
+                    wl_resource_get_client(immed_res->impl->resource),
+                    "importing the supplied dmabufs failed");
+            }
+            return;
+        }
+
+        if (immed) {
+            if (immed_res) {
+                immed_res->handle = std::move(buffer);
+                Q_EMIT immed_res->imported();
+            }
+            return;
+        }
+
+        if (!params) {
+            // Nobody to tell about the buffer anymore.
+            return;
+        }
+
+        auto res = new linux_dmabuf_buffer_v1_res(
+            params->d_ptr->client->handle, 1, 0, std::move(buffer));
+        params->d_ptr->send<zwp_linux_buffer_params_v1_send_created>(res->impl->resource);
+    };
+
+    m_dmabuf->import(planes, format, modifier, size, linux_dmabuf_flags_v1(flags), done);
 }
 
 bool linux_dmabuf_params_v1_impl::validate_params(QSize const& size)
@@ -433,4 +668,64 @@ linux_dmabuf_buffer_v1_res_impl::linux_dmabuf_buffer_v1_res_impl(Client* client,
 
 struct wl_buffer_interface const linux_dmabuf_buffer_v1_res_impl::s_interface = {destroyCallback};
 
+linux_dmabuf_feedback_v1_res::linux_dmabuf_feedback_v1_res(Client* client,
+                                                           uint32_t version,
+                                                           uint32_t id,
+                                                           Surface* surface)
+    : surface{surface}
+    , impl{new linux_dmabuf_feedback_v1_res_impl(client, version, id, this)}
+{
+}
+
+linux_dmabuf_feedback_v1_res_impl::linux_dmabuf_feedback_v1_res_impl(
+    Client* client,
+    uint32_t version,
+    uint32_t id,
+    linux_dmabuf_feedback_v1_res* q_ptr)
+    : Wayland::Resource<linux_dmabuf_feedback_v1_res>(client,
+                                                      version,
+                                                      id,
+                                                      &zwp_linux_dmabuf_feedback_v1_interface,
+                                                      &s_interface,
+                                                      q_ptr)
+{
+}
+
+struct zwp_linux_dmabuf_feedback_v1_interface const linux_dmabuf_feedback_v1_res_impl::s_interface
+    = {destroyCallback};
+
+void linux_dmabuf_feedback_v1_res_impl::send_feedback(linux_dmabuf_feedback_v1_data const& data)
+{
+    if (data.table_fd < 0) {
+        return;
+    }
+
+    send<zwp_linux_dmabuf_feedback_v1_send_format_table>(data.table_fd, data.table_size);
+
+    // The arrays only wrap existing memory for sending and are not released.
+    auto device_id = data.feedback.main_device;
+    wl_array device{.size = sizeof(dev_t), .alloc = sizeof(dev_t), .data = &device_id};
+    send<zwp_linux_dmabuf_feedback_v1_send_main_device>(&device);
+
+    for (size_t i = 0; i < data.feedback.tranches.size(); i++) {
+        auto const& tranche = data.feedback.tranches.at(i);
+        auto const& indices = data.tranche_indices.at(i);
+
+        device_id = tranche.device;
+        send<zwp_linux_dmabuf_feedback_v1_send_tranche_target_device>(&device);
+
+        wl_array formats{
+            .size = indices.size() * sizeof(uint16_t),
+            .alloc = indices.size() * sizeof(uint16_t),
+            .data = const_cast<uint16_t*>(indices.data()),
+        };
+        send<zwp_linux_dmabuf_feedback_v1_send_tranche_formats>(&formats);
+        send<zwp_linux_dmabuf_feedback_v1_send_tranche_flags>(
+            static_cast<uint32_t>(tranche.flags));
+        send<zwp_linux_dmabuf_feedback_v1_send_tranche_done>();
+    }
+
+    send<zwp_linux_dmabuf_feedback_v1_send_done>();
+}
+
 }
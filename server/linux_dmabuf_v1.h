@@ -27,6 +27,8 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <functional>
 #include <memory>
+#include <optional>
+#include <sys/types.h>
 #include <unistd.h>
 #include <unordered_set>
 #include <vector>
@@ -36,6 +38,7 @@ namespace Wrapland::Server
 
 class Buffer;
 class Display;
+class Surface;
 
 struct drm_format {
     uint32_t format;
@@ -50,6 +53,29 @@ enum class linux_dmabuf_flag_v1 {
 
 Q_DECLARE_FLAGS(linux_dmabuf_flags_v1, linux_dmabuf_flag_v1)
 
+enum class linux_dmabuf_tranche_flag_v1 {
+    scanout = 0x1,
+};
+
+Q_DECLARE_FLAGS(linux_dmabuf_tranche_flags_v1, linux_dmabuf_tranche_flag_v1)
+
+struct linux_dmabuf_tranche_v1 {
+    /// Device the buffers allocated with the formats of this tranche should be accessible by.
+    dev_t device{0};
+    linux_dmabuf_tranche_flags_v1 flags;
+    std::vector<drm_format> formats;
+};
+
+/**
+ * Buffer allocation preferences for clients binding version 4 or later. The main device is the
+ * one used by the compositor for compositing and must be set. Tranches are ordered by descending
+ * preference.
+ */
+struct linux_dmabuf_feedback_v1 {
+    dev_t main_device{0};
+    std::vector<linux_dmabuf_tranche_v1> tranches;
+};
+
 struct linux_dmabuf_plane_v1 {
     int fd;
     uint32_t offset;
@@ -94,15 +120,63 @@ using linux_dmabuf_import_v1 = std::function<std::unique_ptr<linux_dmabuf_buffer
     QSize const& size,
     linux_dmabuf_flags_v1 flags)>;
 
+/**
+ * Finishes an asynchronous import. It must be called exactly once and in the thread of the
+ * display. Pass null if the import failed.
+ */
+using linux_dmabuf_import_done_v1 = std::function<void(std::unique_ptr<linux_dmabuf_buffer_v1>)>;
+
+using linux_dmabuf_async_import_v1
+    = std::function<void(std::vector<linux_dmabuf_plane_v1> const& planes,
+                         uint32_t format,
+                         uint64_t modifier,
+                         QSize const& size,
+                         linux_dmabuf_flags_v1 flags,
+                         linux_dmabuf_import_done_v1 done)>;
+
 class WRAPLANDSERVER_EXPORT linux_dmabuf_v1 : public QObject
 {
     Q_OBJECT
 public:
-    linux_dmabuf_v1(Display* display, linux_dmabuf_import_v1 import);
+    /**
+     * Version 4 of the protocol is only advertised with a @p default_feedback. Without it clients
+     * receive the formats from set_formats as format and modifier events.
+     */
+    linux_dmabuf_v1(Display* display,
+                    linux_dmabuf_import_v1 import,
+                    std::optional<linux_dmabuf_feedback_v1> const& default_feedback = {});
+
+    /**
+     * Imports buffers asynchronously. Requests of clients are dispatched further while an import
+     * is running.
+     *
+     * Buffers created with create_immed can be attached before their import is done. Until then
+     * Buffer::linuxDmabufBuffer returns null and the buffer size is not known. Surface commits with
+     * such a buffer are queued and applied once the import is done. Synchronized subsurfaces are
+     * an exception since their state is applied together with their parent.
+     */
+    linux_dmabuf_v1(Display* display,
+                    linux_dmabuf_async_import_v1 import,
+                    std::optional<linux_dmabuf_feedback_v1> const& default_feedback = {});
     ~linux_dmabuf_v1() override;
 
     void set_formats(std::vector<drm_format> const& formats);
 
+    /**
+     * Sets the feedback sent to clients requesting the default feedback and for surfaces without
+     * their own feedback. It has only an effect when the global was created with a default
+     * feedback. Feedback without a main device is ignored.
+     */
+    void set_default_feedback(linux_dmabuf_feedback_v1 const& feedback);
+
+    /**
+     * Sets the feedback for @p surface. Call it whenever the preferences for the surface change,
+     * for example when it moves to another output or becomes a candidate for direct scanout and
+     * should get a tranche flagged for scanout. Unset the feedback to fall back to the default one.
+     */
+    void set_surface_feedback(Surface* surface,
+                              std::optional<linux_dmabuf_feedback_v1> const& feedback);
+
 private:
     friend class Buffer;
     friend class linux_dmabuf_params_v1;
@@ -116,3 +190,4 @@ private:
 
 Q_DECLARE_METATYPE(Wrapland::Server::linux_dmabuf_v1*)
 Q_DECLARE_OPERATORS_FOR_FLAGS(Wrapland::Server::linux_dmabuf_flags_v1)
+Q_DECLARE_OPERATORS_FOR_FLAGS(Wrapland::Server::linux_dmabuf_tranche_flags_v1)
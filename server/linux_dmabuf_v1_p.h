@@ -29,29 +29,71 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <array>
 #include <drm_fourcc.h>
+#include <unordered_map>
 
 namespace Wrapland::Server
 {
 
+class linux_dmabuf_feedback_v1_res;
 class linux_dmabuf_params_v1;
 
-constexpr uint32_t linux_dmabuf_v1_version = 3;
+constexpr uint32_t linux_dmabuf_v1_version = 4;
 using linux_dmabuf_v1_global = Wayland::Global<linux_dmabuf_v1, linux_dmabuf_v1_version>;
 using linux_dmabuf_v1_bind = Wayland::Bind<linux_dmabuf_v1_global>;
 
+/// Feedback prepared for sending. The format table is shared with clients through a sealed memfd.
+class linux_dmabuf_feedback_v1_data
+{
+public:
+    explicit linux_dmabuf_feedback_v1_data(linux_dmabuf_feedback_v1 feedback);
+    ~linux_dmabuf_feedback_v1_data();
+    linux_dmabuf_feedback_v1_data(linux_dmabuf_feedback_v1_data const&) = delete;
+    linux_dmabuf_feedback_v1_data& operator=(linux_dmabuf_feedback_v1_data const&) = delete;
+    linux_dmabuf_feedback_v1_data(linux_dmabuf_feedback_v1_data&&) = delete;
+    linux_dmabuf_feedback_v1_data& operator=(linux_dmabuf_feedback_v1_data&&) = delete;
+
+    linux_dmabuf_feedback_v1 feedback;
+
+    int table_fd{-1};
+    uint32_t table_size{0};
+
+    /// Per tranche the indices of its format-modifier pairs in the table.
+    std::vector<std::vector<uint16_t>> tranche_indices;
+};
+
 class linux_dmabuf_v1::Private : public linux_dmabuf_v1_global
 {
 public:
-    Private(linux_dmabuf_v1* q_ptr, Display* display, linux_dmabuf_import_v1 import);
+    Private(linux_dmabuf_v1* q_ptr,
+            Display* display,
+            linux_dmabuf_async_import_v1 import,
+            std::optional<linux_dmabuf_feedback_v1> const& default_feedback);
     ~Private() override;
 
     void bindInit(linux_dmabuf_v1_bind* bind) final;
     static void create_params_callback(linux_dmabuf_v1_bind* bind, uint32_t id);
+    static void get_default_feedback_callback(linux_dmabuf_v1_bind* bind, uint32_t id);
+    static void
+    get_surface_feedback_callback(linux_dmabuf_v1_bind* bind, uint32_t id, wl_resource* wlSurface);
+
+    linux_dmabuf_feedback_v1_data const& get_feedback(Surface* surface) const;
+    void add_feedback(linux_dmabuf_feedback_v1_res* res);
+    void update_feedbacks(Surface* surface);
 
     std::vector<linux_dmabuf_params_v1*> pending_params;
-    linux_dmabuf_import_v1 import;
+    linux_dmabuf_async_import_v1 import;
     std::vector<drm_format> supported_formats;
 
+    /// Null when the global is created with version 3 and clients cannot request feedback.
+    std::unique_ptr<linux_dmabuf_feedback_v1_data> default_feedback;
+
+    struct surface_feedback {
+        std::unique_ptr<linux_dmabuf_feedback_v1_data> data;
+        QMetaObject::Connection destroy_notifier;
+    };
+    std::unordered_map<Surface*, surface_feedback> surface_feedbacks;
+    std::vector<linux_dmabuf_feedback_v1_res*> feedbacks;
+
 private:
     static const struct zwp_linux_dmabuf_v1_interface s_interface;
 };
@@ -67,10 +109,12 @@ public:
                                uint32_t id,
                                std::unique_ptr<linux_dmabuf_buffer_v1> handle);
 
+    /// Null while the import is running.
     std::unique_ptr<linux_dmabuf_buffer_v1> handle;
     linux_dmabuf_buffer_v1_res_impl* impl;
 
 Q_SIGNALS:
+    void imported();
     void resourceDestroyed();
 };
 
@@ -85,6 +129,35 @@ public:
     static struct wl_buffer_interface const s_interface;
 };
 
+class linux_dmabuf_feedback_v1_res_impl;
+
+class linux_dmabuf_feedback_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    linux_dmabuf_feedback_v1_res(Client* client, uint32_t version, uint32_t id, Surface* surface);
+
+    /// The surface the feedback is for or null for default feedback.
+    Surface* surface;
+    linux_dmabuf_feedback_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class linux_dmabuf_feedback_v1_res_impl : public Wayland::Resource<linux_dmabuf_feedback_v1_res>
+{
+public:
+    linux_dmabuf_feedback_v1_res_impl(Client* client,
+                                      uint32_t version,
+                                      uint32_t id,
+                                      linux_dmabuf_feedback_v1_res* q_ptr);
+
+    void send_feedback(linux_dmabuf_feedback_v1_data const& data);
+
+    static struct zwp_linux_dmabuf_feedback_v1_interface const s_interface;
+};
+
 class linux_dmabuf_params_v1_impl : public Wayland::Resource<linux_dmabuf_params_v1>
 {
 public:
@@ -0,0 +1,235 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "linux_drm_syncobj_v1_p.h"
+
+#include "buffer.h"
+#include "client.h"
+#include "display.h"
+#include "linux_dmabuf_v1_p.h"
+#include "surface_p.h"
+
+#include "wayland-server-protocol.h"
+
+namespace Wrapland::Server
+{
+
+struct wp_linux_drm_syncobj_manager_v1_interface const
+    linux_drm_syncobj_manager_v1::Private::s_interface
+    = {
+        resourceDestroyCallback,
+        cb<get_surface_callback>,
+        cb<import_timeline_callback>,
+};
+
+linux_drm_syncobj_manager_v1::Private::Private(Display* display,
+                                               linux_drm_syncobj_import_v1 import,
+                                               linux_drm_syncobj_manager_v1* q_ptr)
+    : linux_drm_syncobj_manager_v1_global(q_ptr,
+                                          display,
+                                          &wp_linux_drm_syncobj_manager_v1_interface,
+                                          &s_interface)
+    , import{std::move(import)}
+{
+    create();
+}
+
+void linux_drm_syncobj_manager_v1::Private::get_surface_callback(
+    linux_drm_syncobj_manager_v1_bind* bind,
+    uint32_t id,
+    wl_resource* wlSurface)
+{
+    auto surface = Wayland::Resource<Surface>::get_handle(wlSurface);
+
+    if (surface->d_ptr->syncobj_surface) {
+        bind->post_error(WP_LINUX_DRM_SYNCOBJ_MANAGER_V1_ERROR_SURFACE_EXISTS,
+                         "Surface already has a synchronization object");
+        return;
+    }
+
+    auto syncobj_surface
+        = new linux_drm_syncobj_surface_v1_res(bind->client->handle, bind->version, id, surface);
+    surface->d_ptr->install_syncobj_surface(syncobj_surface);
+}
+
+void linux_drm_syncobj_manager_v1::Private::import_timeline_callback(
+    linux_drm_syncobj_manager_v1_bind* bind,
+    uint32_t id,
+    int32_t fd)
+{
+    auto priv = get_handle(bind->resource)->d_ptr.get();
+
+    auto timeline = priv->import(fd);
+    if (!timeline) {
+        bind->post_error(WP_LINUX_DRM_SYNCOBJ_MANAGER_V1_ERROR_INVALID_TIMELINE,
+                         "Importing the timeline failed");
+        return;
+    }
+
+    new linux_drm_syncobj_timeline_v1_res(
+        bind->client->handle, bind->version, id, std::move(timeline));
+}
+
+linux_drm_syncobj_manager_v1::linux_drm_syncobj_manager_v1(Display* display,
+                                                           linux_drm_syncobj_import_v1 import)
+    : d_ptr(new Private(display, std::move(import), this))
+{
+}
+
+linux_drm_syncobj_manager_v1::~linux_drm_syncobj_manager_v1() = default;
+
+linux_drm_syncobj_timeline_v1_res::linux_drm_syncobj_timeline_v1_res(
+    Client* client,
+    uint32_t version,
+    uint32_t id,
+    std::shared_ptr<linux_drm_syncobj_timeline_v1> timeline)
+    : timeline{std::move(timeline)}
+    , impl{new linux_drm_syncobj_timeline_v1_res_impl(client, version, id, this)}
+{
+}
+
+struct wp_linux_drm_syncobj_timeline_v1_interface const
+    linux_drm_syncobj_timeline_v1_res_impl::s_interface
+    = {destroyCallback};
+
+linux_drm_syncobj_timeline_v1_res_impl::linux_drm_syncobj_timeline_v1_res_impl(
+    Client* client,
+    uint32_t version,
+    uint32_t id,
+    linux_drm_syncobj_timeline_v1_res* q_ptr)
+    : Wayland::Resource<linux_drm_syncobj_timeline_v1_res>(
+        client,
+        version,
+        id,
+        &wp_linux_drm_syncobj_timeline_v1_interface,
+        &s_interface,
+        q_ptr)
+{
+}
+
+linux_drm_syncobj_surface_v1_res::linux_drm_syncobj_surface_v1_res(Client* client,
+                                                                   uint32_t version,
+                                                                   uint32_t id,
+                                                                   Surface* surface)
+    : surface{surface}
+    , impl{new linux_drm_syncobj_surface_v1_res_impl(client, version, id, this)}
+{
+    connect(surface, &Surface::resourceDestroyed, this, [this] { this->surface = nullptr; });
+}
+
+bool linux_drm_syncobj_surface_v1_res::check_commit(SurfaceState const& pending)
+{
+    auto const& state = pending.pub;
+    auto const has_buffer = (state.updates & surface_change::buffer) && state.buffer;
+
+    if (!has_buffer) {
+        if (state.acquire_point || state.release_point) {
+            impl->postError(WP_LINUX_DRM_SYNCOBJ_SURFACE_V1_ERROR_NO_BUFFER,
+                            "Synchronization points set without a buffer");
+            return false;
+        }
+        return true;
+    }
+
+    if (!state.acquire_point) {
+        impl->postError(WP_LINUX_DRM_SYNCOBJ_SURFACE_V1_ERROR_NO_ACQUIRE_POINT,
+                        "Buffer attached without acquire point");
+        return false;
+    }
+    if (!state.release_point) {
+        impl->postError(WP_LINUX_DRM_SYNCOBJ_SURFACE_V1_ERROR_NO_RELEASE_POINT,
+                        "Buffer attached without release point");
+        return false;
+    }
+
+    if (!wl_resource_instance_of(state.buffer->resource(),
+                                 &wl_buffer_interface,
+                                 &linux_dmabuf_buffer_v1_res_impl::s_interface)) {
+        impl->postError(WP_LINUX_DRM_SYNCOBJ_SURFACE_V1_ERROR_UNSUPPORTED_BUFFER,
+                        "Explicit synchronization requires a dmabuf buffer");
+        return false;
+    }
+
+    if (state.acquire_point->timeline == state.release_point->timeline
+        && state.acquire_point->value >= state.release_point->value) {
+        impl->postError(WP_LINUX_DRM_SYNCOBJ_SURFACE_V1_ERROR_CONFLICTING_POINTS,
+                        "Release point must be after acquire point on the same timeline");
+        return false;
+    }
+
+    return true;
+}
+
+struct wp_linux_drm_syncobj_surface_v1_interface const
+    linux_drm_syncobj_surface_v1_res_impl::s_interface
+    = {
+        destroyCallback,
+        set_acquire_point_callback,
+        set_release_point_callback,
+};
+
+linux_drm_syncobj_surface_v1_res_impl::linux_drm_syncobj_surface_v1_res_impl(
+    Client* client,
+    uint32_t version,
+    uint32_t id,
+    linux_drm_syncobj_surface_v1_res* q_ptr)
+    : Wayland::Resource<linux_drm_syncobj_surface_v1_res>(
+        client,
+        version,
+        id,
+        &wp_linux_drm_syncobj_surface_v1_interface,
+        &s_interface,
+        q_ptr)
+{
+}
+
+void linux_drm_syncobj_surface_v1_res_impl::set_acquire_point_callback(
+    [[maybe_unused]] wl_client* wlClient,
+    wl_resource* wlResource,
+    wl_resource* wlTimeline,
+    uint32_t point_hi,
+    uint32_t point_lo)
+{
+    auto res = get_handle(wlResource);
+    if (!res->surface) {
+        res->impl->postError(WP_LINUX_DRM_SYNCOBJ_SURFACE_V1_ERROR_NO_SURFACE,
+                             "Surface was destroyed");
+        return;
+    }
+    res->impl->set_point(
+        wlTimeline, point_hi, point_lo, res->surface->d_ptr->pending.pub.acquire_point);
+}
+
+void linux_drm_syncobj_surface_v1_res_impl::set_release_point_callback(
+    [[maybe_unused]] wl_client* wlClient,
+    wl_resource* wlResource,
+    wl_resource* wlTimeline,
+    uint32_t point_hi,
+    uint32_t point_lo)
+{
+    auto res = get_handle(wlResource);
+    if (!res->surface) {
+        res->impl->postError(WP_LINUX_DRM_SYNCOBJ_SURFACE_V1_ERROR_NO_SURFACE,
+                             "Surface was destroyed");
+        return;
+    }
+    res->impl->set_point(
+        wlTimeline, point_hi, point_lo, res->surface->d_ptr->pending.pub.release_point);
+}
+
+void linux_drm_syncobj_surface_v1_res_impl::set_point(
+    wl_resource* wlTimeline,
+    uint32_t point_hi,
+    uint32_t point_lo,
+    std::optional<linux_drm_syncobj_point_v1>& point)
+{
+    auto timeline = Wayland::Resource<linux_drm_syncobj_timeline_v1_res>::get_handle(wlTimeline);
+    point = linux_drm_syncobj_point_v1{
+        .timeline = timeline->timeline,
+        .value = (static_cast<uint64_t>(point_hi) << 32) | point_lo,
+    };
+}
+
+}
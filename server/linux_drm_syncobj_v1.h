@@ -0,0 +1,70 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * A DRM synchronization object timeline imported by the compositor.
+ *
+ * Compositors subclass it to wrap their DRM syncobj handle. It is shared between all surface
+ * states referencing it and is kept alive after the client destroyed the protocol object.
+ */
+class WRAPLANDSERVER_EXPORT linux_drm_syncobj_timeline_v1
+{
+public:
+    virtual ~linux_drm_syncobj_timeline_v1() = default;
+
+    /**
+     * Called when the buffer a release point was set for is no longer used by the compositor.
+     * Implementations signal @p point on the timeline.
+     */
+    virtual void signal(uint64_t point) = 0;
+};
+
+struct linux_drm_syncobj_point_v1 {
+    std::shared_ptr<linux_drm_syncobj_timeline_v1> timeline;
+    uint64_t value{0};
+};
+
+/**
+ * Imports the DRM syncobj timeline file descriptor @p fd. Ownership of @p fd is passed on.
+ *
+ * @return The imported timeline or null if the import failed.
+ */
+using linux_drm_syncobj_import_v1
+    = std::function<std::shared_ptr<linux_drm_syncobj_timeline_v1>(int fd)>;
+
+/**
+ * Global for the wp_linux_drm_syncobj_manager_v1 interface.
+ *
+ * Clients use it to set acquire and release points for the buffers they attach. The acquire
+ * point is available through surface_state::acquire_point once committed. The compositor must
+ * wait for it to be signaled before accessing the buffer. The release point is signaled when the
+ * Buffer is destroyed, i.e. once the compositor dropped all references to it.
+ */
+class WRAPLANDSERVER_EXPORT linux_drm_syncobj_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    linux_drm_syncobj_manager_v1(Display* display, linux_drm_syncobj_import_v1 import);
+    ~linux_drm_syncobj_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
@@ -0,0 +1,128 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "linux_drm_syncobj_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <optional>
+#include <wayland-linux-drm-syncobj-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+class Surface;
+class SurfaceState;
+
+constexpr uint32_t linux_drm_syncobj_manager_v1_version = 1;
+using linux_drm_syncobj_manager_v1_global
+    = Wayland::Global<linux_drm_syncobj_manager_v1, linux_drm_syncobj_manager_v1_version>;
+using linux_drm_syncobj_manager_v1_bind = Wayland::Bind<linux_drm_syncobj_manager_v1_global>;
+
+class linux_drm_syncobj_manager_v1::Private : public linux_drm_syncobj_manager_v1_global
+{
+public:
+    Private(Display* display,
+            linux_drm_syncobj_import_v1 import,
+            linux_drm_syncobj_manager_v1* q_ptr);
+
+    linux_drm_syncobj_import_v1 import;
+
+private:
+    static void get_surface_callback(linux_drm_syncobj_manager_v1_bind* bind,
+                                     uint32_t id,
+                                     wl_resource* wlSurface);
+    static void
+    import_timeline_callback(linux_drm_syncobj_manager_v1_bind* bind, uint32_t id, int32_t fd);
+
+    static struct wp_linux_drm_syncobj_manager_v1_interface const s_interface;
+};
+
+class linux_drm_syncobj_timeline_v1_res_impl;
+
+class linux_drm_syncobj_timeline_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    linux_drm_syncobj_timeline_v1_res(Client* client,
+                                      uint32_t version,
+                                      uint32_t id,
+                                      std::shared_ptr<linux_drm_syncobj_timeline_v1> timeline);
+
+    std::shared_ptr<linux_drm_syncobj_timeline_v1> timeline;
+    linux_drm_syncobj_timeline_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class linux_drm_syncobj_timeline_v1_res_impl
+    : public Wayland::Resource<linux_drm_syncobj_timeline_v1_res>
+{
+public:
+    linux_drm_syncobj_timeline_v1_res_impl(Client* client,
+                                           uint32_t version,
+                                           uint32_t id,
+                                           linux_drm_syncobj_timeline_v1_res* q_ptr);
+
+    static struct wp_linux_drm_syncobj_timeline_v1_interface const s_interface;
+};
+
+class linux_drm_syncobj_surface_v1_res_impl;
+
+class linux_drm_syncobj_surface_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    linux_drm_syncobj_surface_v1_res(Client* client,
+                                     uint32_t version,
+                                     uint32_t id,
+                                     Surface* surface);
+
+    /**
+     * Posts a protocol error and returns false if the synchronization points in the @p pending
+     * state do not fit its buffer.
+     */
+    bool check_commit(SurfaceState const& pending);
+
+    Surface* surface;
+    linux_drm_syncobj_surface_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class linux_drm_syncobj_surface_v1_res_impl
+    : public Wayland::Resource<linux_drm_syncobj_surface_v1_res>
+{
+public:
+    linux_drm_syncobj_surface_v1_res_impl(Client* client,
+                                          uint32_t version,
+                                          uint32_t id,
+                                          linux_drm_syncobj_surface_v1_res* q_ptr);
+
+    static struct wp_linux_drm_syncobj_surface_v1_interface const s_interface;
+
+private:
+    void set_point(wl_resource* wlTimeline,
+                   uint32_t point_hi,
+                   uint32_t point_lo,
+                   std::optional<linux_drm_syncobj_point_v1>& point);
+
+    static void set_acquire_point_callback(wl_client* wlClient,
+                                           wl_resource* wlResource,
+                                           wl_resource* wlTimeline,
+                                           uint32_t point_hi,
+                                           uint32_t point_lo);
+    static void set_release_point_callback(wl_client* wlClient,
+                                           wl_resource* wlResource,
+                                           wl_resource* wlTimeline,
+                                           uint32_t point_hi,
+                                           uint32_t point_lo);
+};
+
+}
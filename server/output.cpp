@@ -117,8 +117,9 @@ void output::Private::done()
             xdg_output.reset();
         }
     }
+    auto wayland_change = false;
     if (pending.state.enabled) {
-        auto wayland_change = wayland_output->d_ptr->broadcast();
+        wayland_change = wayland_output->d_ptr->broadcast();
         auto xdg_change = xdg_output ? xdg_output->d_ptr->broadcast() : false;
         if (wayland_change || xdg_change) {
             wayland_output->d_ptr->done();
@@ -135,6 +136,10 @@ void output::Private::done()
         }
     }
     published = pending;
+
+    if (wayland_change) {
+        Q_EMIT wayland_output->state_changed();
+    }
 }
 
 void output::Private::done_wl(Client* client) const
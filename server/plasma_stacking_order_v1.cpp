@@ -0,0 +1,111 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "plasma_stacking_order_v1_p.h"
+
+#include "client.h"
+#include "display.h"
+
+namespace Wrapland::Server
+{
+
+struct wrapland_plasma_stacking_order_manager_v1_interface const
+    plasma_stacking_order_manager_v1::Private::s_interface
+    = {
+        resourceDestroyCallback,
+        cb<get_stacking_order_callback>,
+};
+
+plasma_stacking_order_manager_v1::Private::Private(Display* display,
+                                                   plasma_stacking_order_manager_v1* q_ptr)
+    : plasma_stacking_order_manager_v1_global(q_ptr,
+                                              display,
+                                              &wrapland_plasma_stacking_order_manager_v1_interface,
+                                              &s_interface)
+{
+    create();
+}
+
+void plasma_stacking_order_manager_v1::Private::get_stacking_order_callback(
+    plasma_stacking_order_manager_v1_bind* bind,
+    uint32_t id,
+    wl_resource* wlWindowManagement)
+{
+    auto wm = PlasmaWindowManager::Private::get_private(wlWindowManagement);
+    auto wm_bind = wm ? wm->getBind(wlWindowManagement) : nullptr;
+
+    if (wm_bind && wm->get_stacking_order(wm_bind)) {
+        bind->post_error(WRAPLAND_PLASMA_STACKING_ORDER_MANAGER_V1_ERROR_ALREADY_CONSTRUCTED,
+                         "Window management already has a stacking order object");
+        return;
+    }
+
+    auto stacking_order = new plasma_stacking_order_v1_res(bind->client->handle, bind->version, id);
+    if (!wm_bind) {
+        // The window management global is gone. The object stays inert.
+        return;
+    }
+
+    stacking_order->wm_bind = wm_bind;
+    wm->add_stacking_order(stacking_order);
+}
+
+plasma_stacking_order_manager_v1::plasma_stacking_order_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+plasma_stacking_order_manager_v1::~plasma_stacking_order_manager_v1() = default;
+
+plasma_stacking_order_v1_res::plasma_stacking_order_v1_res(Client* client,
+                                                           uint32_t version,
+                                                           uint32_t id)
+    : impl{new plasma_stacking_order_v1_res_impl(client, version, id, this)}
+{
+}
+
+void plasma_stacking_order_v1_res::send_stack(std::vector<std::string> const& stack,
+                                              uint32_t serial)
+{
+    impl->send<wrapland_plasma_stacking_order_v1_send_reset>();
+    for (size_t i = 0; i < stack.size(); i++) {
+        impl->send<wrapland_plasma_stacking_order_v1_send_inserted>(stack.at(i).data(),
+                                                                    static_cast<uint32_t>(i));
+    }
+    impl->send<wrapland_plasma_stacking_order_v1_send_done>(serial);
+}
+
+void plasma_stacking_order_v1_res::send_delta(stacking_order_delta const& delta, uint32_t serial)
+{
+    for (auto const& uuid : delta.removed) {
+        impl->send<wrapland_plasma_stacking_order_v1_send_removed>(uuid.data());
+    }
+    for (auto const& [uuid, position] : delta.inserted) {
+        impl->send<wrapland_plasma_stacking_order_v1_send_inserted>(uuid.data(), position);
+    }
+    impl->send<wrapland_plasma_stacking_order_v1_send_done>(serial);
+}
+
+struct wrapland_plasma_stacking_order_v1_interface const
+    plasma_stacking_order_v1_res_impl::s_interface
+    = {
+        destroyCallback,
+};
+
+plasma_stacking_order_v1_res_impl::plasma_stacking_order_v1_res_impl(
+    Client* client,
+    uint32_t version,
+    uint32_t id,
+    plasma_stacking_order_v1_res* q_ptr)
+    : Wayland::Resource<plasma_stacking_order_v1_res>(client,
+                                                      version,
+                                                      id,
+                                                      &wrapland_plasma_stacking_order_v1_interface,
+                                                      &s_interface,
+                                                      q_ptr)
+{
+}
+
+}
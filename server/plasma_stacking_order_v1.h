@@ -0,0 +1,37 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * Global for the wrapland_plasma_stacking_order_manager_v1 interface.
+ *
+ * Clients of the PlasmaWindowManager get through it the changes of the uuid stacking order
+ * instead of the complete stack on every change. The stack is still set with
+ * PlasmaWindowManager::set_stacking_order_uuids. Clients not using this global keep receiving the
+ * complete stack.
+ */
+class WRAPLANDSERVER_EXPORT plasma_stacking_order_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit plasma_stacking_order_manager_v1(Display* display);
+    ~plasma_stacking_order_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
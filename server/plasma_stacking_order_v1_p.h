@@ -0,0 +1,68 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "plasma_stacking_order_v1.h"
+#include "plasma_window_p.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <wayland-wrapland-plasma-stacking-order-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+
+constexpr uint32_t plasma_stacking_order_manager_v1_version = 1;
+using plasma_stacking_order_manager_v1_global
+    = Wayland::Global<plasma_stacking_order_manager_v1, plasma_stacking_order_manager_v1_version>;
+using plasma_stacking_order_manager_v1_bind
+    = Wayland::Bind<plasma_stacking_order_manager_v1_global>;
+
+class plasma_stacking_order_manager_v1::Private : public plasma_stacking_order_manager_v1_global
+{
+public:
+    Private(Display* display, plasma_stacking_order_manager_v1* q_ptr);
+
+private:
+    static void get_stacking_order_callback(plasma_stacking_order_manager_v1_bind* bind,
+                                            uint32_t id,
+                                            wl_resource* wlWindowManagement);
+
+    static struct wrapland_plasma_stacking_order_manager_v1_interface const s_interface;
+};
+
+class plasma_stacking_order_v1_res_impl;
+
+class plasma_stacking_order_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    plasma_stacking_order_v1_res(Client* client, uint32_t version, uint32_t id);
+
+    void send_stack(std::vector<std::string> const& stack, uint32_t serial);
+    void send_delta(stacking_order_delta const& delta, uint32_t serial);
+
+    // Null once the window management object is gone.
+    PlasmaWindowManagerBind* wm_bind{nullptr};
+    plasma_stacking_order_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class plasma_stacking_order_v1_res_impl : public Wayland::Resource<plasma_stacking_order_v1_res>
+{
+public:
+    plasma_stacking_order_v1_res_impl(Client* client,
+                                      uint32_t version,
+                                      uint32_t id,
+                                      plasma_stacking_order_v1_res* q_ptr);
+
+    static struct wrapland_plasma_stacking_order_v1_interface const s_interface;
+};
+
+}
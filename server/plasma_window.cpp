@@ -21,22 +21,26 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "display.h"
 #include "output.h"
+#include "plasma_stacking_order_v1_p.h"
 #include "plasma_virtual_desktop.h"
 #include "surface.h"
 #include "utils.h"
 #include "wl_output_p.h"
 
-#include <QFile>
+#include <QDataStream>
 #include <QHash>
 #include <QIcon>
 #include <QList>
 #include <QRect>
-#include <QThreadPool>
 #include <QUuid>
 #include <QVector>
 
+#include <algorithm>
 #include <cassert>
-#include <csignal>
+#include <limits>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
 #include <wayland-server.h>
 
 namespace Wrapland::Server
@@ -61,11 +65,6 @@ PlasmaWindowManager::Private::Private(Display* display, PlasmaWindowManager* q_p
 PlasmaWindowManager::PlasmaWindowManager(Display* display)
     : d_ptr(new Private(display, this))
 {
-    // Needed because the icon is sent via a pipe and when it closes while being written to would
-    // kill off the compositor.
-    // TODO(romangg): Replace the pipe with a Unix domain socket and set on it to ignore the SIGPIPE
-    //                signal. See issue #7.
-    signal(SIGPIPE, SIG_IGN); // NOLINT
 }
 
 PlasmaWindowManager::~PlasmaWindowManager()
@@ -90,6 +89,20 @@ void PlasmaWindowManager::Private::bindInit(PlasmaWindowManagerBind* bind)
     send_stacking_order_uuid_changed(bind);
 }
 
+void PlasmaWindowManager::Private::prepareUnbind(PlasmaWindowManagerBind* bind)
+{
+    if (auto stacking_order = get_stacking_order(bind)) {
+        stacking_order->wm_bind = nullptr;
+        remove_one(stacking_orders, stacking_order);
+    }
+}
+
+PlasmaWindowManager::Private* PlasmaWindowManager::Private::get_private(wl_resource* wlResource)
+{
+    auto handle = get_handle(wlResource);
+    return handle ? handle->d_ptr.get() : nullptr;
+}
+
 void PlasmaWindowManager::Private::sendShowingDesktopState()
 {
     uint32_t state = 0;
@@ -131,13 +144,6 @@ void PlasmaWindowManager::Private::send_stacking_order_changed(PlasmaWindowManag
     wl_array_release(&ids);
 }
 
-void PlasmaWindowManager::Private::send_stacking_order_uuid_changed()
-{
-    for (auto const bind : getBinds()) {
-        send_stacking_order_uuid_changed(bind);
-    }
-}
-
 void PlasmaWindowManager::Private::send_stacking_order_uuid_changed(PlasmaWindowManagerBind* bind)
 {
     if (bind->version
@@ -156,6 +162,127 @@ void PlasmaWindowManager::Private::send_stacking_order_uuid_changed(PlasmaWindow
     send<org_kde_plasma_window_management_send_stacking_order_uuid_changed>(bind, uuids.data());
 }
 
+void PlasmaWindowManager::Private::update_stacking_order_uuids(
+    std::vector<std::string> const& old_stack)
+{
+    uuid_stack_serial++;
+
+    for (auto const bind : getBinds()) {
+        if (!get_stacking_order(bind)) {
+            send_stacking_order_uuid_changed(bind);
+        }
+    }
+
+    if (stacking_orders.empty()) {
+        return;
+    }
+
+    auto const delta = get_stacking_order_delta(old_stack, uuid_stack);
+    auto const resync = uuid_stack_serial % s_stacking_order_resync_interval == 0
+        || delta.removed.size() + delta.inserted.size() >= uuid_stack.size();
+
+    for (auto stacking_order : stacking_orders) {
+        if (resync) {
+            stacking_order->send_stack(uuid_stack, uuid_stack_serial);
+        } else {
+            stacking_order->send_delta(delta, uuid_stack_serial);
+        }
+    }
+}
+
+stacking_order_delta
+PlasmaWindowManager::Private::get_stacking_order_delta(std::vector<std::string> const& old_stack,
+                                                       std::vector<std::string> const& new_stack)
+{
+    std::unordered_map<std::string, size_t> old_positions;
+    for (size_t i = 0; i < old_stack.size(); i++) {
+        old_positions.insert({old_stack.at(i), i});
+    }
+
+    // Windows in both stacks with their positions in the new and in the old stack.
+    std::vector<std::pair<size_t, size_t>> common;
+    std::vector<bool> in_new_stack(old_stack.size(), false);
+
+    for (size_t i = 0; i < new_stack.size(); i++) {
+        if (auto it = old_positions.find(new_stack.at(i)); it != old_positions.end()) {
+            common.emplace_back(i, it->second);
+            in_new_stack.at(it->second) = true;
+        }
+    }
+
+    // The longest subsequence of windows whose old positions are increasing keeps its relative
+    // order and does not need to move. Find it with patience sorting. The tails contain for each
+    // subsequence length the index in common with the smallest old position ending it.
+    constexpr auto none = std::numeric_limits<size_t>::max();
+    std::vector<size_t> tails;
+    std::vector<size_t> predecessors(common.size(), none);
+
+    for (size_t i = 0; i < common.size(); i++) {
+        auto it = std::lower_bound(
+            tails.begin(), tails.end(), common.at(i).second, [&common](auto tail, auto position) {
+                return common.at(tail).second < position;
+            });
+        if (it != tails.begin()) {
+            predecessors.at(i) = *std::prev(it);
+        }
+        if (it == tails.end()) {
+            tails.push_back(i);
+        } else {
+            *it = i;
+        }
+    }
+
+    std::vector<bool> kept(new_stack.size(), false);
+    for (auto i = tails.empty() ? none : tails.back(); i != none; i = predecessors.at(i)) {
+        kept.at(common.at(i).first) = true;
+    }
+
+    stacking_order_delta delta;
+    for (size_t i = 0; i < old_stack.size(); i++) {
+        if (!in_new_stack.at(i)) {
+            delta.removed.push_back(old_stack.at(i));
+        }
+    }
+    for (size_t i = 0; i < new_stack.size(); i++) {
+        if (kept.at(i)) {
+            continue;
+        }
+        if (old_positions.contains(new_stack.at(i))) {
+            delta.removed.push_back(new_stack.at(i));
+        }
+        delta.inserted.emplace_back(new_stack.at(i), static_cast<uint32_t>(i));
+    }
+
+    return delta;
+}
+
+plasma_stacking_order_v1_res*
+PlasmaWindowManager::Private::get_stacking_order(PlasmaWindowManagerBind* bind) const
+{
+    auto it = std::find_if(stacking_orders.cbegin(),
+                           stacking_orders.cend(),
+                           [bind](auto stacking_order) { return stacking_order->wm_bind == bind; });
+    return it == stacking_orders.cend() ? nullptr : *it;
+}
+
+void PlasmaWindowManager::Private::add_stacking_order(plasma_stacking_order_v1_res* stacking_order)
+{
+    stacking_orders.push_back(stacking_order);
+    QObject::connect(stacking_order,
+                     &plasma_stacking_order_v1_res::resourceDestroyed,
+                     handle,
+                     [this, stacking_order] {
+                         remove_one(stacking_orders, stacking_order);
+                         if (stacking_order->wm_bind) {
+                             // Without the stacking order object the bind falls back to the
+                             // complete stack.
+                             send_stacking_order_uuid_changed(stacking_order->wm_bind);
+                         }
+                     });
+
+    stacking_order->send_stack(uuid_stack, uuid_stack_serial);
+}
+
 void PlasmaWindowManager::Private::showDesktopCallback([[maybe_unused]] wl_client* wlClient,
                                                        wl_resource* wlResource,
                                                        uint32_t desktopState)
@@ -285,8 +412,8 @@ void PlasmaWindowManager::set_stacking_order_uuids(std::vector<std::string> cons
         return;
     }
 
-    d_ptr->uuid_stack = stack;
-    d_ptr->send_stacking_order_uuid_changed();
+    auto const old_stack = std::exchange(d_ptr->uuid_stack, stack);
+    d_ptr->update_stacking_order_uuids(old_stack);
 }
 
 void PlasmaWindowManager::setVirtualDesktopManager(PlasmaVirtualDesktopManager* manager)
@@ -418,6 +545,7 @@ void PlasmaWindow::Private::setThemedIconName(QString const& iconName)
 void PlasmaWindow::Private::setIcon(QIcon const& icon)
 {
     m_icon = icon;
+    icon_data.clear();
     setThemedIconName(m_icon.name());
     if (m_icon.name().isEmpty()) {
         for (auto&& res : resources) {
@@ -837,15 +965,16 @@ void PlasmaWindowRes::Private::getIconCallback([[maybe_unused]] wl_client* wlCli
 {
     auto priv = get_handle(wlResource)->d_ptr;
     if (!priv->window) {
+        close(fd);
         return;
     }
-    QThreadPool::globalInstance()->start([fd, icon = priv->window->d_ptr->m_icon] {
-        QFile file;
-        file.open(fd, QIODevice::WriteOnly, QFileDevice::AutoCloseHandle);
-        QDataStream ds(&file);
-        ds << icon;
-        file.close();
-    });
+
+    auto window_priv = priv->window->d_ptr.get();
+    if (window_priv->icon_data.isEmpty()) {
+        QDataStream stream(&window_priv->icon_data, QIODevice::WriteOnly);
+        stream << window_priv->m_icon;
+    }
+    priv->client->handle->display()->write_fd(fd, window_priv->icon_data);
 }
 
 void PlasmaWindowRes::Private::requestEnterVirtualDesktopCallback(
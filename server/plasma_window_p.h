@@ -27,6 +27,9 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include <QIcon>
 #include <QObject>
 
+#include <string>
+#include <utility>
+#include <vector>
 #include <wayland-plasma-window-management-server-protocol.h>
 
 class QSize;
@@ -39,11 +42,21 @@ class PlasmaWindow;
 class Surface;
 class PlasmaVirtualDesktopManager;
 class PlasmaWindowRes;
+class plasma_stacking_order_v1_res;
 
 constexpr uint32_t PlasmaWindowManagerVersion = 16;
 using PlasmaWindowManagerGlobal = Wayland::Global<PlasmaWindowManager, PlasmaWindowManagerVersion>;
 using PlasmaWindowManagerBind = Wayland::Bind<PlasmaWindowManagerGlobal>;
 
+/**
+ * Operations that turn one stacking order into another one. Moved windows are removed and inserted
+ * again. Insertions are sorted by position.
+ */
+struct stacking_order_delta {
+    std::vector<std::string> removed;
+    std::vector<std::pair<std::string, uint32_t>> inserted;
+};
+
 class PlasmaWindowManager::Private : public PlasmaWindowManagerGlobal
 {
 public:
@@ -52,18 +65,39 @@ public:
     void sendShowingDesktopState();
     void send_stacking_order_changed();
     void send_stacking_order_changed(PlasmaWindowManagerBind* bind);
-    void send_stacking_order_uuid_changed();
     void send_stacking_order_uuid_changed(PlasmaWindowManagerBind* bind);
 
+    /**
+     * Sends the change from @p old_stack to the current uuid stack. Binds with a stacking order
+     * object receive only the difference unless the complete stack is cheaper or due for a resync.
+     * All other binds receive the complete stack.
+     */
+    void update_stacking_order_uuids(std::vector<std::string> const& old_stack);
+
+    static stacking_order_delta get_stacking_order_delta(std::vector<std::string> const& old_stack,
+                                                         std::vector<std::string> const& new_stack);
+
+    plasma_stacking_order_v1_res* get_stacking_order(PlasmaWindowManagerBind* bind) const;
+    void add_stacking_order(plasma_stacking_order_v1_res* stacking_order);
+
+    /// Null when the global of @p wlResource was removed already.
+    static Private* get_private(wl_resource* wlResource);
+
     void bindInit(PlasmaWindowManagerBind* bind) override;
+    void prepareUnbind(PlasmaWindowManagerBind* bind) override;
 
     ShowingDesktopState desktopState = ShowingDesktopState::Disabled;
     std::vector<PlasmaWindow*> windows;
     std::vector<uint32_t> id_stack;
     std::vector<std::string> uuid_stack;
+    uint32_t uuid_stack_serial{0};
+    std::vector<plasma_stacking_order_v1_res*> stacking_orders;
     PlasmaVirtualDesktopManager* virtualDesktopManager = nullptr;
     uint32_t windowIdCounter = 0;
 
+    // Every that many changes the complete stacking order is sent even to stacking order objects.
+    static uint32_t constexpr s_stacking_order_resync_interval{64};
+
 private:
     static void
     showDesktopCallback(wl_client* client, wl_resource* resource, uint32_t desktopState);
@@ -121,6 +155,8 @@ private:
     uint32_t m_pid = 0;
     QString m_themedIconName;
     QIcon m_icon;
+    // The icon serialized for transfer. Created on first request and shared by all of them.
+    QByteArray icon_data;
     uint32_t m_virtualDesktop = 0;
     uint32_t m_desktopState = 0;
     struct {
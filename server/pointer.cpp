@@ -39,6 +39,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "surface.h"
 #include "surface_p.h"
 
+#include <utility>
 #include <wayland-server.h>
 
 namespace Wrapland::Server
@@ -74,14 +75,26 @@ Pointer::Private::Private(Client* client,
 
 void Pointer::Private::setCursor(quint32 serial, Surface* surface, QPoint const& hotspot)
 {
-    if (!cursor) {
-        cursor.reset(new Cursor(handle));
-        cursor->d_ptr->update(surface, serial, hotspot);
-        QObject::connect(cursor.get(), &Cursor::changed, handle, &Pointer::cursorChanged);
-        Q_EMIT handle->cursorChanged();
-    } else {
-        cursor->d_ptr->update(surface, serial, hotspot);
+    update_cursor([&](auto& cursor) { cursor.update(surface, serial, hotspot); });
+}
+
+void Pointer::Private::set_cursor_shape(quint32 serial, cursor_shape shape)
+{
+    update_cursor([&](auto& cursor) { cursor.update_shape(shape, serial); });
+}
+
+void Pointer::Private::update_cursor(std::function<void(Cursor::Private&)> const& update)
+{
+    if (cursor) {
+        update(*cursor->d_ptr);
+        return;
     }
+
+    // The first update is announced once through cursorChanged.
+    cursor.reset(new Cursor(handle));
+    update(*cursor->d_ptr);
+    QObject::connect(cursor.get(), &Cursor::changed, handle, &Pointer::cursorChanged);
+    Q_EMIT handle->cursorChanged();
 }
 
 void Pointer::Private::sendEnter(quint32 serial, Surface* surface, QPointF const& pos)
@@ -111,6 +124,17 @@ void Pointer::Private::sendFrame()
     send<wl_pointer_send_frame, WL_POINTER_FRAME_SINCE_VERSION>();
 }
 
+void Pointer::Private::send_held_back_motion()
+{
+    if (!std::exchange(motion_held_back, false) || !focusedSurface) {
+        return;
+    }
+
+    auto& pointers = seat->pointers();
+    handle->motion(pointers.get_focus().transformation.map(pointers.get_position()));
+    sendFrame();
+}
+
 void Pointer::Private::registerRelativePointer(RelativePointerV1* relativePointer)
 {
     relativePointers.push_back(relativePointer);
@@ -262,6 +286,7 @@ void Pointer::Private::cancelHoldGesture(quint32 serial)
 
 void Pointer::Private::setFocusedSurface(quint32 serial, Surface* surface)
 {
+    motion_held_back = false;
     sendLeave(serial, focusedSurface);
     disconnect(surfaceDestroyConnection);
     disconnect(clientDestroyConnection);
@@ -292,6 +317,11 @@ Pointer::Pointer(Client* client, uint32_t version, uint32_t id, Seat* seat)
     : QObject(nullptr)
     , d_ptr(new Private(client, version, id, seat, this))
 {
+    connect(client, &Client::hung_changed, this, [this](bool hung) {
+        if (!hung) {
+            d_ptr->send_held_back_motion();
+        }
+    });
 }
 
 void Pointer::setFocusedSurface(quint32 serial, Surface* surface)
@@ -407,6 +437,11 @@ void Pointer::motion(QPointF const& position)
     if (auto lock = d_ptr->focusedSurface->lockedPointer(); lock && lock->isLocked()) {
         return;
     }
+    if (d_ptr->client->events_throttled()) {
+        // The client does not read its events. It gets the current position once it recovers.
+        d_ptr->motion_held_back = true;
+        return;
+    }
 
     d_ptr->sendMotion(position);
 }
@@ -415,7 +450,7 @@ void Pointer::relativeMotion(QSizeF const& delta,
                              QSizeF const& deltaNonAccelerated,
                              quint64 microseconds)
 {
-    if (d_ptr->relativePointers.empty()) {
+    if (d_ptr->relativePointers.empty() || d_ptr->client->events_throttled()) {
         return;
     }
     for (auto relativePointer : d_ptr->relativePointers) {
@@ -436,40 +471,30 @@ Cursor::Private::Private(Cursor* q_ptr, Pointer* _pointer)
 
 void Cursor::Private::update(Surface* surface, quint32 serial, QPoint const& _hotspot)
 {
-    bool emitChanged = false;
-    if (enteredSerial != serial) {
-        enteredSerial = serial;
-        emitChanged = true;
-        Q_EMIT q_ptr->enteredSerialChanged();
-    }
+    bool emitChanged = update_serial(serial);
     if (hotspot != _hotspot) {
         hotspot = _hotspot;
         emitChanged = true;
         Q_EMIT q_ptr->hotspotChanged();
     }
 
-    if (this->surface != surface) {
-        QObject::disconnect(surface_notifiers.commit);
-        QObject::disconnect(surface_notifiers.destroy);
-
-        this->surface = surface;
-
-        if (surface) {
-            surface_notifiers.commit
-                = QObject::connect(surface, &Surface::committed, q_ptr, [this] {
-                      if (!this->surface->state().damage.isEmpty()) {
-                          Q_EMIT q_ptr->changed();
-                      }
-                  });
-            surface_notifiers.destroy
-                = QObject::connect(surface, &Surface::resourceDestroyed, q_ptr, [this] {
-                      // TODO(romangg): Call update instead?
-                      this->surface = nullptr;
-                  });
-        }
+    emitChanged |= reset_shape();
+    emitChanged |= set_surface(surface);
 
+    if (emitChanged) {
+        Q_EMIT q_ptr->changed();
+    }
+}
+
+void Cursor::Private::update_shape(cursor_shape shape, quint32 serial)
+{
+    bool emitChanged = update_serial(serial);
+    emitChanged |= set_surface(nullptr);
+
+    if (this->shape != shape) {
+        this->shape = shape;
         emitChanged = true;
-        Q_EMIT q_ptr->surfaceChanged();
+        Q_EMIT q_ptr->shapeChanged();
     }
 
     if (emitChanged) {
@@ -477,6 +502,56 @@ void Cursor::Private::update(Surface* surface, quint32 serial, QPoint const& _ho
     }
 }
 
+bool Cursor::Private::update_serial(quint32 serial)
+{
+    if (enteredSerial == serial) {
+        return false;
+    }
+
+    enteredSerial = serial;
+    Q_EMIT q_ptr->enteredSerialChanged();
+    return true;
+}
+
+bool Cursor::Private::set_surface(Surface* surface)
+{
+    if (this->surface == surface) {
+        return false;
+    }
+
+    QObject::disconnect(surface_notifiers.commit);
+    QObject::disconnect(surface_notifiers.destroy);
+
+    this->surface = surface;
+
+    if (surface) {
+        surface_notifiers.commit = QObject::connect(surface, &Surface::committed, q_ptr, [this] {
+            if (!this->surface->state().damage.isEmpty()) {
+                Q_EMIT q_ptr->changed();
+            }
+        });
+        surface_notifiers.destroy
+            = QObject::connect(surface, &Surface::resourceDestroyed, q_ptr, [this] {
+                  // TODO(romangg): Call update instead?
+                  this->surface = nullptr;
+              });
+    }
+
+    Q_EMIT q_ptr->surfaceChanged();
+    return true;
+}
+
+bool Cursor::Private::reset_shape()
+{
+    if (!shape) {
+        return false;
+    }
+
+    shape.reset();
+    Q_EMIT q_ptr->shapeChanged();
+    return true;
+}
+
 Cursor::Cursor(Pointer* pointer)
     : QObject(nullptr)
     , d_ptr(new Private(this, pointer))
@@ -505,4 +580,9 @@ Surface* Cursor::surface() const
     return d_ptr->surface;
 }
 
+std::optional<cursor_shape> Cursor::shape() const
+{
+    return d_ptr->shape;
+}
+
 }
@@ -23,6 +23,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <Wrapland/Server/wraplandserver_export.h>
 #include <memory>
+#include <optional>
 
 namespace Wrapland::Server
 {
@@ -35,6 +36,47 @@ class Surface;
 
 enum class PointerAxisSource;
 
+/**
+ * Named cursor shapes as defined by the cursor-shape-v1 protocol. They correspond to the cursor
+ * names of the CSS specification.
+ */
+enum class cursor_shape {
+    default_,
+    context_menu,
+    help,
+    pointer,
+    progress,
+    wait,
+    cell,
+    crosshair,
+    text,
+    vertical_text,
+    alias,
+    copy,
+    move,
+    no_drop,
+    not_allowed,
+    grab,
+    grabbing,
+    e_resize,
+    n_resize,
+    ne_resize,
+    nw_resize,
+    s_resize,
+    se_resize,
+    sw_resize,
+    w_resize,
+    ew_resize,
+    ns_resize,
+    nesw_resize,
+    nwse_resize,
+    col_resize,
+    row_resize,
+    all_scroll,
+    zoom_in,
+    zoom_out,
+};
+
 class WRAPLANDSERVER_EXPORT Pointer : public QObject
 {
     Q_OBJECT
@@ -65,6 +107,7 @@ private:
     friend class RelativePointerManagerV1;
     friend class PointerGesturesV1;
     friend class PointerConstraintsV1;
+    friend class cursor_shape_device_v1_res_impl;
 
     friend class Seat;
     friend class pointer_pool;
@@ -87,10 +130,18 @@ public:
     Pointer* pointer() const;
     Surface* surface() const;
 
+    /**
+     * The named shape set through cursor_shape_manager_v1. A cursor has either a surface or a
+     * shape, setting one unsets the other. The compositor provides the image for a shape, for
+     * example from its cursor theme.
+     */
+    std::optional<cursor_shape> shape() const;
+
 Q_SIGNALS:
     void hotspotChanged();
     void enteredSerialChanged();
     void surfaceChanged();
+    void shapeChanged();
     void changed();
 
 private:
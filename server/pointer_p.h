@@ -25,6 +25,8 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <QPoint>
 
+#include <functional>
+
 namespace Wrapland::Server
 {
 class PointerPinchGestureV1;
@@ -41,10 +43,16 @@ public:
     quint32 enteredSerial = 0;
     QPoint hotspot;
     Surface* surface{nullptr};
+    std::optional<cursor_shape> shape;
 
     void update(Surface* surface, quint32 serial, QPoint const& _hotspot);
+    void update_shape(cursor_shape shape, quint32 serial);
 
 private:
+    bool update_serial(quint32 serial);
+    bool set_surface(Surface* surface);
+    bool reset_shape();
+
     struct {
         QMetaObject::Connection commit;
         QMetaObject::Connection destroy;
@@ -65,6 +73,9 @@ public:
     QMetaObject::Connection clientDestroyConnection;
     std::unique_ptr<Cursor> cursor;
 
+    // Motion was not sent because the client's events are throttled.
+    bool motion_held_back{false};
+
     std::vector<RelativePointerV1*> relativePointers;
     std::vector<PointerSwipeGestureV1*> swipeGestures;
     std::vector<PointerPinchGestureV1*> pinchGestures;
@@ -74,6 +85,7 @@ public:
     void sendLeave(quint32 serial, Surface* surface);
     void sendMotion(QPointF const& position);
     void sendFrame();
+    void send_held_back_motion();
 
     void registerRelativePointer(RelativePointerV1* relativePointer);
     void registerSwipeGesture(PointerSwipeGestureV1* gesture);
@@ -95,6 +107,7 @@ public:
     void cancelHoldGesture(quint32 serial);
 
     void setFocusedSurface(quint32 serial, Surface* surface);
+    void set_cursor_shape(quint32 serial, cursor_shape shape);
 
 private:
     static void setCursorCallback(wl_client* wlClient,
@@ -104,6 +117,7 @@ private:
                                   int32_t hotspot_x,
                                   int32_t hotspot_y);
     void setCursor(quint32 serial, Surface* surface, QPoint const& hotspot);
+    void update_cursor(std::function<void(Cursor::Private&)> const& update);
 
     static const struct wl_pointer_interface s_interface;
 };
@@ -10,6 +10,7 @@
 #include "data_control_v1_p.h"
 #include "display.h"
 #include "seat_p.h"
+#include "selection_cache.h"
 #include "selection_p.h"
 
 namespace Wrapland::Server
@@ -306,6 +307,9 @@ void primary_selection_source::cancel() const
 
 void primary_selection_source::request_data(std::string const& mimeType, qint32 fd) const
 {
+    if (d_ptr->cache && d_ptr->cache->send(mimeType, fd)) {
+        return;
+    }
     std::visit([&](auto&& res) { res->request_data(mimeType, fd); }, d_ptr->res);
 }
 
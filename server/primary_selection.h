@@ -110,6 +110,7 @@ private:
     friend class data_control_source_v1_res;
     friend class primary_selection_source_ext;
     friend class primary_selection_source_res;
+    friend class selection_cache;
     primary_selection_source();
 
     class Private;
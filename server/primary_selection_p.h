@@ -18,6 +18,7 @@
 namespace Wrapland::Server
 {
 class data_control_source_v1_res;
+class selection_cache;
 
 constexpr uint32_t primary_selection_device_manager_version = 1;
 using primary_selection_device_manager_global
@@ -92,6 +93,8 @@ public:
                  data_control_source_v1_res*,
                  primary_selection_source_ext*>
         res;
+    selection_cache* cache{nullptr};
+
     primary_selection_source* q_ptr;
 };
 
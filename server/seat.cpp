@@ -288,4 +288,11 @@ void Seat::setPrimarySelection(primary_selection_source* source)
     d_ptr->primary_selection_devices.set_selection(source);
 }
 
+void Seat::set_selection_cache(selection_cache_config const& config)
+{
+    auto display = d_ptr->display()->handle;
+    d_ptr->data_devices.set_cache_config(config, display);
+    d_ptr->primary_selection_devices.set_cache_config(config, display);
+}
+
 }
@@ -27,6 +27,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace Wrapland::Server
@@ -56,6 +57,18 @@ enum class PointerAxisSource {
     WheelTilt,
 };
 
+/**
+ * Configures caching of selection data in the compositor. With the cache the data of a selection
+ * is read once from its source and later requests for it are served from memory. The selection
+ * stays available with the cached mime types when the client of the source goes away.
+ */
+struct selection_cache_config {
+    /// Maximal size in bytes of the data cached per mime type. Zero disables the cache.
+    size_t max_size{0};
+    /// Mime types whose data is cached, for example "text/plain;charset=utf-8".
+    std::vector<std::string> mime_types;
+};
+
 class WRAPLANDSERVER_EXPORT Seat : public QObject
 {
     Q_OBJECT
@@ -92,6 +105,12 @@ public:
     primary_selection_source* primarySelection() const;
     void setPrimarySelection(primary_selection_source* source);
 
+    /**
+     * Applies @p config to the clipboard and primary selection. Selections set afterwards are
+     * cached accordingly.
+     */
+    void set_selection_cache(selection_cache_config const& config);
+
 Q_SIGNALS:
     void pointerPosChanged(QPointF const& pos);
     void touchMoved(int32_t id, uint32_t serial, QPointF const& globalPosition);
@@ -9,10 +9,10 @@
 
 #include "client.h"
 #include "display.h"
+#include "event_loop.h"
 #include "logging.h"
 #include "wayland/global.h"
 
-#include <QSocketNotifier>
 #include <sys/poll.h>
 #include <sys/socket.h>
 #include <unistd.h>
@@ -35,37 +35,31 @@ struct security_context_inviter {
         : listen_fd{listen_fd}
         , close_fd{close_fd}
         , finish{std::move(finish_callback)}
-        , qobject{std::make_unique<QObject>()}
     {
-        listeners.close = std::make_unique<QSocketNotifier>(close_fd, QSocketNotifier::Read);
-        QObject::connect(listeners.close.get(), &QSocketNotifier::activated, qobject.get(), [this] {
-            if (is_closed()) {
-                is_finished = true;
-                finish();
-            }
-        });
-
         if (is_closed()) {
             is_finished = true;
             finish();
             return;
         }
 
-        listeners.listen = std::make_unique<QSocketNotifier>(listen_fd, QSocketNotifier::Read);
-        QObject::connect(listeners.listen.get(),
-                         &QSocketNotifier::activated,
-                         qobject.get(),
-                         [app_id, disp_ptr = &display](auto descr) {
-                             auto fd = accept4(descr, nullptr, nullptr, SOCK_CLOEXEC);
-                             if (fd < 0) {
-                                 qCWarning(WRAPLAND_SERVER)
-                                     << "Failed to accept client from security listen FD";
-                                 return;
-                             }
-                             auto client = disp_ptr->createClient(fd);
-                             client->set_security_context_app_id(app_id);
-                             Q_EMIT disp_ptr->clientConnected(client);
-                         });
+        // Only hang-ups and errors are of interest, which are always reported.
+        listeners.close
+            = std::make_unique<fd_notifier>(&display, close_fd, fd_event::none, [this](auto) {
+                  is_finished = true;
+                  finish();
+              });
+
+        listeners.listen = std::make_unique<fd_notifier>(
+            &display, listen_fd, fd_event::readable, [this, app_id, disp_ptr = &display](auto) {
+                auto fd = accept4(this->listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+                if (fd < 0) {
+                    qCWarning(WRAPLAND_SERVER) << "Failed to accept client from security listen FD";
+                    return;
+                }
+                auto client = disp_ptr->createClient(fd);
+                client->set_security_context_app_id(app_id);
+                Q_EMIT disp_ptr->clientConnected(client);
+            });
     }
 
     security_context_inviter(security_context_inviter const&) = delete;
@@ -92,10 +86,9 @@ struct security_context_inviter {
     std::string app_id;
 
     std::function<void()> finish;
-    std::unique_ptr<QObject> qobject;
     struct {
-        std::unique_ptr<QSocketNotifier> close;
-        std::unique_ptr<QSocketNotifier> listen;
+        std::unique_ptr<fd_notifier> close;
+        std::unique_ptr<fd_notifier> listen;
     } listeners;
 };
 
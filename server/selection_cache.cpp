@@ -0,0 +1,222 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "selection_cache.h"
+
+#include "data_source_p.h"
+#include "primary_selection_p.h"
+
+#include <algorithm>
+#include <array>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Wrapland::Server
+{
+
+selection_cache::selection_cache(selection_cache_config config, Display* display)
+    : config{std::move(config)}
+    , display{display}
+{
+}
+
+selection_cache::~selection_cache()
+{
+    auto forward_waiting = forward;
+    if (detach) {
+        detach();
+    }
+
+    for (auto& [mime_type, entry] : entries) {
+        entry.reader.reset();
+        for (auto fd : entry.waiting) {
+            // The source is still around. It can serve the receivers directly.
+            if (forward_waiting) {
+                forward_waiting(mime_type, fd);
+            } else {
+                close(fd);
+            }
+        }
+    }
+}
+
+void selection_cache::fill(data_source* source)
+{
+    fill_source(source);
+}
+
+void selection_cache::fill(primary_selection_source* source)
+{
+    fill_source(source);
+}
+
+template<typename Source>
+void selection_cache::fill_source(Source* source)
+{
+    forward = [source](std::string const& mime_type, int32_t fd) {
+        source->request_data(mime_type, fd);
+    };
+    detach = [source] { source->d_ptr->cache = nullptr; };
+
+    connect(source, &Source::resourceDestroyed, this, &selection_cache::release_source);
+
+    for (auto const& mime_type : source->mime_types()) {
+        if (entries.count(mime_type)
+            || std::find(config.mime_types.cbegin(), config.mime_types.cend(), mime_type)
+                == config.mime_types.cend()) {
+            continue;
+        }
+
+        std::array<int, 2> pipe_fds{};
+        if (pipe2(pipe_fds.data(), O_CLOEXEC) != 0) {
+            continue;
+        }
+
+        source->request_data(mime_type, pipe_fds[1]);
+
+        auto& entry = entries[mime_type];
+        entry.reader = std::make_unique<QObject>();
+        display->read_fd(pipe_fds[0],
+                         config.max_size,
+                         entry.reader.get(),
+                         [this, mime_type](std::optional<QByteArray> data) {
+                             if (data) {
+                                 finish(mime_type, std::move(*data));
+                             } else {
+                                 drop(mime_type);
+                             }
+                         });
+    }
+
+    // Set last, so the requests above went to the source itself.
+    source->d_ptr->cache = this;
+}
+
+bool selection_cache::send(std::string const& mime_type, int32_t fd)
+{
+    auto it = entries.find(mime_type);
+    if (it == entries.end()) {
+        return false;
+    }
+
+    if (it->second.complete) {
+        display->write_fd(fd, it->second.data);
+    } else {
+        it->second.waiting.push_back(fd);
+    }
+    return true;
+}
+
+std::vector<std::string> selection_cache::mime_types() const
+{
+    std::vector<std::string> types;
+    for (auto const& [mime_type, entry] : entries) {
+        types.push_back(mime_type);
+    }
+    return types;
+}
+
+void selection_cache::finish(std::string const& mime_type, QByteArray data)
+{
+    auto& entry = entries.at(mime_type);
+
+    entry.reader.reset();
+    entry.data = std::move(data);
+    entry.complete = true;
+
+    for (auto fd : entry.waiting) {
+        display->write_fd(fd, entry.data);
+    }
+    entry.waiting.clear();
+}
+
+void selection_cache::drop(std::string const& mime_type)
+{
+    auto it = entries.find(mime_type);
+    auto entry = std::move(it->second);
+    entries.erase(it);
+
+    entry.reader.reset();
+
+    // Not cached anymore. The source serves the receivers directly when it is still around.
+    for (auto fd : entry.waiting) {
+        if (forward) {
+            forward(mime_type, fd);
+        } else {
+            close(fd);
+        }
+    }
+}
+
+void selection_cache::release_source()
+{
+    if (!detach) {
+        return;
+    }
+
+    detach();
+    detach = {};
+    forward = {};
+
+    // The client might still write to pipes it got before destroying the source. Reading
+    // continues until the end of the data. Only entries failing to read are dropped.
+}
+
+cached_data_source::cached_data_source(std::shared_ptr<selection_cache> cache)
+    : cache{std::move(cache)}
+{
+    for (auto const& mime_type : this->cache->mime_types()) {
+        offer(mime_type);
+    }
+}
+
+void cached_data_source::accept(std::string const& /*mime_type*/)
+{
+}
+
+void cached_data_source::request_data(std::string const& mime_type, qint32 fd)
+{
+    if (!cache->send(mime_type, fd)) {
+        close(fd);
+    }
+}
+
+void cached_data_source::cancel()
+{
+}
+
+void cached_data_source::send_dnd_drop_performed()
+{
+}
+
+void cached_data_source::send_dnd_finished()
+{
+}
+
+void cached_data_source::send_action(dnd_action /*action*/)
+{
+}
+
+cached_primary_selection_source::cached_primary_selection_source(
+    std::shared_ptr<selection_cache> cache)
+    : cache{std::move(cache)}
+{
+    for (auto const& mime_type : this->cache->mime_types()) {
+        offer(mime_type);
+    }
+}
+
+void cached_primary_selection_source::request_data(std::string const& mime_type, qint32 fd)
+{
+    if (!cache->send(mime_type, fd)) {
+        close(fd);
+    }
+}
+
+void cached_primary_selection_source::cancel()
+{
+}
+
+}
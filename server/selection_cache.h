@@ -0,0 +1,122 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "data_source.h"
+#include "display.h"
+#include "primary_selection.h"
+#include "seat.h"
+
+#include <QByteArray>
+#include <QObject>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Wrapland::Server
+{
+
+/**
+ * Holds the data of a selection for the mime types listed in the selection_cache_config. The data
+ * is read once from the source when the selection is set. Later requests for it are answered from
+ * memory, also after the source went away. Data still being read then is read until its end.
+ */
+class selection_cache : public QObject
+{
+public:
+    selection_cache(selection_cache_config config, Display* display);
+    ~selection_cache() override;
+
+    void fill(data_source* source);
+    void fill(primary_selection_source* source);
+
+    /**
+     * Takes ownership of @p fd and writes the data for @p mime_type to it once it has been read.
+     * Returns false when the data for @p mime_type is not cached.
+     */
+    bool send(std::string const& mime_type, int32_t fd);
+
+    /// Mime types for which the data has been read or is still being read.
+    std::vector<std::string> mime_types() const;
+
+private:
+    struct entry {
+        QByteArray data;
+        bool complete{false};
+
+        // Reading is cancelled when destroyed.
+        std::unique_ptr<QObject> reader;
+
+        // Receivers that requested the data before it had been read completely.
+        std::vector<int32_t> waiting;
+    };
+
+    template<typename Source>
+    void fill_source(Source* source);
+
+    void finish(std::string const& mime_type, QByteArray data);
+    void drop(std::string const& mime_type);
+    void release_source();
+
+    selection_cache_config config;
+    std::map<std::string, entry> entries;
+
+    std::function<void(std::string const&, int32_t)> forward;
+    std::function<void()> detach;
+
+    Display* display;
+};
+
+/**
+ * Replaces a data source when its client destroyed it. The selection stays available for the
+ * cached mime types.
+ */
+class cached_data_source : public data_source_ext
+{
+public:
+    explicit cached_data_source(std::shared_ptr<selection_cache> cache);
+
+    void accept(std::string const& mime_type) override;
+    void request_data(std::string const& mime_type, qint32 fd) override;
+    void cancel() override;
+
+    void send_dnd_drop_performed() override;
+    void send_dnd_finished() override;
+    void send_action(dnd_action action) override;
+
+private:
+    std::shared_ptr<selection_cache> cache;
+};
+
+class cached_primary_selection_source : public primary_selection_source_ext
+{
+public:
+    explicit cached_primary_selection_source(std::shared_ptr<selection_cache> cache);
+
+    void request_data(std::string const& mime_type, qint32 fd) override;
+    void cancel() override;
+
+private:
+    std::shared_ptr<selection_cache> cache;
+};
+
+template<typename Source>
+struct cached_source_type;
+
+template<>
+struct cached_source_type<data_source> {
+    using type = cached_data_source;
+};
+
+template<>
+struct cached_source_type<primary_selection_source> {
+    using type = cached_primary_selection_source;
+};
+
+}
@@ -7,9 +7,11 @@
 #pragma once
 
 #include "seat.h"
+#include "selection_cache.h"
 #include "surface.h"
 #include "utils.h"
 
+#include <memory>
 #include <vector>
 
 namespace Wrapland::Server
@@ -18,11 +20,17 @@ namespace Wrapland::Server
 template<typename Device, typename Source, void (Seat::*signal)(Source*)>
 struct selection_pool {
     explicit selection_pool(Seat* seat);
+    selection_pool(selection_pool const&) = delete;
+    selection_pool& operator=(selection_pool const&) = delete;
+    selection_pool(selection_pool&&) noexcept = delete;
+    selection_pool& operator=(selection_pool&&) noexcept = delete;
+    ~selection_pool();
 
     void register_device(Device* device);
     void set_focused_surface(Surface* surface);
 
     void set_selection(Source* source);
+    void set_cache_config(selection_cache_config config, Display* display);
 
     struct {
         std::vector<Device*> devices;
@@ -34,6 +42,13 @@ struct selection_pool {
 
 private:
     void transmit(Source* source);
+    void update_cache(Source* source);
+    bool keep_cached_selection();
+
+    selection_cache_config cache_config;
+    std::shared_ptr<selection_cache> cache;
+    std::unique_ptr<typename cached_source_type<Source>::type> cached_source;
+    Display* display{nullptr};
 
     Seat* seat;
 };
@@ -44,6 +59,13 @@ selection_pool<Device, Source, signal>::selection_pool(Seat* seat)
 {
 }
 
+template<typename Device, typename Source, void (Seat::*signal)(Source*)>
+selection_pool<Device, Source, signal>::~selection_pool()
+{
+    // A cached source is destroyed with us. Its destroy must not be handled anymore.
+    QObject::disconnect(focus.source_destroy_notifier);
+}
+
 template<typename Device, typename Source, void (Seat::*signal)(Source*)>
 void selection_pool<Device, Source, signal>::register_device(Device* device)
 {
@@ -101,10 +123,17 @@ void selection_pool<Device, Source, signal>::set_selection(Source* source)
     QObject::disconnect(focus.source_destroy_notifier);
     focus.source_destroy_notifier = QMetaObject::Connection();
 
+    // Before connecting to the source ourselves such that on destroy the cache has released it
+    // already.
+    update_cache(source);
+
     if (source) {
         focus.source_destroy_notifier
             = QObject::connect(source, &Source::resourceDestroyed, seat, [this] {
                   focus.source = nullptr;
+                  if (keep_cached_selection()) {
+                      return;
+                  }
                   transmit(nullptr);
                   Q_EMIT(seat->*signal)(nullptr);
               });
@@ -116,6 +145,45 @@ void selection_pool<Device, Source, signal>::set_selection(Source* source)
     if (old_source) {
         old_source->cancel();
     }
+    if (cached_source && cached_source->src() != source) {
+        cached_source.reset();
+    }
+}
+
+template<typename Device, typename Source, void (Seat::*signal)(Source*)>
+void selection_pool<Device, Source, signal>::set_cache_config(selection_cache_config config,
+                                                              Display* display)
+{
+    cache_config = std::move(config);
+    this->display = display;
+}
+
+template<typename Device, typename Source, void (Seat::*signal)(Source*)>
+void selection_pool<Device, Source, signal>::update_cache(Source* source)
+{
+    if (cached_source && cached_source->src() == source) {
+        // The selection is kept alive by the cache itself.
+        return;
+    }
+
+    cache.reset();
+
+    if (source && cache_config.max_size > 0 && !cache_config.mime_types.empty()) {
+        cache = std::make_shared<selection_cache>(cache_config, display);
+        cache->fill(source);
+    }
+}
+
+template<typename Device, typename Source, void (Seat::*signal)(Source*)>
+bool selection_pool<Device, Source, signal>::keep_cached_selection()
+{
+    if (!cache || cache->mime_types().empty()) {
+        return false;
+    }
+
+    cached_source = std::make_unique<typename cached_source_type<Source>::type>(cache);
+    set_selection(cached_source->src());
+    return true;
 }
 
 template<typename Device, typename Source, void (Seat::*signal)(Source*)>
@@ -0,0 +1,90 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "single_pixel_buffer_v1_p.h"
+
+#include "client.h"
+#include "display.h"
+
+#include "wayland-server-protocol.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Wrapland::Server
+{
+
+struct wp_single_pixel_buffer_manager_v1_interface const
+    single_pixel_buffer_manager_v1::Private::s_interface
+    = {
+        resourceDestroyCallback,
+        cb<create_u32_rgba_buffer_callback>,
+};
+
+single_pixel_buffer_manager_v1::Private::Private(Display* display,
+                                                 single_pixel_buffer_manager_v1* q_ptr)
+    : single_pixel_buffer_manager_v1_global(q_ptr,
+                                            display,
+                                            &wp_single_pixel_buffer_manager_v1_interface,
+                                            &s_interface)
+{
+    create();
+}
+
+void single_pixel_buffer_manager_v1::Private::create_u32_rgba_buffer_callback(
+    single_pixel_buffer_manager_v1_bind* bind,
+    uint32_t id,
+    uint32_t red,
+    uint32_t green,
+    uint32_t blue,
+    uint32_t alpha)
+{
+    auto constexpr max = static_cast<double>(std::numeric_limits<uint32_t>::max());
+    auto const alpha_f = alpha / max;
+
+    // The channels are sent premultiplied, QColor expects them straight.
+    auto unpremultiply = [alpha_f](uint32_t channel) {
+        if (alpha_f == 0.) {
+            return 0.;
+        }
+        return std::clamp(channel / max / alpha_f, 0., 1.);
+    };
+
+    new single_pixel_buffer_v1_res(
+        bind->client->handle,
+        id,
+        QColor::fromRgbF(unpremultiply(red), unpremultiply(green), unpremultiply(blue), alpha_f));
+}
+
+single_pixel_buffer_manager_v1::single_pixel_buffer_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+single_pixel_buffer_manager_v1::~single_pixel_buffer_manager_v1() = default;
+
+single_pixel_buffer_v1_res::single_pixel_buffer_v1_res(Client* client,
+                                                       uint32_t id,
+                                                       QColor const& color)
+    : color{color}
+    , impl{new single_pixel_buffer_v1_res_impl(client, id, this)}
+{
+}
+
+single_pixel_buffer_v1_res_impl::single_pixel_buffer_v1_res_impl(Client* client,
+                                                                 uint32_t id,
+                                                                 single_pixel_buffer_v1_res* q_ptr)
+    : Wayland::Resource<single_pixel_buffer_v1_res>(client,
+                                                    1,
+                                                    id,
+                                                    &wl_buffer_interface,
+                                                    &s_interface,
+                                                    q_ptr)
+{
+}
+
+struct wl_buffer_interface const single_pixel_buffer_v1_res_impl::s_interface = {destroyCallback};
+
+}
@@ -0,0 +1,35 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * Global for the wp_single_pixel_buffer_manager_v1 interface.
+ *
+ * Buffers created through it have a size of 1x1 and carry a single color. They are not backed by
+ * any memory and the color can be read through Buffer::solid_color().
+ */
+class WRAPLANDSERVER_EXPORT single_pixel_buffer_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit single_pixel_buffer_manager_v1(Display* display);
+    ~single_pixel_buffer_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
@@ -0,0 +1,66 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "single_pixel_buffer_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <QColor>
+#include <wayland-single-pixel-buffer-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+
+constexpr uint32_t single_pixel_buffer_manager_v1_version = 1;
+using single_pixel_buffer_manager_v1_global
+    = Wayland::Global<single_pixel_buffer_manager_v1, single_pixel_buffer_manager_v1_version>;
+using single_pixel_buffer_manager_v1_bind = Wayland::Bind<single_pixel_buffer_manager_v1_global>;
+
+class single_pixel_buffer_manager_v1::Private : public single_pixel_buffer_manager_v1_global
+{
+public:
+    Private(Display* display, single_pixel_buffer_manager_v1* q_ptr);
+
+private:
+    static void create_u32_rgba_buffer_callback(single_pixel_buffer_manager_v1_bind* bind,
+                                                uint32_t id,
+                                                uint32_t red,
+                                                uint32_t green,
+                                                uint32_t blue,
+                                                uint32_t alpha);
+
+    static struct wp_single_pixel_buffer_manager_v1_interface const s_interface;
+};
+
+class single_pixel_buffer_v1_res_impl;
+
+class single_pixel_buffer_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    single_pixel_buffer_v1_res(Client* client, uint32_t id, QColor const& color);
+
+    /// Not premultiplied.
+    QColor color;
+    single_pixel_buffer_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class single_pixel_buffer_v1_res_impl : public Wayland::Resource<single_pixel_buffer_v1_res>
+{
+public:
+    single_pixel_buffer_v1_res_impl(Client* client,
+                                    uint32_t id,
+                                    single_pixel_buffer_v1_res* q_ptr);
+
+    static struct wl_buffer_interface const s_interface;
+};
+
+}
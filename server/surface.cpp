@@ -22,14 +22,21 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "surface_p.h"
 
 #include "buffer.h"
+#include "buffer_p.h"
 
 #include "blur.h"
 #include "client.h"
+#include "commit_timing_v1_p.h"
 #include "compositor.h"
+#include "content_type_v1_p.h"
 #include "contrast.h"
+#include "fifo_v1_p.h"
+#include "fractional_scale_v1_p.h"
 #include "idle_inhibit_v1.h"
 #include "idle_inhibit_v1_p.h"
 #include "layer_shell_v1_p.h"
+#include "linux_dmabuf_v1_p.h"
+#include "linux_drm_syncobj_v1_p.h"
 #include "pointer_constraints_v1.h"
 #include "pointer_constraints_v1_p.h"
 #include "presentation_time.h"
@@ -38,6 +45,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "slide.h"
 #include "subcompositor.h"
 #include "subsurface_p.h"
+#include "tearing_control_v1_p.h"
 #include "viewporter_p.h"
 #include "wl_output_p.h"
 #include "xdg_shell_surface_p.h"
@@ -72,6 +80,12 @@ Surface::Private::~Private()
         callbacksToDestroy.end(), pending.callbacks.begin(), pending.callbacks.end());
     pending.callbacks.clear();
 
+    for (auto& state : queued_commits) {
+        callbacksToDestroy.insert(
+            callbacksToDestroy.end(), state->callbacks.begin(), state->callbacks.end());
+        state->callbacks.clear();
+    }
+
     for (auto callback : callbacksToDestroy) {
         wl_resource_destroy(callback);
     }
@@ -87,6 +101,11 @@ Surface::Private::~Private()
     for (auto child : pending.pub.children) {
         child->d_ptr->parent = nullptr;
     }
+    for (auto& state : queued_commits) {
+        for (auto child : state->pub.children) {
+            child->d_ptr->parent = nullptr;
+        }
+    }
 }
 
 void Surface::Private::addChild(Subsurface* child)
@@ -114,6 +133,10 @@ void Surface::Private::removeChild(Subsurface* child)
     pending.pub.children.erase(
         std::remove(pending.pub.children.begin(), pending.pub.children.end(), child),
         pending.pub.children.end());
+    for (auto& state : queued_commits) {
+        auto& children = state->pub.children;
+        children.erase(std::remove(children.begin(), children.end(), child), children.end());
+    }
     current.pub.children.erase(
         std::remove(current.pub.children.begin(), current.pub.children.end(), child),
         current.pub.children.end());
@@ -265,6 +288,126 @@ void Surface::Private::installViewport(Viewport* vp)
     });
 }
 
+void Surface::Private::install_syncobj_surface(linux_drm_syncobj_surface_v1_res* syncobj)
+{
+    assert(!syncobj_surface);
+    syncobj_surface = syncobj;
+
+    QObject::connect(syncobj, &linux_drm_syncobj_surface_v1_res::resourceDestroyed, handle, [this] {
+        syncobj_surface = nullptr;
+        pending.pub.acquire_point.reset();
+        pending.pub.release_point.reset();
+    });
+}
+
+void Surface::Private::install_tearing_control(tearing_control_v1_res* control)
+{
+    assert(!tearing_control);
+    tearing_control = control;
+
+    QObject::connect(control, &tearing_control_v1_res::resourceDestroyed, handle, [this] {
+        tearing_control = nullptr;
+        set_presentation_hint(surface_presentation_hint::vsync);
+    });
+}
+
+void Surface::Private::install_fractional_scale(fractional_scale_v1_res* scale)
+{
+    assert(!fractional_scale);
+    fractional_scale = scale;
+
+    QObject::connect(scale, &fractional_scale_v1_res::resourceDestroyed, handle, [this] {
+        fractional_scale = nullptr;
+    });
+
+    fractional_scale->send_preferred_scale(preferred_scale);
+}
+
+void Surface::Private::install_fifo(fifo_v1_res* fifo)
+{
+    assert(!this->fifo);
+    this->fifo = fifo;
+
+    QObject::connect(fifo, &fifo_v1_res::resourceDestroyed, handle, [this] {
+        this->fifo = nullptr;
+    });
+}
+
+void Surface::Private::install_commit_timer(commit_timer_v1_res* timer)
+{
+    assert(!commit_timer);
+    commit_timer = timer;
+
+    QObject::connect(timer, &commit_timer_v1_res::resourceDestroyed, handle, [this] {
+        commit_timer = nullptr;
+    });
+}
+
+void Surface::Private::install_content_type(content_type_v1_res* content_type)
+{
+    assert(!this->content_type);
+    this->content_type = content_type;
+
+    QObject::connect(content_type, &content_type_v1_res::resourceDestroyed, handle, [this] {
+        this->content_type = nullptr;
+        set_content_type(surface_content_type::none);
+    });
+}
+
+int32_t Surface::Private::get_preferred_buffer_scale() const
+{
+    if (preferred_buffer_scale) {
+        return *preferred_buffer_scale;
+    }
+
+    int32_t scale = 1;
+    for (auto output : outputs) {
+        scale = std::max(scale, output->output()->get_state().client_scale);
+    }
+    return scale;
+}
+
+output_transform Surface::Private::get_preferred_buffer_transform() const
+{
+    if (preferred_buffer_transform) {
+        return *preferred_buffer_transform;
+    }
+    if (outputs.empty()) {
+        return output_transform::normal;
+    }
+    return outputs.front()->output()->get_state().transform;
+}
+
+void Surface::Private::update_preferred_buffer_state()
+{
+    auto const scale = get_preferred_buffer_scale();
+    if (scale != sent_buffer_scale) {
+        sent_buffer_scale = scale;
+        send<wl_surface_send_preferred_buffer_scale,
+             WL_SURFACE_PREFERRED_BUFFER_SCALE_SINCE_VERSION>(scale);
+    }
+
+    auto const transform = get_preferred_buffer_transform();
+    if (transform != sent_buffer_transform) {
+        sent_buffer_transform = transform;
+        send<wl_surface_send_preferred_buffer_transform,
+             WL_SURFACE_PREFERRED_BUFFER_TRANSFORM_SINCE_VERSION>(
+            static_cast<uint32_t>(transform));
+    }
+}
+
+void Surface::Private::set_presentation_hint(surface_presentation_hint hint)
+{
+    pending.pub.presentation_hint = hint;
+    pending.pub.updates |= surface_change::presentation_hint;
+}
+
+void Surface::Private::set_content_type(surface_content_type type)
+{
+    pending.pub.content_type = type;
+    pending.pub.updates |= surface_change::content_type;
+}
+
 void Surface::Private::addPresentationFeedback(PresentationFeedback* feedback) const
 {
     pending.feedbacks->add(feedback);
@@ -359,8 +502,7 @@ const struct wl_surface_interface Surface::Private::s_interface = {
     bufferTransformCallback,
     bufferScaleCallback,
     damageBufferCallback,
-    // TODO(romangg): Update protocol version for offset callback (currently at 4).
-    // NOLINTNEXTLINE(clang-diagnostic-missing-field-initializers)
+    offsetCallback,
 };
 
 Surface::Surface(Client* client, uint32_t version, uint32_t id)
@@ -376,15 +518,57 @@ surface_state const& Surface::state() const
 
 void Surface::frameRendered(quint32 msec)
 {
-    while (!d_ptr->current.callbacks.empty()) {
-        auto resource = d_ptr->current.callbacks.front();
-        d_ptr->current.callbacks.pop_front();
+    d_ptr->send_frame_callbacks(msec);
+    for (auto& subsurface : d_ptr->current.pub.children) {
+        subsurface->d_ptr->surface->frameRendered(msec);
+    }
+}
+
+bool Surface::Private::send_frame_callbacks(uint32_t msec)
+{
+    if (current.callbacks.empty()) {
+        return true;
+    }
+    if (frame_callbacks_throttled(msec)) {
+        return false;
+    }
+
+    last_frame_msec = msec;
+
+    while (!current.callbacks.empty()) {
+        auto resource = current.callbacks.front();
+        current.callbacks.pop_front();
         wl_callback_send_done(resource, msec);
         wl_resource_destroy(resource);
     }
-    for (auto& subsurface : d_ptr->current.pub.children) {
-        subsurface->d_ptr->surface->frameRendered(msec);
+    return true;
+}
+
+bool Surface::Private::frame_callbacks_throttled(uint32_t msec) const
+{
+    if (client->events_throttled()) {
+        // Kept until the client reads its events again.
+        return true;
+    }
+
+    auto root = handle;
+    while (root->d_ptr->subsurface && root->d_ptr->subsurface->parentSurface()) {
+        root = root->d_ptr->subsurface->parentSurface();
     }
+
+    switch (root->d_ptr->visibility) {
+    case surface_visibility::visible:
+        return false;
+    case surface_visibility::hidden:
+        return true;
+    case surface_visibility::occluded:
+        // Unsigned arithmetic handles the wrap-around of the millisecond timestamps.
+        return last_frame_msec
+            && msec - *last_frame_msec
+            < static_cast<uint32_t>(root->d_ptr->occluded_frame_interval.count());
+    }
+
+    return false;
 }
 
 bool Surface::Private::has_role() const
@@ -467,6 +651,8 @@ void Surface::Private::update_buffer(SurfaceState const& source, bool& resized)
     }
 
     current.pub.buffer = source.pub.buffer;
+    current.pub.acquire_point = source.pub.acquire_point;
+    current.pub.release_point = source.pub.release_point;
 
     if (was_mapped != now_mapped) {
         current.pub.updates |= surface_change::mapped;
@@ -481,13 +667,15 @@ void Surface::Private::update_buffer(SurfaceState const& source, bool& resized)
 
     current.pub.buffer->setCommitted();
 
-    current.pub.offset = source.pub.offset;
     current.pub.damage = source.pub.damage;
     current.bufferDamage = source.bufferDamage;
 
     auto const newSize = current.pub.buffer->size();
     resized = newSize.isValid() && newSize != oldSize;
+}
 
+void Surface::Private::update_damage()
+{
     if (current.pub.damage.isEmpty() && current.bufferDamage.isEmpty()) {
         // No damage submitted yet for the new buffer.
 
@@ -530,12 +718,53 @@ void Surface::Private::update_buffer(SurfaceState const& source, bool& resized)
         } else {
             bufferDamage = current.bufferDamage;
         }
+
+        bufferDamage = map_viewport_damage(bufferDamage);
     }
 
     current.pub.damage = surfaceRegion.intersected(current.pub.damage.united(bufferDamage));
     trackedDamage = trackedDamage.united(current.pub.damage);
 }
 
+QRegion Surface::Private::map_viewport_damage(QRegion const& damage) const
+{
+    // With a viewport the buffer is cropped to the source rectangle and scaled to the destination
+    // size. For example clients rendering at a fractional scale set the destination size to the
+    // logical size of the surface.
+    auto const& source_rect = current.pub.source_rectangle;
+    if (!current.destinationSize.isValid() && !source_rect.isValid()) {
+        return damage;
+    }
+
+    auto buffer_size = QSizeF(current.pub.buffer->size()) / current.pub.scale;
+
+    using ot = output_transform;
+    auto const tr = current.pub.transform;
+    if (tr == ot::rotated_90 || tr == ot::rotated_270 || tr == ot::flipped_90
+        || tr == ot::flipped_270) {
+        buffer_size.transpose();
+    }
+
+    auto const source = source_rect.isValid() ? source_rect : QRectF(QPointF(), buffer_size);
+    auto const target = handle->size();
+    if (source.isEmpty() || target.isEmpty()) {
+        return {};
+    }
+
+    auto const scale_x = target.width() / source.width();
+    auto const scale_y = target.height() / source.height();
+
+    QRegion mapped;
+    for (auto const& rect : damage) {
+        auto const mapped_rect = QRectF((rect.x() - source.x()) * scale_x,
+                                        (rect.y() - source.y()) * scale_y,
+                                        rect.width() * scale_x,
+                                        rect.height() * scale_y);
+        mapped += mapped_rect.toAlignedRect();
+    }
+    return mapped;
+}
+
 void Surface::Private::copy_to_current(SurfaceState const& source, bool& resized)
 {
     if (source.pub.updates & surface_change::children) {
@@ -610,6 +839,16 @@ void Surface::Private::copy_to_current(SurfaceState const& source, bool& resized
         current.pub.transform = source.pub.transform;
     }
 
+    // The offset is relative to the previous state and not carried over to the next commit.
+    current.pub.offset
+        = (source.pub.updates & surface_change::offset) ? source.pub.offset : QPoint();
+    if (source.pub.updates & surface_change::presentation_hint) {
+        current.pub.presentation_hint = source.pub.presentation_hint;
+    }
+    if (source.pub.updates & surface_change::content_type) {
+        current.pub.content_type = source.pub.content_type;
+    }
+
     if (source.destinationSizeIsSet) {
         current.destinationSize = source.destinationSize;
         resized = current.pub.buffer != nullptr;
@@ -641,9 +880,18 @@ void Surface::Private::updateCurrentState(SurfaceState& source, bool forceChildr
     auto resized = false;
     current.pub.updates = source.pub.updates;
 
+    if (source.fifo_barrier) {
+        fifo_barrier = true;
+    }
+
     update_buffer(source, resized);
     copy_to_current(source, resized);
 
+    if ((source.pub.updates & surface_change::buffer) && current.pub.buffer) {
+        // Damage depends on the final scale, transform and viewport of the new state.
+        update_damage();
+    }
+
     // Now check that source rectangle is (still) well defined.
     soureRectangleIntegerCheck(current.destinationSize, current.pub.source_rectangle);
     soureRectangleContainCheck(current.pub.buffer.get(),
@@ -677,13 +925,91 @@ void Surface::Private::updateCurrentState(SurfaceState& source, bool forceChildr
 
 void Surface::Private::commit()
 {
+    if (syncobj_surface) {
+        if (!syncobj_surface->check_commit(pending)) {
+            return;
+        }
+        if (pending.pub.release_point) {
+            // Signaled once the compositor dropped all references to the buffer.
+            pending.pub.buffer->d_ptr->release_point = pending.pub.release_point;
+        }
+    }
+
+    // Synchronized subsurfaces are applied with their parent. Their frame pacing constraints are
+    // ignored.
+    auto const synchronized = subsurface && subsurface->isSynchronized();
+
+    if (!synchronized && (!queued_commits.empty() || !is_commit_ready(pending, std::nullopt))) {
+        queue_commit();
+        return;
+    }
+
     if (subsurface) {
         // Surface has associated subsurface. We delegate committing to there.
         subsurface->d_ptr->commit();
         return;
     }
 
-    updateCurrentState(false);
+    apply_state(pending);
+}
+
+bool Surface::Private::is_commit_ready(SurfaceState const& state,
+                                       std::optional<std::chrono::nanoseconds> time) const
+{
+    if (state.fifo_wait && fifo_barrier) {
+        return false;
+    }
+    if (state.target_time && (!time || *state.target_time > *time)) {
+        return false;
+    }
+    if (state.pub.buffer && state.pub.buffer->d_ptr->pending_import) {
+        // Without the dmabuf the buffer size and with it the surface size is not known.
+        return false;
+    }
+    return true;
+}
+
+void Surface::Private::queue_commit()
+{
+    auto state = std::make_unique<SurfaceState>();
+    *state = std::move(pending);
+    pending = SurfaceState();
+    pending.pub.children = state->pub.children;
+
+    if (state->pub.buffer) {
+        state->pub.buffer->setCommitted();
+
+        if (auto import = state->pub.buffer->d_ptr->pending_import) {
+            // Apply the commit right away when the import is done.
+            QObject::connect(import, &linux_dmabuf_buffer_v1_res::imported, handle, [this] {
+                apply_ready_commits(std::nullopt);
+            });
+        }
+    }
+
+    queued_commits.push_back(std::move(state));
+    Q_EMIT handle->commit_queued();
+}
+
+void Surface::Private::apply_queued_commits(std::chrono::nanoseconds time)
+{
+    // A refresh cycle passed since the barrier was set.
+    fifo_barrier = false;
+    apply_ready_commits(time);
+}
+
+void Surface::Private::apply_ready_commits(std::optional<std::chrono::nanoseconds> time)
+{
+    while (!queued_commits.empty() && is_commit_ready(*queued_commits.front(), time)) {
+        auto state = std::move(queued_commits.front());
+        queued_commits.pop_front();
+        apply_state(*state);
+    }
+}
+
+void Surface::Private::apply_state(SurfaceState& state)
+{
+    updateCurrentState(state, false);
 
     if (shellSurface) {
         shellSurface->commit();
@@ -730,12 +1056,11 @@ void Surface::Private::addFrameCallback(uint32_t callback)
     pending.callbacks.push_back(frameCallback);
 }
 
-void Surface::Private::attachBuffer(wl_resource* wlBuffer, QPoint const& offset)
+void Surface::Private::attachBuffer(wl_resource* wlBuffer)
 {
     had_buffer_attached = true;
 
     pending.pub.updates |= surface_change::buffer;
-    pending.pub.offset = offset;
 
     if (!wlBuffer) {
         // Got a null buffer, deletes content in next frame.
@@ -758,10 +1083,22 @@ void Surface::Private::attachBuffer(wl_resource* wlBuffer, QPoint const& offset)
                          } else if (subsurface
                                     && subsurface->d_ptr->cached.pub.buffer.get() == buffer) {
                              subsurface->d_ptr->cached.pub.buffer.reset();
+                         } else {
+                             for (auto& state : queued_commits) {
+                                 if (state->pub.buffer.get() == buffer) {
+                                     state->pub.buffer.reset();
+                                 }
+                             }
                          }
                      });
 }
 
+void Surface::Private::set_offset(QPoint const& offset)
+{
+    pending.pub.offset = offset;
+    pending.pub.updates |= surface_change::offset;
+}
+
 void Surface::Private::destroyFrameCallback(wl_resource* wlResource)
 {
     auto priv = static_cast<Private*>(wl_resource_get_user_data(wlResource));
@@ -775,6 +1112,9 @@ void Surface::Private::destroyFrameCallback(wl_resource* wlResource)
 
     removeCallback(priv->current);
     removeCallback(priv->pending);
+    for (auto& state : priv->queued_commits) {
+        removeCallback(*state);
+    }
     if (priv->subsurface) {
         removeCallback(priv->subsurface->d_ptr->cached);
     }
@@ -787,7 +1127,18 @@ void Surface::Private::attachCallback([[maybe_unused]] wl_client* wlClient,
                                       int32_t pos_y)
 {
     auto priv = get_handle(wlResource)->d_ptr;
-    priv->attachBuffer(buffer, QPoint(pos_x, pos_y));
+
+    if (priv->version >= WL_SURFACE_OFFSET_SINCE_VERSION) {
+        if (pos_x != 0 || pos_y != 0) {
+            priv->postError(WL_SURFACE_ERROR_INVALID_OFFSET,
+                            "Non-zero attach offset, use wl_surface.offset instead");
+            return;
+        }
+    } else {
+        priv->set_offset(QPoint(pos_x, pos_y));
+    }
+
+    priv->attachBuffer(buffer);
 }
 
 void Surface::Private::damageCallback([[maybe_unused]] wl_client* wlClient,
@@ -812,6 +1163,15 @@ void Surface::Private::damageBufferCallback([[maybe_unused]] wl_client* wlClient
     priv->damageBuffer(QRect(pos_x, pos_y, width, height));
 }
 
+void Surface::Private::offsetCallback([[maybe_unused]] wl_client* wlClient,
+                                      wl_resource* wlResource,
+                                      int32_t pos_x,
+                                      int32_t pos_y)
+{
+    auto priv = get_handle(wlResource)->d_ptr;
+    priv->set_offset(QPoint(pos_x, pos_y));
+}
+
 void Surface::Private::frameCallback([[maybe_unused]] wl_client* wlClient,
                                      wl_resource* wlResource,
                                      uint32_t callback)
@@ -955,6 +1315,7 @@ void Surface::setOutputs(std::vector<WlOutput*> const& outputs)
             d_ptr->send<wl_surface_send_leave>(bind->resource);
         }
         disconnect(d_ptr->outputDestroyedConnections.take(output));
+        disconnect(d_ptr->output_state_connections.take(output));
     }
 
     auto added_outputs = outputs;
@@ -988,10 +1349,17 @@ void Surface::setOutputs(std::vector<WlOutput*> const& outputs)
                       setOutputs(outputs);
                   }
               });
+
+        // The preferred buffer state follows rotation and scale changes of the outputs.
+        d_ptr->output_state_connections[output]
+            = connect(output, &WlOutput::state_changed, this, [this] {
+                  d_ptr->update_preferred_buffer_state();
+              });
     }
     // TODO(unknown author): send enter when the client binds the Output another time
 
     d_ptr->outputs = outputs;
+    d_ptr->update_preferred_buffer_state();
 }
 
 LockedPointerV1* Surface::lockedPointer() const
@@ -1009,6 +1377,82 @@ bool Surface::inhibitsIdle() const
     return !d_ptr->idleInhibitors.isEmpty();
 }
 
+surface_visibility Surface::visibility() const
+{
+    return d_ptr->visibility;
+}
+
+void Surface::set_visibility(surface_visibility visibility)
+{
+    d_ptr->visibility = visibility;
+}
+
+std::chrono::milliseconds Surface::occluded_frame_interval() const
+{
+    return d_ptr->occluded_frame_interval;
+}
+
+void Surface::set_occluded_frame_interval(std::chrono::milliseconds interval)
+{
+    d_ptr->occluded_frame_interval = std::max(interval, std::chrono::milliseconds::zero());
+}
+
+double Surface::preferred_scale() const
+{
+    return d_ptr->preferred_scale;
+}
+
+void Surface::set_preferred_scale(double scale)
+{
+    if (qFuzzyCompare(d_ptr->preferred_scale, scale)) {
+        return;
+    }
+
+    d_ptr->preferred_scale = scale;
+
+    if (d_ptr->fractional_scale) {
+        d_ptr->fractional_scale->send_preferred_scale(scale);
+    }
+}
+
+int32_t Surface::preferred_buffer_scale() const
+{
+    return d_ptr->get_preferred_buffer_scale();
+}
+
+void Surface::set_preferred_buffer_scale(std::optional<int32_t> scale)
+{
+    d_ptr->preferred_buffer_scale = scale;
+    d_ptr->update_preferred_buffer_state();
+}
+
+output_transform Surface::preferred_buffer_transform() const
+{
+    return d_ptr->get_preferred_buffer_transform();
+}
+
+void Surface::set_preferred_buffer_transform(std::optional<output_transform> transform)
+{
+    d_ptr->preferred_buffer_transform = transform;
+    d_ptr->update_preferred_buffer_state();
+}
+
+void Surface::apply_queued_commits(std::chrono::nanoseconds time)
+{
+    d_ptr->apply_queued_commits(time);
+
+    for (auto& subsurface : d_ptr->current.pub.children) {
+        if (auto surface = subsurface->d_ptr->surface) {
+            surface->apply_queued_commits(time);
+        }
+    }
+}
+
+bool Surface::has_queued_commits() const
+{
+    return !d_ptr->queued_commits.empty();
+}
+
 Client* Surface::client() const
 {
     return d_ptr->client->handle;
@@ -1054,7 +1498,12 @@ void Surface::presentationFeedback(uint32_t presentationId,
     auto feedbacksIt = d_ptr->waitingFeedbacks.find(presentationId);
     assert(feedbacksIt != d_ptr->waitingFeedbacks.end());
 
-    feedbacksIt->second->presented(tvSecHi, tvSecLo, tvNsec, refresh, seqHi, seqLo, kinds);
+    if (d_ptr->client->events_throttled()) {
+        // Spares the timing and output events for a client that does not read them.
+        feedbacksIt->second->discard();
+    } else {
+        feedbacksIt->second->presented(tvSecHi, tvSecLo, tvNsec, refresh, seqHi, seqLo, kinds);
+    }
     d_ptr->waitingFeedbacks.erase(feedbacksIt);
 }
 
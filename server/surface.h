@@ -19,10 +19,13 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 *********************************************************************/
 #pragma once
 
+#include "linux_drm_syncobj_v1.h"
 #include "output.h"
 
 #include <QObject>
 #include <QRegion>
+#include <chrono>
+#include <optional>
 
 #include <Wrapland/Server/wraplandserver_export.h>
 
@@ -67,9 +70,29 @@ enum class surface_change {
     slide = 1 << 12,
     contrast = 1 << 13,
     frame = 1 << 14,
+    presentation_hint = 1 << 15,
+    content_type = 1 << 16,
 };
 Q_DECLARE_FLAGS(surface_changes, surface_change)
 
+enum class surface_visibility {
+    visible,
+    occluded,
+    hidden,
+};
+
+enum class surface_presentation_hint {
+    vsync,
+    async,
+};
+
+enum class surface_content_type {
+    none,
+    photo,
+    video,
+    game,
+};
+
 struct surface_state {
     std::shared_ptr<Buffer> buffer;
 
@@ -78,6 +101,8 @@ struct surface_state {
 
     int32_t scale{1};
     output_transform transform{output_transform::normal};
+
+    // Movement of the top-left corner in surface-local coordinates by this commit.
     QPoint offset;
 
     QRectF source_rectangle;
@@ -93,6 +118,16 @@ struct surface_state {
     Slide* slide{nullptr};
     Contrast* contrast{nullptr};
 
+    // Explicit synchronization points for the buffer, set through linux_drm_syncobj_manager_v1.
+    std::optional<linux_drm_syncobj_point_v1> acquire_point;
+    std::optional<linux_drm_syncobj_point_v1> release_point;
+
+    // Whether the content may be presented with tearing, set through tearing_control_manager_v1.
+    surface_presentation_hint presentation_hint{surface_presentation_hint::vsync};
+
+    // Kind of the shown content, set through content_type_manager_v1.
+    surface_content_type content_type{surface_content_type::none};
+
     surface_changes updates{surface_change::none};
 };
 
@@ -135,6 +170,52 @@ public:
 
     bool inhibitsIdle() const;
 
+    /**
+     * Hint by the compositor how visible the surface currently is to the user. It defines the
+     * frame callback policy: occluded surfaces receive frame callbacks at most once per occluded
+     * frame interval, hidden surfaces receive none until they become visible again. Subsurfaces
+     * follow the hint of their root surface.
+     */
+    surface_visibility visibility() const;
+    void set_visibility(surface_visibility visibility);
+
+    /**
+     * Minimal interval between frame callbacks while the surface is occluded. Default is one
+     * second.
+     */
+    std::chrono::milliseconds occluded_frame_interval() const;
+    void set_occluded_frame_interval(std::chrono::milliseconds interval);
+
+    /**
+     * Scale the client should render its buffers with. It is sent to clients that bound the
+     * fractional scale protocol. Default is 1.
+     */
+    double preferred_scale() const;
+    void set_preferred_scale(double scale);
+
+    /**
+     * Integer buffer scale and buffer transform the client should use, sent to clients with
+     * wl_surface version 6. Without an explicitly set value the highest client scale and the
+     * transform of the first output the surface is on are used. Setting std::nullopt returns to
+     * that default.
+     */
+    int32_t preferred_buffer_scale() const;
+    void set_preferred_buffer_scale(std::optional<int32_t> scale);
+    output_transform preferred_buffer_transform() const;
+    void set_preferred_buffer_transform(std::optional<output_transform> transform);
+
+    /**
+     * Commits are queued when they wait on a FIFO barrier, have a target presentation time or
+     * their dmabuf is still being imported. The latter are applied as soon as the import is done.
+     * Compositors call this once per refresh cycle of the output the surface is presented on with
+     * the expected presentation @p time of the upcoming frame in the clock domain of the
+     * PresentationManager. It clears the FIFO barrier and applies queued commits in order until
+     * one is not ready yet. Call it for surfaces that are not visible as well, so their clients
+     * can progress.
+     */
+    void apply_queued_commits(std::chrono::nanoseconds time);
+    bool has_queued_commits() const;
+
     uint32_t id() const;
     Client* client() const;
 
@@ -156,19 +237,35 @@ Q_SIGNALS:
     void pointerConstraintsChanged();
     void inhibitsIdleChanged();
     void committed();
+    /**
+     * Emitted when a commit got queued. The compositor should schedule a refresh cycle for the
+     * surface and call apply_queued_commits in it.
+     */
+    void commit_queued();
     void resourceDestroyed();
 
 private:
     friend class AppMenuManager;
     friend class BlurManager;
+    friend class commit_timer_v1_res_impl;
+    friend class commit_timing_manager_v1;
+    friend class content_type_manager_v1;
+    friend class content_type_v1_res_impl;
     friend class ContrastManager;
     friend class Compositor;
     friend class data_device;
+    friend class fifo_manager_v1;
+    friend class fifo_v1_res_impl;
+    friend class fractional_scale_manager_v1;
+    friend class frame_callback_scheduler;
     friend class Keyboard;
     friend class IdleInhibitManagerV1;
     friend class input_method_v2;
     friend class LayerShellV1;
     friend class LayerSurfaceV1;
+    friend class linux_drm_syncobj_manager_v1;
+    friend class linux_drm_syncobj_surface_v1_res;
+    friend class linux_drm_syncobj_surface_v1_res_impl;
     friend class PlasmaShell;
     friend class Pointer;
     friend class PointerConstraintsV1;
@@ -181,6 +278,8 @@ private:
     friend class SlideManager;
     friend class Subsurface;
     friend class text_input_v2;
+    friend class tearing_control_manager_v1;
+    friend class tearing_control_v1_res_impl;
     friend class text_input_v3;
     friend class Viewporter;
     friend class XdgShell;
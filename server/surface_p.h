@@ -28,15 +28,23 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <deque>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <unordered_map>
 #include <wayland-server.h>
 
 namespace Wrapland::Server
 {
 
+class commit_timer_v1_res;
+class content_type_v1_res;
 class Feedbacks;
+class fifo_v1_res;
+class fractional_scale_v1_res;
 class IdleInhibitor;
 class LayerSurfaceV1;
+class linux_drm_syncobj_surface_v1_res;
+class tearing_control_v1_res;
 class XdgShellSurface;
 
 class SurfaceState
@@ -62,6 +70,11 @@ public:
 
     QSize destinationSize = QSize();
 
+    // Frame pacing constraints set through fifo_v1 and commit_timer_v1.
+    bool fifo_barrier{false};
+    bool fifo_wait{false};
+    std::optional<std::chrono::nanoseconds> target_time;
+
     std::unique_ptr<Feedbacks> feedbacks{std::make_unique<Feedbacks>()};
 };
 
@@ -90,8 +103,23 @@ public:
     void installPointerConstraint(ConfinedPointerV1* confinement);
     void installIdleInhibitor(IdleInhibitor* inhibitor);
     void installViewport(Viewport* vp);
+    void install_syncobj_surface(linux_drm_syncobj_surface_v1_res* syncobj);
+    void install_tearing_control(tearing_control_v1_res* control);
+    void install_fractional_scale(fractional_scale_v1_res* scale);
+    void install_fifo(fifo_v1_res* fifo);
+    void install_commit_timer(commit_timer_v1_res* timer);
+    void install_content_type(content_type_v1_res* content_type);
+
+    void set_presentation_hint(surface_presentation_hint hint);
+    void set_content_type(surface_content_type type);
 
     void commit();
+    void apply_queued_commits(std::chrono::nanoseconds time);
+    void apply_ready_commits(std::optional<std::chrono::nanoseconds> time);
+    /**
+     * Returns false if the callbacks were withheld because of the visibility hint.
+     */
+    bool send_frame_callbacks(uint32_t msec);
 
     void updateCurrentState(bool forceChildren);
     void updateCurrentState(SurfaceState& source, bool forceChildren);
@@ -123,14 +151,49 @@ public:
     LockedPointerV1* lockedPointer{nullptr};
     ConfinedPointerV1* confinedPointer{nullptr};
     Viewport* viewport{nullptr};
+    linux_drm_syncobj_surface_v1_res* syncobj_surface{nullptr};
+    tearing_control_v1_res* tearing_control{nullptr};
+    fractional_scale_v1_res* fractional_scale{nullptr};
+    fifo_v1_res* fifo{nullptr};
+    commit_timer_v1_res* commit_timer{nullptr};
+    content_type_v1_res* content_type{nullptr};
+
+    // Commits held back by a FIFO barrier, a target time or a buffer still being imported, oldest
+    // first.
+    std::deque<std::unique_ptr<SurfaceState>> queued_commits;
+    // Set when a commit with a FIFO barrier was applied, cleared on the next refresh cycle.
+    bool fifo_barrier{false};
     QHash<WlOutput*, QMetaObject::Connection> outputDestroyedConnections;
+    QHash<WlOutput*, QMetaObject::Connection> output_state_connections;
     QVector<IdleInhibitor*> idleInhibitors;
 
+    surface_visibility visibility{surface_visibility::visible};
+    std::chrono::milliseconds occluded_frame_interval{1000};
+    std::optional<uint32_t> last_frame_msec;
+
+    double preferred_scale{1.};
+
+    std::optional<int32_t> preferred_buffer_scale;
+    std::optional<output_transform> preferred_buffer_transform;
+
+    int32_t get_preferred_buffer_scale() const;
+    output_transform get_preferred_buffer_transform() const;
+    void update_preferred_buffer_state();
+
 private:
+    bool frame_callbacks_throttled(uint32_t msec) const;
+
     void update_buffer(SurfaceState const& source, bool& resized);
+    void update_damage();
+    bool is_commit_ready(SurfaceState const& state,
+                         std::optional<std::chrono::nanoseconds> time) const;
+    void queue_commit();
+    void apply_state(SurfaceState& state);
     void copy_to_current(SurfaceState const& source, bool& resized);
     void synced_child_update();
 
+    QRegion map_viewport_damage(QRegion const& damage) const;
+
     void damage(QRect const& rect);
     void damageBuffer(QRect const& rect);
 
@@ -138,7 +201,8 @@ private:
     void setTransform(output_transform transform);
 
     void addFrameCallback(uint32_t callback);
-    void attachBuffer(wl_resource* wlBuffer, QPoint const& offset);
+    void attachBuffer(wl_resource* wlBuffer);
+    void set_offset(QPoint const& offset);
 
     void setOpaque(QRegion const& region);
     void setInput(QRegion const& region, bool isInfinite);
@@ -191,6 +255,14 @@ private:
                                      int32_t width,
                                      int32_t height);
 
+    // Since version 5.
+    static void
+    offsetCallback(wl_client* wlClient, wl_resource* wlResource, int32_t pos_x, int32_t pos_y);
+
+    // Buffer state last sent to the client.
+    int32_t sent_buffer_scale{1};
+    output_transform sent_buffer_transform{output_transform::normal};
+
     template<typename Obj>
     bool needs_resource_reset(Obj const& current,
                               Obj const& pending,
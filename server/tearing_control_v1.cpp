@@ -0,0 +1,99 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "tearing_control_v1_p.h"
+
+#include "client.h"
+#include "display.h"
+#include "surface_p.h"
+
+namespace Wrapland::Server
+{
+
+struct wp_tearing_control_manager_v1_interface const
+    tearing_control_manager_v1::Private::s_interface
+    = {
+        resourceDestroyCallback,
+        cb<get_tearing_control_callback>,
+};
+
+tearing_control_manager_v1::Private::Private(Display* display, tearing_control_manager_v1* q_ptr)
+    : tearing_control_manager_v1_global(q_ptr,
+                                        display,
+                                        &wp_tearing_control_manager_v1_interface,
+                                        &s_interface)
+{
+    create();
+}
+
+void tearing_control_manager_v1::Private::get_tearing_control_callback(
+    tearing_control_manager_v1_bind* bind,
+    uint32_t id,
+    wl_resource* wlSurface)
+{
+    auto surface = Wayland::Resource<Surface>::get_handle(wlSurface);
+
+    if (surface->d_ptr->tearing_control) {
+        bind->post_error(WP_TEARING_CONTROL_MANAGER_V1_ERROR_TEARING_CONTROL_EXISTS,
+                         "Surface already has a tearing control object");
+        return;
+    }
+
+    auto tearing_control
+        = new tearing_control_v1_res(bind->client->handle, bind->version, id, surface);
+    surface->d_ptr->install_tearing_control(tearing_control);
+}
+
+tearing_control_manager_v1::tearing_control_manager_v1(Display* display)
+    : d_ptr(new Private(display, this))
+{
+}
+
+tearing_control_manager_v1::~tearing_control_manager_v1() = default;
+
+tearing_control_v1_res::tearing_control_v1_res(Client* client,
+                                               uint32_t version,
+                                               uint32_t id,
+                                               Surface* surface)
+    : surface{surface}
+    , impl{new tearing_control_v1_res_impl(client, version, id, this)}
+{
+    connect(surface, &Surface::resourceDestroyed, this, [this] { this->surface = nullptr; });
+}
+
+struct wp_tearing_control_v1_interface const tearing_control_v1_res_impl::s_interface = {
+    set_presentation_hint_callback,
+    destroyCallback,
+};
+
+tearing_control_v1_res_impl::tearing_control_v1_res_impl(Client* client,
+                                                         uint32_t version,
+                                                         uint32_t id,
+                                                         tearing_control_v1_res* q_ptr)
+    : Wayland::Resource<tearing_control_v1_res>(client,
+                                                version,
+                                                id,
+                                                &wp_tearing_control_v1_interface,
+                                                &s_interface,
+                                                q_ptr)
+{
+}
+
+void tearing_control_v1_res_impl::set_presentation_hint_callback(
+    [[maybe_unused]] wl_client* wlClient,
+    wl_resource* wlResource,
+    uint32_t hint)
+{
+    auto surface = get_handle(wlResource)->surface;
+    if (!surface) {
+        return;
+    }
+
+    surface->d_ptr->set_presentation_hint(hint == WP_TEARING_CONTROL_V1_PRESENTATION_HINT_ASYNC
+                                              ? surface_presentation_hint::async
+                                              : surface_presentation_hint::vsync);
+}
+
+}
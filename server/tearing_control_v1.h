@@ -0,0 +1,35 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <Wrapland/Server/wraplandserver_export.h>
+
+#include <QObject>
+#include <memory>
+
+namespace Wrapland::Server
+{
+class Display;
+
+/**
+ * Global for the wp_tearing_control_manager_v1 interface.
+ *
+ * Clients hint through it whether their content may be presented with tearing. The hint is
+ * available through surface_state::presentation_hint once committed.
+ */
+class WRAPLANDSERVER_EXPORT tearing_control_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit tearing_control_manager_v1(Display* display);
+    ~tearing_control_manager_v1() override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d_ptr;
+};
+
+}
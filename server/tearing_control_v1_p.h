@@ -0,0 +1,67 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "tearing_control_v1.h"
+
+#include "wayland/global.h"
+#include "wayland/resource.h"
+
+#include <wayland-tearing-control-v1-server-protocol.h>
+
+namespace Wrapland::Server
+{
+class Surface;
+
+constexpr uint32_t tearing_control_manager_v1_version = 1;
+using tearing_control_manager_v1_global
+    = Wayland::Global<tearing_control_manager_v1, tearing_control_manager_v1_version>;
+using tearing_control_manager_v1_bind = Wayland::Bind<tearing_control_manager_v1_global>;
+
+class tearing_control_manager_v1::Private : public tearing_control_manager_v1_global
+{
+public:
+    Private(Display* display, tearing_control_manager_v1* q_ptr);
+
+private:
+    static void get_tearing_control_callback(tearing_control_manager_v1_bind* bind,
+                                             uint32_t id,
+                                             wl_resource* wlSurface);
+
+    static struct wp_tearing_control_manager_v1_interface const s_interface;
+};
+
+class tearing_control_v1_res_impl;
+
+class tearing_control_v1_res : public QObject
+{
+    Q_OBJECT
+public:
+    tearing_control_v1_res(Client* client, uint32_t version, uint32_t id, Surface* surface);
+
+    Surface* surface;
+    tearing_control_v1_res_impl* impl;
+
+Q_SIGNALS:
+    void resourceDestroyed();
+};
+
+class tearing_control_v1_res_impl : public Wayland::Resource<tearing_control_v1_res>
+{
+public:
+    tearing_control_v1_res_impl(Client* client,
+                                uint32_t version,
+                                uint32_t id,
+                                tearing_control_v1_res* q_ptr);
+
+    static struct wp_tearing_control_v1_interface const s_interface;
+
+private:
+    static void
+    set_presentation_hint_callback(wl_client* wlClient, wl_resource* wlResource, uint32_t hint);
+};
+
+}
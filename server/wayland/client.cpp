@@ -21,6 +21,8 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "../client.h"
 #include "../client_p.h"
 
+#include "client_hang_monitor.h"
+#include "client_quota.h"
 #include "display.h"
 
 #include <QFileInfo>
@@ -48,11 +50,20 @@ Client::Client(wl_client* native, Server::Client* handle)
 
 Client::~Client()
 {
+    if (quota) {
+        // Resources and buffers of the client might still hold on to it.
+        quota->release();
+    }
     if (native) {
         wl_list_remove(&m_destroyWrapper.listener.link);
     }
 }
 
+bool Client::events_throttled() const
+{
+    return hang_monitor && hang_monitor->throttles_events();
+}
+
 Display* Client::display() const
 {
     return Display::backendCast(handle->display());
@@ -85,6 +96,19 @@ Client* Client::create_client(wl_client* wlClient, Display* display)
     return (new Server::Client(wlClient, display->handle))->d_ptr.get();
 }
 
+Client* Client::get_client(wl_client* wlClient)
+{
+    auto listener = wl_client_get_destroy_listener(wlClient, destroyListenerCallback);
+    if (!listener) {
+        return nullptr;
+    }
+
+    // See destroyListenerCallback for why wl_container_of is used this way.
+    // NOLINTNEXTLINE
+    DestroyWrapper* wrapper = wl_container_of(listener, wrapper, listener);
+    return wrapper->client;
+}
+
 void Client::destroyListenerCallback(wl_listener* listener, [[maybe_unused]] void* data)
 {
     // The wl_container_of macro can not be used with auto keyword and in the macro from libwayland
@@ -19,6 +19,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 *********************************************************************/
 #pragma once
 
+#include <memory>
 #include <string>
 #include <sys/types.h>
 #include <vector>
@@ -36,6 +37,8 @@ class Display;
 
 namespace Wayland
 {
+class client_hang_monitor;
+class client_quota_state;
 class Display;
 
 class Client
@@ -67,9 +70,25 @@ public:
     static Client* cast_client(Server::Client* client);
     static Client* create_client(wl_client* wlClient, Display* display);
 
+    /**
+     * Returns the Client created for @p wlClient or nullptr if there is none. The lookup goes
+     * through the destroy listener installed on the native client and does not depend on the
+     * number of connected clients.
+     */
+    static Client* get_client(wl_client* wlClient);
+
     wl_client* native;
     Server::Client* handle;
 
+    // Created once a quota is set.
+    std::shared_ptr<client_quota_state> quota;
+
+    // Created once hang detection is set.
+    std::unique_ptr<client_hang_monitor> hang_monitor;
+
+    /// Whether high-frequency events are held back for the client.
+    bool events_throttled() const;
+
 private:
     static void destroyListenerCallback(wl_listener* listener, void* data);
 
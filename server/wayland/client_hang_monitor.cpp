@@ -0,0 +1,111 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "client_hang_monitor.h"
+
+#include "client.h"
+
+#include <linux/sockios.h>
+#include <sys/ioctl.h>
+#include <wayland-server.h>
+
+namespace Wrapland::Server::Wayland
+{
+
+// How often a client with queued data is checked when nothing else happens.
+constexpr std::chrono::milliseconds s_check_interval{100};
+
+client_hang_monitor::client_hang_monitor(Client* client)
+    : client{client}
+    , last_progress{std::chrono::steady_clock::now()}
+    , timer{client->handle->display(), [this] { check(); }}
+{
+}
+
+void client_hang_monitor::set(client_hang_detection const& config)
+{
+    this->config = config;
+    check();
+}
+
+void client_hang_monitor::sample()
+{
+    if (client->native) {
+        record(queued_socket_bytes(client->native));
+    }
+}
+
+void client_hang_monitor::check()
+{
+    if (!client->native) {
+        return;
+    }
+
+    auto const queued = queued_socket_bytes(client->native);
+    record(queued);
+
+    auto const stalled = queued > 0 && config.max_stall.count() > 0
+        && std::chrono::steady_clock::now() - last_progress >= config.max_stall;
+    auto const overfull
+        = config.max_queued_socket_bytes > 0 && queued > config.max_queued_socket_bytes;
+    set_hung(stalled || overfull);
+
+    if (queued == 0) {
+        timer.stop();
+    } else if (!timer.active()) {
+        timer.start(s_check_interval);
+    }
+}
+
+bool client_hang_monitor::throttles_events() const
+{
+    return hung && config.throttle_events;
+}
+
+std::chrono::milliseconds client_hang_monitor::stall_time() const
+{
+    if (last_queued == 0) {
+        return std::chrono::milliseconds::zero();
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now()
+                                                                 - last_progress);
+}
+
+size_t client_hang_monitor::queued_socket_bytes(wl_client* native)
+{
+    // On Unix sockets SIOCOUTQ reports the memory of the queued socket buffers, not the payload.
+    int bytes{0};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    if (ioctl(wl_client_get_fd(native), SIOCOUTQ, &bytes) < 0 || bytes < 0) {
+        return 0;
+    }
+    return static_cast<size_t>(bytes);
+}
+
+void client_hang_monitor::record(size_t queued)
+{
+    // The client read data when the queue shrank. Data sent to an empty queue waits from now on.
+    if (queued == 0 || last_queued == 0 || queued < last_queued) {
+        last_progress = std::chrono::steady_clock::now();
+    }
+    last_queued = queued;
+}
+
+void client_hang_monitor::set_hung(bool hung)
+{
+    if (this->hung == hung) {
+        return;
+    }
+    this->hung = hung;
+
+    // Checks run while flushing all clients. Receivers might destroy the client.
+    QMetaObject::invokeMethod(
+        client->handle,
+        [handle = client->handle, hung] { Q_EMIT handle->hung_changed(hung); },
+        Qt::QueuedConnection);
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "../client.h"
+#include "../event_loop.h"
+
+#include <chrono>
+#include <memory>
+
+struct wl_client;
+
+namespace Wrapland::Server::Wayland
+{
+
+class Client;
+
+/**
+ * Samples the socket memory queued for a client. That is done before and after each flush of the
+ * display and periodically while data is queued, so a stall is noticed also when the compositor
+ * is idle.
+ *
+ * The client made progress when the queue shrank between two samples. Events are written to the
+ * socket only while flushing, so a client reading steadily but slower than the compositor writes
+ * still shrinks the queue until the next flush. Only when libwayland's own buffer runs full, it
+ * writes in between and might hide what the client read.
+ */
+class client_hang_monitor
+{
+public:
+    explicit client_hang_monitor(Client* client);
+
+    void set(client_hang_detection const& config);
+
+    /// Called before flushing the display.
+    void sample();
+    /// Called after flushing the display and periodically while data is queued.
+    void check();
+
+    bool throttles_events() const;
+    std::chrono::milliseconds stall_time() const;
+
+    static size_t queued_socket_bytes(wl_client* native);
+
+    client_hang_detection config;
+    bool hung{false};
+
+private:
+    void record(size_t queued);
+    void set_hung(bool hung);
+
+    Client* client;
+
+    size_t last_queued{0};
+    std::chrono::steady_clock::time_point last_progress;
+    event_timer timer;
+};
+
+}
@@ -0,0 +1,215 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "client_quota.h"
+
+#include <algorithm>
+
+namespace Wrapland::Server::Wayland
+{
+
+client_quota_state::client_quota_state(wl_client* native, Server::Client* handle)
+    : native{native}
+    , handle{handle}
+{
+    created_wrapper.state = this;
+    created_wrapper.listener.notify = resource_created_callback;
+}
+
+client_quota_state::~client_quota_state()
+{
+    release();
+}
+
+void client_quota_state::set(client_quota const& quota)
+{
+    config = quota;
+
+    // Already tracked resources keep being counted. Only the limits change.
+    for (auto& [name, count] : resources) {
+        count.max = 0;
+    }
+    for (auto const& [name, max] : config.max_resources) {
+        resources[name].max = max;
+    }
+    class_counts.clear();
+
+    requests.tokens = config.requests.burst > 0 ? config.requests.burst : config.requests.rate;
+    requests.refilled = std::chrono::steady_clock::now();
+    requests.exhausted = false;
+
+    if (!native) {
+        return;
+    }
+
+    if (config.max_resources.empty()) {
+        if (created_wrapper.installed) {
+            wl_list_remove(&created_wrapper.listener.link);
+            created_wrapper.installed = false;
+        }
+        return;
+    }
+
+    if (!created_wrapper.installed) {
+        wl_client_add_resource_created_listener(native, &created_wrapper.listener);
+        created_wrapper.installed = true;
+    }
+    wl_client_for_each_resource(native, track_existing, this);
+}
+
+void client_quota_state::release()
+{
+    if (created_wrapper.installed) {
+        wl_list_remove(&created_wrapper.listener.link);
+        created_wrapper.installed = false;
+    }
+    native = nullptr;
+    handle = nullptr;
+}
+
+void client_quota_state::add_buffer(wl_resource* buffer, size_t bytes)
+{
+    // Surfaces create a new Buffer on every attach. Charge the wl_buffer only the first time.
+    if (wl_resource_get_destroy_listener(buffer, buffer_destroyed_callback)) {
+        return;
+    }
+
+    auto tracker = new buffer_tracker;
+    tracker->listener.notify = buffer_destroyed_callback;
+    tracker->state = shared_from_this();
+    tracker->bytes = bytes;
+    wl_resource_add_destroy_listener(buffer, &tracker->listener);
+
+    buffer_bytes += bytes;
+    if (config.max_buffer_bytes > 0 && buffer_bytes > config.max_buffer_bytes) {
+        exceed(client_quota_kind::buffer_bytes, "Buffer memory quota exceeded");
+    }
+}
+
+void client_quota_state::count_request()
+{
+    if (requests.tokens >= 1) {
+        requests.tokens -= 1;
+        return;
+    }
+
+    // The bucket is refilled only when it runs empty. That saves reading the clock on every
+    // request.
+    auto const now = std::chrono::steady_clock::now();
+    auto const elapsed = std::chrono::duration<double>(now - requests.refilled).count();
+    auto const burst = config.requests.burst > 0 ? config.requests.burst : config.requests.rate;
+
+    requests.tokens = std::min<double>(requests.tokens + elapsed * config.requests.rate, burst);
+    requests.refilled = now;
+
+    if (requests.tokens >= 1) {
+        requests.tokens -= 1;
+        requests.exhausted = false;
+        return;
+    }
+
+    // Reported once until the client slows down again.
+    if (!requests.exhausted) {
+        requests.exhausted = true;
+        exceed(client_quota_kind::request_rate, "Request rate quota exceeded");
+    }
+}
+
+bool client_quota_state::limits_requests() const
+{
+    return config.requests.rate > 0;
+}
+
+client_quota_state::resource_count* client_quota_state::get_count(char const* class_name)
+{
+    if (auto it = class_counts.find(class_name); it != class_counts.end()) {
+        return it->second;
+    }
+
+    resource_count* count{nullptr};
+    if (auto it = resources.find(class_name); it != resources.end() && it->second.max > 0) {
+        count = &it->second;
+    }
+    class_counts.emplace(class_name, count);
+    return count;
+}
+
+void client_quota_state::track(wl_resource* resource, resource_count* count)
+{
+    auto tracker = new resource_tracker;
+    tracker->listener.notify = resource_destroyed_callback;
+    tracker->state = shared_from_this();
+    tracker->count = count;
+    wl_resource_add_destroy_listener(resource, &tracker->listener);
+
+    count->count++;
+}
+
+void client_quota_state::exceed(client_quota_kind kind, std::string const& message)
+{
+    if (config.action == client_quota_action::error && native) {
+        wl_client_post_implementation_error(native, "%s", message.c_str());
+    }
+
+    if (handle) {
+        Q_EMIT handle->quota_exceeded(kind);
+    }
+}
+
+void client_quota_state::resource_created_callback(wl_listener* listener, void* data)
+{
+    // See Wayland::Client::destroyListenerCallback for why wl_container_of is used this way.
+    // NOLINTNEXTLINE
+    decltype(created_wrapper)* wrapper = wl_container_of(listener, wrapper, listener);
+    auto state = wrapper->state;
+    auto resource = static_cast<wl_resource*>(data);
+
+    auto const class_name = wl_resource_get_class(resource);
+    auto count = state->get_count(class_name);
+    if (!count) {
+        return;
+    }
+
+    state->track(resource, count);
+    if (count->count > count->max) {
+        state->exceed(client_quota_kind::resources,
+                      std::string("Resource quota exceeded for ") + class_name);
+    }
+}
+
+void client_quota_state::resource_destroyed_callback(wl_listener* listener, void* /*data*/)
+{
+    // See Wayland::Client::destroyListenerCallback for why wl_container_of is used this way.
+    // NOLINTNEXTLINE
+    resource_tracker* tracker = wl_container_of(listener, tracker, listener);
+
+    tracker->count->count--;
+    delete tracker;
+}
+
+void client_quota_state::buffer_destroyed_callback(wl_listener* listener, void* /*data*/)
+{
+    // See Wayland::Client::destroyListenerCallback for why wl_container_of is used this way.
+    // NOLINTNEXTLINE
+    buffer_tracker* tracker = wl_container_of(listener, tracker, listener);
+
+    auto& state = *tracker->state;
+    state.buffer_bytes -= std::min(tracker->bytes, state.buffer_bytes);
+    delete tracker;
+}
+
+wl_iterator_result client_quota_state::track_existing(wl_resource* resource, void* data)
+{
+    auto state = static_cast<client_quota_state*>(data);
+
+    if (!wl_resource_get_destroy_listener(resource, resource_destroyed_callback)) {
+        if (auto count = state->get_count(wl_resource_get_class(resource))) {
+            state->track(resource, count);
+        }
+    }
+    return WL_ITERATOR_CONTINUE;
+}
+
+}
@@ -0,0 +1,97 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include "../client.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <wayland-server.h>
+
+namespace Wrapland::Server::Wayland
+{
+
+/**
+ * Enforces the quota of a client. Resources and buffers of the client hold on to it, so it stays
+ * around until they are gone also when the client is destroyed before.
+ */
+class client_quota_state : public std::enable_shared_from_this<client_quota_state>
+{
+public:
+    client_quota_state(wl_client* native, Server::Client* handle);
+    ~client_quota_state();
+
+    client_quota_state(client_quota_state const&) = delete;
+    client_quota_state& operator=(client_quota_state const&) = delete;
+    client_quota_state(client_quota_state&&) noexcept = delete;
+    client_quota_state& operator=(client_quota_state&&) noexcept = delete;
+
+    void set(client_quota const& quota);
+
+    /// Called when the client is destroyed.
+    void release();
+
+    /// Charges an attached shm buffer once until its wl_buffer resource is destroyed.
+    void add_buffer(wl_resource* buffer, size_t bytes);
+
+    void count_request();
+    bool limits_requests() const;
+
+    client_quota config;
+
+private:
+    struct resource_count {
+        size_t max{0};
+        size_t count{0};
+    };
+
+    struct resource_tracker {
+        wl_listener listener;
+        std::shared_ptr<client_quota_state> state;
+        resource_count* count;
+    };
+
+    struct buffer_tracker {
+        wl_listener listener;
+        std::shared_ptr<client_quota_state> state;
+        size_t bytes;
+    };
+
+    resource_count* get_count(char const* class_name);
+    void track(wl_resource* resource, resource_count* count);
+    void exceed(client_quota_kind kind, std::string const& message);
+
+    static void resource_created_callback(wl_listener* listener, void* data);
+    static void resource_destroyed_callback(wl_listener* listener, void* data);
+    static void buffer_destroyed_callback(wl_listener* listener, void* data);
+    static wl_iterator_result track_existing(wl_resource* resource, void* data);
+
+    wl_client* native;
+    Server::Client* handle;
+
+    // Node-based, so trackers can point into it.
+    std::unordered_map<std::string, resource_count> resources;
+    // By the class name pointer of an interface. Null when the interface is not limited.
+    std::unordered_map<char const*, resource_count*> class_counts;
+
+    size_t buffer_bytes{0};
+
+    struct {
+        double tokens{0};
+        std::chrono::steady_clock::time_point refilled;
+        bool exhausted{false};
+    } requests;
+
+    struct {
+        wl_listener listener;
+        client_quota_state* state;
+        bool installed{false};
+    } created_wrapper;
+};
+
+}
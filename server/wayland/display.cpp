@@ -30,6 +30,8 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "buffer_manager.h"
 #include "client.h"
+#include "client_hang_monitor.h"
+#include "client_quota.h"
 #include "nucleus.h"
 
 #include "utils.h"
@@ -63,6 +65,7 @@ Display::~Display()
 
     terminate();
     if (m_display) {
+        destroy_request_logger();
         wl_display_destroy(m_display);
     }
 }
@@ -164,6 +167,7 @@ void Display::terminate()
         nucleus->release();
     }
 
+    destroy_request_logger();
     wl_display_destroy(m_display);
 
     m_display = nullptr;
@@ -198,7 +202,19 @@ void Display::flush()
     if (!m_display || !m_loop) {
         return;
     }
+    for (auto client : m_clients) {
+        if (client->hang_monitor) {
+            client->hang_monitor->sample();
+        }
+    }
+
     wl_display_flush_clients(m_display);
+
+    for (auto client : m_clients) {
+        if (client->hang_monitor) {
+            client->hang_monitor->check();
+        }
+    }
 }
 
 void Display::dispatchEvents(int msecTimeout)
@@ -226,16 +242,7 @@ void Display::dispatch()
 Client* Display::getClient(wl_client* wlClient)
 {
     Q_ASSERT(wlClient);
-
-    auto it = std::find_if(m_clients.cbegin(), m_clients.cend(), [wlClient](Client* client) {
-        return client->native == wlClient;
-    });
-
-    if (it != m_clients.cend()) {
-        return *it;
-    }
-
-    return nullptr;
+    return Client::get_client(wlClient);
 }
 
 Server::Client* Display::createClientHandle(wl_client* wlClient)
@@ -243,6 +250,13 @@ Server::Client* Display::createClientHandle(wl_client* wlClient)
     auto priv_cl = Client::create_client(wlClient, this);
     m_clients.push_back(priv_cl);
 
+    if (default_quota) {
+        priv_cl->handle->set_quota(*default_quota);
+    }
+    if (default_hang_detection) {
+        priv_cl->handle->set_hang_detection(*default_hang_detection);
+    }
+
     QObject::connect(priv_cl->handle, &Server::Client::disconnected, handle, [this](auto client) {
         remove_all_if(m_clients,
                       [client](auto&& candidate) { return candidate->handle == client; });
@@ -262,4 +276,42 @@ BufferManager* Display::bufferManager() const
     return m_bufferManager.get();
 }
 
+void Display::update_request_logger()
+{
+    if (m_request_logger || !m_display) {
+        return;
+    }
+
+    auto const limited = std::any_of(m_clients.cbegin(), m_clients.cend(), [](auto client) {
+        return client->quota && client->quota->limits_requests();
+    });
+    if (limited) {
+        // Once installed it stays. Clients without a limit are skipped in the callback.
+        m_request_logger
+            = wl_display_add_protocol_logger(m_display, request_logger_callback, nullptr);
+    }
+}
+
+void Display::destroy_request_logger()
+{
+    if (m_request_logger) {
+        wl_protocol_logger_destroy(m_request_logger);
+        m_request_logger = nullptr;
+    }
+}
+
+void Display::request_logger_callback(void* /*data*/,
+                                      wl_protocol_logger_type type,
+                                      wl_protocol_logger_message const* message)
+{
+    if (type != WL_PROTOCOL_LOGGER_REQUEST) {
+        return;
+    }
+
+    auto client = Client::get_client(wl_resource_get_client(message->resource));
+    if (client && client->quota && client->quota->limits_requests()) {
+        client->quota->count_request();
+    }
+}
+
 }
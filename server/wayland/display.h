@@ -19,12 +19,16 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 *********************************************************************/
 #pragma once
 
+#include "../client.h"
+
 #include <EGL/egl.h>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
+#include <wayland-server.h>
 
 struct wl_client;
 struct wl_display;
@@ -79,12 +83,24 @@ public:
 
     BufferManager* bufferManager() const;
 
+    /// Installs the request logger once a client has its request rate limited.
+    void update_request_logger();
+
     std::string socket_name;
     Server::Display* handle;
     EGLDisplay eglDisplay{EGL_NO_DISPLAY};
 
+    // Set on clients when they are created.
+    std::optional<client_quota> default_quota;
+    std::optional<client_hang_detection> default_hang_detection;
+
 private:
     void addSocket();
+    void destroy_request_logger();
+
+    static void request_logger_callback(void* data,
+                                        wl_protocol_logger_type type,
+                                        wl_protocol_logger_message const* message);
 
     wl_display* m_display = nullptr;
     wl_event_loop* m_loop = nullptr;
@@ -97,6 +113,8 @@ private:
 
     std::vector<Client*> m_clients;
     std::unique_ptr<BufferManager> m_bufferManager;
+
+    wl_protocol_logger* m_request_logger{nullptr};
 };
 
 }
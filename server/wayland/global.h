@@ -60,6 +60,27 @@ auto& global_get_display_ref(Global& global)
         return globals.viewporter;
     } else if constexpr (std::is_same_v<Handle, decltype(globals.presentation_manager)>) {
         return globals.presentation_manager;
+    } else if constexpr (std::is_same_v<Handle, decltype(globals.single_pixel_buffer_manager_v1)>) {
+        return globals.single_pixel_buffer_manager_v1;
+    } else if constexpr (std::is_same_v<Handle, decltype(globals.linux_drm_syncobj_manager_v1)>) {
+        return globals.linux_drm_syncobj_manager_v1;
+    } else if constexpr (std::is_same_v<Handle, decltype(globals.tearing_control_manager_v1)>) {
+        return globals.tearing_control_manager_v1;
+    } else if constexpr (std::is_same_v<Handle, decltype(globals.fractional_scale_manager_v1)>) {
+        return globals.fractional_scale_manager_v1;
+    } else if constexpr (std::is_same_v<Handle, decltype(globals.fifo_manager_v1)>) {
+        return globals.fifo_manager_v1;
+    } else if constexpr (std::is_same_v<Handle, decltype(globals.commit_timing_manager_v1)>) {
+        return globals.commit_timing_manager_v1;
+    } else if constexpr (std::is_same_v<Handle, decltype(globals.content_type_manager_v1)>) {
+        return globals.content_type_manager_v1;
+    } else if constexpr (std::is_same_v<Handle, decltype(globals.cursor_shape_manager_v1)>) {
+        return globals.cursor_shape_manager_v1;
+    } else if constexpr (std::is_same_v<Handle,
+                                        decltype(globals.output_image_capture_source_manager_v1)>) {
+        return globals.output_image_capture_source_manager_v1;
+    } else if constexpr (std::is_same_v<Handle, decltype(globals.image_copy_capture_manager_v1)>) {
+        return globals.image_copy_capture_manager_v1;
     } else if constexpr (std::is_same_v<Handle, decltype(globals.shadow_manager)>) {
         return globals.shadow_manager;
     } else if constexpr (std::is_same_v<Handle, decltype(globals.blur_manager)>) {
@@ -123,6 +144,9 @@ auto& global_get_display_ref(Global& global)
         return globals.plasma_shell;
     } else if constexpr (std::is_same_v<Handle, decltype(globals.plasma_window_manager)>) {
         return globals.plasma_window_manager;
+    } else if constexpr (std::is_same_v<Handle,
+                                        decltype(globals.plasma_stacking_order_manager_v1)>) {
+        return globals.plasma_stacking_order_manager_v1;
     } else if constexpr (std::is_same_v<Handle, decltype(globals.idle_notifier_v1)>) {
         return globals.idle_notifier_v1;
     } else if constexpr (std::is_same_v<Handle, decltype(globals.kde_idle)>) {
@@ -179,9 +203,10 @@ public:
         nucleus->remove();
     }
 
-    void create()
+    /// Creates the global. A lower @p version is advertised when optional features are missing.
+    void create(int version = Version)
     {
-        nucleus->create();
+        nucleus->create(version);
     }
 
     Display* display()
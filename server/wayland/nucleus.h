@@ -106,10 +106,11 @@ public:
         }
     }
 
-    void create()
+    void create(int version)
     {
         assert(!native_global);
-        native_global = wl_global_create(display->native(), interface, Global::version, this, bind);
+        assert(version <= Global::version);
+        native_global = wl_global_create(display->native(), interface, version, this, bind);
     }
 
     void unbind(Bind<Global>* bind)
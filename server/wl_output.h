@@ -38,6 +38,8 @@ public:
 
 Q_SIGNALS:
     void removed();
+    /// Emitted after the geometry, transform, scale or mode sent to clients changed.
+    void state_changed();
 
 private:
     explicit WlOutput(Server::output* output, Display* display);
@@ -0,0 +1,82 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "commit_timing_v1.h"
+
+#include "event_queue.h"
+#include "surface.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-commit-timing-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN commit_timing_manager_v1::Private
+{
+public:
+    WaylandPointer<wp_commit_timing_manager_v1, wp_commit_timing_manager_v1_destroy> manager;
+    EventQueue* queue = nullptr;
+};
+
+commit_timing_manager_v1::commit_timing_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+commit_timing_manager_v1::~commit_timing_manager_v1()
+{
+    release();
+}
+
+void commit_timing_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool commit_timing_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void commit_timing_manager_v1::setup(wp_commit_timing_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* commit_timing_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void commit_timing_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+wp_commit_timer_v1* commit_timing_manager_v1::get_timer(Surface* surface)
+{
+    Q_ASSERT(isValid());
+    auto timer = wp_commit_timing_manager_v1_get_timer(d->manager, *surface);
+    if (d->queue) {
+        d->queue->addProxy(timer);
+    }
+    return timer;
+}
+
+commit_timing_manager_v1::operator wp_commit_timing_manager_v1*() const
+{
+    return d->manager;
+}
+
+commit_timing_manager_v1::operator wp_commit_timing_manager_v1*()
+{
+    return d->manager;
+}
+
+}
@@ -0,0 +1,97 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <QObject>
+#include <Wrapland/Client/wraplandclient_export.h>
+#include <memory>
+
+struct wp_commit_timer_v1;
+struct wp_commit_timing_manager_v1;
+
+namespace Wrapland::Client
+{
+
+class EventQueue;
+class Surface;
+
+/**
+ * @short Wrapper for the wp_commit_timing_manager_v1 interface.
+ *
+ * Allows to set a target presentation time for the commits of a surface.
+ *
+ * To use this class one needs to interact with the Registry. There are two
+ * possible ways to create the commit_timing_manager_v1 interface:
+ * @code
+ * auto m = registry->createCommitTimingManagerV1(name, version);
+ * @endcode
+ *
+ * This creates the commit_timing_manager_v1 and sets it up directly. As an alternative this
+ * can also be done in a more low level way:
+ * @code
+ * auto m = new commit_timing_manager_v1;
+ * m->setup(registry->bindCommitTimingManagerV1(name, version));
+ * @endcode
+ *
+ * @see Registry
+ **/
+class WRAPLANDCLIENT_EXPORT commit_timing_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit commit_timing_manager_v1(QObject* parent = nullptr);
+    ~commit_timing_manager_v1() override;
+
+    /**
+     * @returns @c true if managing a wp_commit_timing_manager_v1.
+     **/
+    bool isValid() const;
+    /**
+     * Setup this commit_timing_manager_v1 to manage the @p manager.
+     * When using Registry::createCommitTimingManagerV1 there is no need to call this
+     * method.
+     **/
+    void setup(wp_commit_timing_manager_v1* manager);
+    /**
+     * Releases the wp_commit_timing_manager_v1 interface.
+     * After the interface has been released the commit_timing_manager_v1 instance is no
+     * longer valid and can be setup with another wp_commit_timing_manager_v1 interface.
+     **/
+    void release();
+
+    /**
+     * Sets the @p queue to use for creating objects.
+     **/
+    void setEventQueue(EventQueue* queue);
+    /**
+     * @returns The event queue to use for creating objects.
+     **/
+    EventQueue* eventQueue();
+
+    /**
+     * Creates the commit timer for @p surface. The caller takes ownership of it and must destroy
+     * it with wp_commit_timer_v1_destroy.
+     **/
+    wp_commit_timer_v1* get_timer(Surface* surface);
+
+    operator wp_commit_timing_manager_v1*();
+    operator wp_commit_timing_manager_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * The corresponding global for this interface on the Registry got removed.
+     *
+     * This signal gets only emitted if the manager got created by
+     * Registry::createCommitTimingManagerV1
+     **/
+    void removed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}
@@ -0,0 +1,82 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "content_type_v1.h"
+
+#include "event_queue.h"
+#include "surface.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-content-type-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN content_type_manager_v1::Private
+{
+public:
+    WaylandPointer<wp_content_type_manager_v1, wp_content_type_manager_v1_destroy> manager;
+    EventQueue* queue = nullptr;
+};
+
+content_type_manager_v1::content_type_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+content_type_manager_v1::~content_type_manager_v1()
+{
+    release();
+}
+
+void content_type_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool content_type_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void content_type_manager_v1::setup(wp_content_type_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* content_type_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void content_type_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+wp_content_type_v1* content_type_manager_v1::get_surface_content_type(Surface* surface)
+{
+    Q_ASSERT(isValid());
+    auto content_type = wp_content_type_manager_v1_get_surface_content_type(d->manager, *surface);
+    if (d->queue) {
+        d->queue->addProxy(content_type);
+    }
+    return content_type;
+}
+
+content_type_manager_v1::operator wp_content_type_manager_v1*() const
+{
+    return d->manager;
+}
+
+content_type_manager_v1::operator wp_content_type_manager_v1*()
+{
+    return d->manager;
+}
+
+}
@@ -0,0 +1,98 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <QObject>
+#include <Wrapland/Client/wraplandclient_export.h>
+#include <memory>
+
+struct wp_content_type_manager_v1;
+struct wp_content_type_v1;
+
+namespace Wrapland::Client
+{
+
+class EventQueue;
+class Surface;
+
+/**
+ * @short Wrapper for the wp_content_type_manager_v1 interface.
+ *
+ * Allows to describe the kind of content a surface shows, so the compositor can adapt its
+ * presentation to it.
+ *
+ * To use this class one needs to interact with the Registry. There are two
+ * possible ways to create the content_type_manager_v1 interface:
+ * @code
+ * auto m = registry->createContentTypeManagerV1(name, version);
+ * @endcode
+ *
+ * This creates the content_type_manager_v1 and sets it up directly. As an alternative this
+ * can also be done in a more low level way:
+ * @code
+ * auto m = new content_type_manager_v1;
+ * m->setup(registry->bindContentTypeManagerV1(name, version));
+ * @endcode
+ *
+ * @see Registry
+ **/
+class WRAPLANDCLIENT_EXPORT content_type_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit content_type_manager_v1(QObject* parent = nullptr);
+    ~content_type_manager_v1() override;
+
+    /**
+     * @returns @c true if managing a wp_content_type_manager_v1.
+     **/
+    bool isValid() const;
+    /**
+     * Setup this content_type_manager_v1 to manage the @p manager.
+     * When using Registry::createContentTypeManagerV1 there is no need to call this
+     * method.
+     **/
+    void setup(wp_content_type_manager_v1* manager);
+    /**
+     * Releases the wp_content_type_manager_v1 interface.
+     * After the interface has been released the content_type_manager_v1 instance is no
+     * longer valid and can be setup with another wp_content_type_manager_v1 interface.
+     **/
+    void release();
+
+    /**
+     * Sets the @p queue to use for creating objects.
+     **/
+    void setEventQueue(EventQueue* queue);
+    /**
+     * @returns The event queue to use for creating objects.
+     **/
+    EventQueue* eventQueue();
+
+    /**
+     * Creates the content type object for @p surface. The caller takes ownership of it and must
+     * destroy it with wp_content_type_v1_destroy.
+     **/
+    wp_content_type_v1* get_surface_content_type(Surface* surface);
+
+    operator wp_content_type_manager_v1*();
+    operator wp_content_type_manager_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * The corresponding global for this interface on the Registry got removed.
+     *
+     * This signal gets only emitted if the manager got created by
+     * Registry::createContentTypeManagerV1
+     **/
+    void removed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}
@@ -0,0 +1,82 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "cursor_shape_v1.h"
+
+#include "event_queue.h"
+#include "pointer.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-cursor-shape-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN cursor_shape_manager_v1::Private
+{
+public:
+    WaylandPointer<wp_cursor_shape_manager_v1, wp_cursor_shape_manager_v1_destroy> manager;
+    EventQueue* queue = nullptr;
+};
+
+cursor_shape_manager_v1::cursor_shape_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+cursor_shape_manager_v1::~cursor_shape_manager_v1()
+{
+    release();
+}
+
+void cursor_shape_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool cursor_shape_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void cursor_shape_manager_v1::setup(wp_cursor_shape_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* cursor_shape_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void cursor_shape_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+wp_cursor_shape_device_v1* cursor_shape_manager_v1::get_pointer(Pointer* pointer)
+{
+    Q_ASSERT(isValid());
+    auto device = wp_cursor_shape_manager_v1_get_pointer(d->manager, *pointer);
+    if (d->queue) {
+        d->queue->addProxy(device);
+    }
+    return device;
+}
+
+cursor_shape_manager_v1::operator wp_cursor_shape_manager_v1*() const
+{
+    return d->manager;
+}
+
+cursor_shape_manager_v1::operator wp_cursor_shape_manager_v1*()
+{
+    return d->manager;
+}
+
+}
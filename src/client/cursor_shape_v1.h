@@ -0,0 +1,97 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <QObject>
+#include <Wrapland/Client/wraplandclient_export.h>
+#include <memory>
+
+struct wp_cursor_shape_device_v1;
+struct wp_cursor_shape_manager_v1;
+
+namespace Wrapland::Client
+{
+
+class EventQueue;
+class Pointer;
+
+/**
+ * @short Wrapper for the wp_cursor_shape_manager_v1 interface.
+ *
+ * Allows to set named cursor shapes for a pointer instead of cursor surfaces.
+ *
+ * To use this class one needs to interact with the Registry. There are two
+ * possible ways to create the cursor_shape_manager_v1 interface:
+ * @code
+ * auto m = registry->createCursorShapeManagerV1(name, version);
+ * @endcode
+ *
+ * This creates the cursor_shape_manager_v1 and sets it up directly. As an alternative this
+ * can also be done in a more low level way:
+ * @code
+ * auto m = new cursor_shape_manager_v1;
+ * m->setup(registry->bindCursorShapeManagerV1(name, version));
+ * @endcode
+ *
+ * @see Registry
+ **/
+class WRAPLANDCLIENT_EXPORT cursor_shape_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit cursor_shape_manager_v1(QObject* parent = nullptr);
+    ~cursor_shape_manager_v1() override;
+
+    /**
+     * @returns @c true if managing a wp_cursor_shape_manager_v1.
+     **/
+    bool isValid() const;
+    /**
+     * Setup this cursor_shape_manager_v1 to manage the @p manager.
+     * When using Registry::createCursorShapeManagerV1 there is no need to call this
+     * method.
+     **/
+    void setup(wp_cursor_shape_manager_v1* manager);
+    /**
+     * Releases the wp_cursor_shape_manager_v1 interface.
+     * After the interface has been released the cursor_shape_manager_v1 instance is no
+     * longer valid and can be setup with another wp_cursor_shape_manager_v1 interface.
+     **/
+    void release();
+
+    /**
+     * Sets the @p queue to use for creating objects.
+     **/
+    void setEventQueue(EventQueue* queue);
+    /**
+     * @returns The event queue to use for creating objects.
+     **/
+    EventQueue* eventQueue();
+
+    /**
+     * Creates the cursor shape device for @p pointer. The caller takes ownership of it and must
+     * destroy it with wp_cursor_shape_device_v1_destroy.
+     **/
+    wp_cursor_shape_device_v1* get_pointer(Pointer* pointer);
+
+    operator wp_cursor_shape_manager_v1*();
+    operator wp_cursor_shape_manager_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * The corresponding global for this interface on the Registry got removed.
+     *
+     * This signal gets only emitted if the manager got created by
+     * Registry::createCursorShapeManagerV1
+     **/
+    void removed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}
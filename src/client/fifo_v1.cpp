@@ -0,0 +1,82 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "fifo_v1.h"
+
+#include "event_queue.h"
+#include "surface.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-fifo-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN fifo_manager_v1::Private
+{
+public:
+    WaylandPointer<wp_fifo_manager_v1, wp_fifo_manager_v1_destroy> manager;
+    EventQueue* queue = nullptr;
+};
+
+fifo_manager_v1::fifo_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+fifo_manager_v1::~fifo_manager_v1()
+{
+    release();
+}
+
+void fifo_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool fifo_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void fifo_manager_v1::setup(wp_fifo_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* fifo_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void fifo_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+wp_fifo_v1* fifo_manager_v1::get_fifo(Surface* surface)
+{
+    Q_ASSERT(isValid());
+    auto fifo = wp_fifo_manager_v1_get_fifo(d->manager, *surface);
+    if (d->queue) {
+        d->queue->addProxy(fifo);
+    }
+    return fifo;
+}
+
+fifo_manager_v1::operator wp_fifo_manager_v1*() const
+{
+    return d->manager;
+}
+
+fifo_manager_v1::operator wp_fifo_manager_v1*()
+{
+    return d->manager;
+}
+
+}
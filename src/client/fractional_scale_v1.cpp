@@ -0,0 +1,173 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "fractional_scale_v1.h"
+
+#include "event_queue.h"
+#include "surface.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-fractional-scale-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN fractional_scale_manager_v1::Private
+{
+public:
+    WaylandPointer<wp_fractional_scale_manager_v1, wp_fractional_scale_manager_v1_destroy>
+        manager;
+    EventQueue* queue = nullptr;
+};
+
+fractional_scale_manager_v1::fractional_scale_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+fractional_scale_manager_v1::~fractional_scale_manager_v1()
+{
+    release();
+}
+
+void fractional_scale_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool fractional_scale_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void fractional_scale_manager_v1::setup(wp_fractional_scale_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* fractional_scale_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void fractional_scale_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+fractional_scale_v1* fractional_scale_manager_v1::get_fractional_scale(Surface* surface,
+                                                                      QObject* parent)
+{
+    Q_ASSERT(isValid());
+    Q_ASSERT(surface);
+    auto scale = new fractional_scale_v1(parent);
+    auto wlScale = wp_fractional_scale_manager_v1_get_fractional_scale(d->manager, *surface);
+    if (d->queue) {
+        d->queue->addProxy(wlScale);
+    }
+    scale->setup(wlScale);
+    return scale;
+}
+
+fractional_scale_manager_v1::operator wp_fractional_scale_manager_v1*() const
+{
+    return d->manager;
+}
+
+fractional_scale_manager_v1::operator wp_fractional_scale_manager_v1*()
+{
+    return d->manager;
+}
+
+class Q_DECL_HIDDEN fractional_scale_v1::Private
+{
+public:
+    explicit Private(fractional_scale_v1* q);
+    void setup(wp_fractional_scale_v1* d);
+
+    WaylandPointer<wp_fractional_scale_v1, wp_fractional_scale_v1_destroy> scale;
+    double preferred_scale{1.};
+
+private:
+    static void
+    preferred_scale_callback(void* data, wp_fractional_scale_v1* wlScale, uint32_t scale);
+
+    static const struct wp_fractional_scale_v1_listener s_listener;
+
+    fractional_scale_v1* q;
+};
+
+const wp_fractional_scale_v1_listener fractional_scale_v1::Private::s_listener = {
+    preferred_scale_callback,
+};
+
+void fractional_scale_v1::Private::preferred_scale_callback(void* data,
+                                                            wp_fractional_scale_v1* /*wlScale*/,
+                                                            uint32_t scale)
+{
+    auto priv = reinterpret_cast<Private*>(data);
+    // The scale is sent as numerator with a fixed denominator of 120.
+    priv->preferred_scale = scale / 120.;
+    Q_EMIT priv->q->preferred_scale_changed();
+}
+
+fractional_scale_v1::Private::Private(fractional_scale_v1* q)
+    : q(q)
+{
+}
+
+void fractional_scale_v1::Private::setup(wp_fractional_scale_v1* d)
+{
+    Q_ASSERT(d);
+    Q_ASSERT(!scale.isValid());
+    scale.setup(d);
+    wp_fractional_scale_v1_add_listener(scale, &s_listener, this);
+}
+
+fractional_scale_v1::fractional_scale_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private(this))
+{
+}
+
+fractional_scale_v1::~fractional_scale_v1()
+{
+    release();
+}
+
+void fractional_scale_v1::release()
+{
+    d->scale.release();
+}
+
+bool fractional_scale_v1::isValid() const
+{
+    return d->scale.isValid();
+}
+
+void fractional_scale_v1::setup(wp_fractional_scale_v1* scale)
+{
+    d->setup(scale);
+}
+
+double fractional_scale_v1::preferred_scale() const
+{
+    return d->preferred_scale;
+}
+
+fractional_scale_v1::operator wp_fractional_scale_v1*()
+{
+    return d->scale;
+}
+
+fractional_scale_v1::operator wp_fractional_scale_v1*() const
+{
+    return d->scale;
+}
+
+}
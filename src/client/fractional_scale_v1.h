@@ -0,0 +1,150 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <QObject>
+#include <Wrapland/Client/wraplandclient_export.h>
+#include <memory>
+
+struct wp_fractional_scale_manager_v1;
+struct wp_fractional_scale_v1;
+
+namespace Wrapland::Client
+{
+
+class EventQueue;
+class Surface;
+class fractional_scale_v1;
+
+/**
+ * @short Wrapper for the wp_fractional_scale_manager_v1 interface.
+ *
+ * Allows to receive the preferred fractional scale of a surface from the compositor.
+ *
+ * To use this class one needs to interact with the Registry. There are two
+ * possible ways to create the fractional_scale_manager_v1 interface:
+ * @code
+ * auto m = registry->createFractionalScaleManagerV1(name, version);
+ * @endcode
+ *
+ * This creates the fractional_scale_manager_v1 and sets it up directly. As an alternative this
+ * can also be done in a more low level way:
+ * @code
+ * auto m = new fractional_scale_manager_v1;
+ * m->setup(registry->bindFractionalScaleManagerV1(name, version));
+ * @endcode
+ *
+ * @see Registry
+ **/
+class WRAPLANDCLIENT_EXPORT fractional_scale_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit fractional_scale_manager_v1(QObject* parent = nullptr);
+    ~fractional_scale_manager_v1() override;
+
+    /**
+     * @returns @c true if managing a wp_fractional_scale_manager_v1.
+     **/
+    bool isValid() const;
+    /**
+     * Setup this fractional_scale_manager_v1 to manage the @p manager.
+     * When using Registry::createFractionalScaleManagerV1 there is no need to call this
+     * method.
+     **/
+    void setup(wp_fractional_scale_manager_v1* manager);
+    /**
+     * Releases the wp_fractional_scale_manager_v1 interface.
+     * After the interface has been released the fractional_scale_manager_v1 instance is no
+     * longer valid and can be setup with another wp_fractional_scale_manager_v1 interface.
+     **/
+    void release();
+
+    /**
+     * Sets the @p queue to use for creating a fractional_scale_v1.
+     **/
+    void setEventQueue(EventQueue* queue);
+    /**
+     * @returns The event queue to use for creating a fractional_scale_v1.
+     **/
+    EventQueue* eventQueue();
+
+    /**
+     * Creates a fractional_scale_v1 for @p surface. It emits
+     * {@link fractional_scale_v1::preferred_scale_changed} whenever the compositor sends a new
+     * preferred scale.
+     **/
+    fractional_scale_v1* get_fractional_scale(Surface* surface, QObject* parent = nullptr);
+
+    operator wp_fractional_scale_manager_v1*();
+    operator wp_fractional_scale_manager_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * The corresponding global for this interface on the Registry got removed.
+     *
+     * This signal gets only emitted if the manager got created by
+     * Registry::createFractionalScaleManagerV1
+     **/
+    void removed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+/**
+ * @short Wrapper for the wp_fractional_scale_v1 interface.
+ *
+ * To create a fractional_scale_v1 call fractional_scale_manager_v1::get_fractional_scale.
+ *
+ * @see fractional_scale_manager_v1
+ **/
+class WRAPLANDCLIENT_EXPORT fractional_scale_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit fractional_scale_v1(QObject* parent = nullptr);
+    ~fractional_scale_v1() override;
+
+    /**
+     * Setup this fractional_scale_v1 to manage the @p scale.
+     * When using fractional_scale_manager_v1::get_fractional_scale there is no need to call
+     * this method.
+     **/
+    void setup(wp_fractional_scale_v1* scale);
+    /**
+     * Releases the wp_fractional_scale_v1 interface.
+     * After the interface has been released the fractional_scale_v1 instance is no
+     * longer valid and can be setup with another wp_fractional_scale_v1 interface.
+     **/
+    void release();
+    /**
+     * @returns @c true if managing a wp_fractional_scale_v1.
+     **/
+    bool isValid() const;
+
+    /**
+     * The scale most recently preferred by the compositor. Before the first event it is 1.
+     **/
+    double preferred_scale() const;
+
+    operator wp_fractional_scale_v1*();
+    operator wp_fractional_scale_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * Emitted when the compositor sent a new preferred scale.
+     * @see preferred_scale
+     **/
+    void preferred_scale_changed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}
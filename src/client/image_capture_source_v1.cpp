@@ -0,0 +1,85 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "image_capture_source_v1.h"
+
+#include "event_queue.h"
+#include "output.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-ext-image-capture-source-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN output_image_capture_source_manager_v1::Private
+{
+public:
+    WaylandPointer<ext_output_image_capture_source_manager_v1,
+                   ext_output_image_capture_source_manager_v1_destroy>
+        manager;
+    EventQueue* queue = nullptr;
+};
+
+output_image_capture_source_manager_v1::output_image_capture_source_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+output_image_capture_source_manager_v1::~output_image_capture_source_manager_v1()
+{
+    release();
+}
+
+void output_image_capture_source_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool output_image_capture_source_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void output_image_capture_source_manager_v1::setup(
+    ext_output_image_capture_source_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* output_image_capture_source_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void output_image_capture_source_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+ext_image_capture_source_v1* output_image_capture_source_manager_v1::create_source(Output* output)
+{
+    Q_ASSERT(isValid());
+    auto source = ext_output_image_capture_source_manager_v1_create_source(d->manager, *output);
+    if (d->queue) {
+        d->queue->addProxy(source);
+    }
+    return source;
+}
+
+output_image_capture_source_manager_v1::operator ext_output_image_capture_source_manager_v1*() const
+{
+    return d->manager;
+}
+
+output_image_capture_source_manager_v1::operator ext_output_image_capture_source_manager_v1*()
+{
+    return d->manager;
+}
+
+}
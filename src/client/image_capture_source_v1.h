@@ -0,0 +1,98 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <QObject>
+#include <Wrapland/Client/wraplandclient_export.h>
+#include <memory>
+
+struct ext_image_capture_source_v1;
+struct ext_output_image_capture_source_manager_v1;
+
+namespace Wrapland::Client
+{
+
+class EventQueue;
+class Output;
+
+/**
+ * @short Wrapper for the ext_output_image_capture_source_manager_v1 interface.
+ *
+ * Allows to create image capture sources for outputs.
+ *
+ * To use this class one needs to interact with the Registry. There are two
+ * possible ways to create the output_image_capture_source_manager_v1 interface:
+ * @code
+ * auto m = registry->createOutputImageCaptureSourceManagerV1(name, version);
+ * @endcode
+ *
+ * This creates the output_image_capture_source_manager_v1 and sets it up directly. As an
+ * alternative this can also be done in a more low level way:
+ * @code
+ * auto m = new output_image_capture_source_manager_v1;
+ * m->setup(registry->bindOutputImageCaptureSourceManagerV1(name, version));
+ * @endcode
+ *
+ * @see Registry
+ **/
+class WRAPLANDCLIENT_EXPORT output_image_capture_source_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit output_image_capture_source_manager_v1(QObject* parent = nullptr);
+    ~output_image_capture_source_manager_v1() override;
+
+    /**
+     * @returns @c true if managing a ext_output_image_capture_source_manager_v1.
+     **/
+    bool isValid() const;
+    /**
+     * Setup this output_image_capture_source_manager_v1 to manage the @p manager.
+     * When using Registry::createOutputImageCaptureSourceManagerV1 there is no need to call this
+     * method.
+     **/
+    void setup(ext_output_image_capture_source_manager_v1* manager);
+    /**
+     * Releases the ext_output_image_capture_source_manager_v1 interface.
+     * After the interface has been released the output_image_capture_source_manager_v1 instance is
+     * no longer valid and can be setup with another ext_output_image_capture_source_manager_v1
+     * interface.
+     **/
+    void release();
+
+    /**
+     * Sets the @p queue to use for creating objects.
+     **/
+    void setEventQueue(EventQueue* queue);
+    /**
+     * @returns The event queue to use for creating objects.
+     **/
+    EventQueue* eventQueue();
+
+    /**
+     * Creates a capture source for @p output. The caller takes ownership of it and must destroy
+     * it with ext_image_capture_source_v1_destroy.
+     **/
+    ext_image_capture_source_v1* create_source(Output* output);
+
+    operator ext_output_image_capture_source_manager_v1*();
+    operator ext_output_image_capture_source_manager_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * The corresponding global for this interface on the Registry got removed.
+     *
+     * This signal gets only emitted if the manager got created by
+     * Registry::createOutputImageCaptureSourceManagerV1
+     **/
+    void removed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}
@@ -0,0 +1,83 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "image_copy_capture_v1.h"
+
+#include "event_queue.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-ext-image-copy-capture-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN image_copy_capture_manager_v1::Private
+{
+public:
+    WaylandPointer<ext_image_copy_capture_manager_v1, ext_image_copy_capture_manager_v1_destroy>
+        manager;
+    EventQueue* queue = nullptr;
+};
+
+image_copy_capture_manager_v1::image_copy_capture_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+image_copy_capture_manager_v1::~image_copy_capture_manager_v1()
+{
+    release();
+}
+
+void image_copy_capture_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool image_copy_capture_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void image_copy_capture_manager_v1::setup(ext_image_copy_capture_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* image_copy_capture_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void image_copy_capture_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+ext_image_copy_capture_session_v1*
+image_copy_capture_manager_v1::create_session(ext_image_capture_source_v1* source, uint32_t options)
+{
+    Q_ASSERT(isValid());
+    auto session = ext_image_copy_capture_manager_v1_create_session(d->manager, source, options);
+    if (d->queue) {
+        d->queue->addProxy(session);
+    }
+    return session;
+}
+
+image_copy_capture_manager_v1::operator ext_image_copy_capture_manager_v1*() const
+{
+    return d->manager;
+}
+
+image_copy_capture_manager_v1::operator ext_image_copy_capture_manager_v1*()
+{
+    return d->manager;
+}
+
+}
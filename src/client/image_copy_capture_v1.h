@@ -0,0 +1,99 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <QObject>
+#include <Wrapland/Client/wraplandclient_export.h>
+#include <memory>
+
+struct ext_image_capture_source_v1;
+struct ext_image_copy_capture_manager_v1;
+struct ext_image_copy_capture_session_v1;
+
+namespace Wrapland::Client
+{
+
+class EventQueue;
+
+/**
+ * @short Wrapper for the ext_image_copy_capture_manager_v1 interface.
+ *
+ * Allows to capture the content of image capture sources into buffers.
+ *
+ * To use this class one needs to interact with the Registry. There are two
+ * possible ways to create the image_copy_capture_manager_v1 interface:
+ * @code
+ * auto m = registry->createImageCopyCaptureManagerV1(name, version);
+ * @endcode
+ *
+ * This creates the image_copy_capture_manager_v1 and sets it up directly. As an alternative this
+ * can also be done in a more low level way:
+ * @code
+ * auto m = new image_copy_capture_manager_v1;
+ * m->setup(registry->bindImageCopyCaptureManagerV1(name, version));
+ * @endcode
+ *
+ * @see Registry
+ **/
+class WRAPLANDCLIENT_EXPORT image_copy_capture_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit image_copy_capture_manager_v1(QObject* parent = nullptr);
+    ~image_copy_capture_manager_v1() override;
+
+    /**
+     * @returns @c true if managing a ext_image_copy_capture_manager_v1.
+     **/
+    bool isValid() const;
+    /**
+     * Setup this image_copy_capture_manager_v1 to manage the @p manager.
+     * When using Registry::createImageCopyCaptureManagerV1 there is no need to call this
+     * method.
+     **/
+    void setup(ext_image_copy_capture_manager_v1* manager);
+    /**
+     * Releases the ext_image_copy_capture_manager_v1 interface.
+     * After the interface has been released the image_copy_capture_manager_v1 instance is no
+     * longer valid and can be setup with another ext_image_copy_capture_manager_v1 interface.
+     **/
+    void release();
+
+    /**
+     * Sets the @p queue to use for creating objects.
+     **/
+    void setEventQueue(EventQueue* queue);
+    /**
+     * @returns The event queue to use for creating objects.
+     **/
+    EventQueue* eventQueue();
+
+    /**
+     * Creates a capture session for @p source with the ext_image_copy_capture_manager_v1 options
+     * @p options. The caller takes ownership of it and must destroy it with
+     * ext_image_copy_capture_session_v1_destroy.
+     **/
+    ext_image_copy_capture_session_v1* create_session(ext_image_capture_source_v1* source,
+                                                      uint32_t options);
+
+    operator ext_image_copy_capture_manager_v1*();
+    operator ext_image_copy_capture_manager_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * The corresponding global for this interface on the Registry got removed.
+     *
+     * This signal gets only emitted if the manager got created by
+     * Registry::createImageCopyCaptureManagerV1
+     **/
+    void removed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}
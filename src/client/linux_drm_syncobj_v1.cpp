@@ -0,0 +1,93 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "linux_drm_syncobj_v1.h"
+
+#include "event_queue.h"
+#include "surface.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-linux-drm-syncobj-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN linux_drm_syncobj_manager_v1::Private
+{
+public:
+    WaylandPointer<wp_linux_drm_syncobj_manager_v1, wp_linux_drm_syncobj_manager_v1_destroy>
+        manager;
+    EventQueue* queue = nullptr;
+};
+
+linux_drm_syncobj_manager_v1::linux_drm_syncobj_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+linux_drm_syncobj_manager_v1::~linux_drm_syncobj_manager_v1()
+{
+    release();
+}
+
+void linux_drm_syncobj_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool linux_drm_syncobj_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void linux_drm_syncobj_manager_v1::setup(wp_linux_drm_syncobj_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* linux_drm_syncobj_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void linux_drm_syncobj_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+wp_linux_drm_syncobj_timeline_v1* linux_drm_syncobj_manager_v1::import_timeline(int fd)
+{
+    Q_ASSERT(isValid());
+    auto timeline = wp_linux_drm_syncobj_manager_v1_import_timeline(d->manager, fd);
+    if (d->queue) {
+        d->queue->addProxy(timeline);
+    }
+    return timeline;
+}
+
+wp_linux_drm_syncobj_surface_v1* linux_drm_syncobj_manager_v1::get_surface(Surface* surface)
+{
+    Q_ASSERT(isValid());
+    auto syncobj = wp_linux_drm_syncobj_manager_v1_get_surface(d->manager, *surface);
+    if (d->queue) {
+        d->queue->addProxy(syncobj);
+    }
+    return syncobj;
+}
+
+linux_drm_syncobj_manager_v1::operator wp_linux_drm_syncobj_manager_v1*() const
+{
+    return d->manager;
+}
+
+linux_drm_syncobj_manager_v1::operator wp_linux_drm_syncobj_manager_v1*()
+{
+    return d->manager;
+}
+
+}
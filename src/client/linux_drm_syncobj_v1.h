@@ -0,0 +1,105 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <QObject>
+#include <Wrapland/Client/wraplandclient_export.h>
+#include <memory>
+
+struct wp_linux_drm_syncobj_manager_v1;
+struct wp_linux_drm_syncobj_surface_v1;
+struct wp_linux_drm_syncobj_timeline_v1;
+
+namespace Wrapland::Client
+{
+
+class EventQueue;
+class Surface;
+
+/**
+ * @short Wrapper for the wp_linux_drm_syncobj_manager_v1 interface.
+ *
+ * Allows to explicitly synchronize buffer access with the compositor through DRM syncobj
+ * timelines instead of relying on implicit dmabuf fences.
+ *
+ * To use this class one needs to interact with the Registry. There are two
+ * possible ways to create the linux_drm_syncobj_manager_v1 interface:
+ * @code
+ * auto m = registry->createLinuxDrmSyncobjManagerV1(name, version);
+ * @endcode
+ *
+ * This creates the linux_drm_syncobj_manager_v1 and sets it up directly. As an alternative this
+ * can also be done in a more low level way:
+ * @code
+ * auto m = new linux_drm_syncobj_manager_v1;
+ * m->setup(registry->bindLinuxDrmSyncobjManagerV1(name, version));
+ * @endcode
+ *
+ * @see Registry
+ **/
+class WRAPLANDCLIENT_EXPORT linux_drm_syncobj_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit linux_drm_syncobj_manager_v1(QObject* parent = nullptr);
+    ~linux_drm_syncobj_manager_v1() override;
+
+    /**
+     * @returns @c true if managing a wp_linux_drm_syncobj_manager_v1.
+     **/
+    bool isValid() const;
+    /**
+     * Setup this linux_drm_syncobj_manager_v1 to manage the @p manager.
+     * When using Registry::createLinuxDrmSyncobjManagerV1 there is no need to call this
+     * method.
+     **/
+    void setup(wp_linux_drm_syncobj_manager_v1* manager);
+    /**
+     * Releases the wp_linux_drm_syncobj_manager_v1 interface.
+     * After the interface has been released the linux_drm_syncobj_manager_v1 instance is no
+     * longer valid and can be setup with another wp_linux_drm_syncobj_manager_v1 interface.
+     **/
+    void release();
+
+    /**
+     * Sets the @p queue to use for creating objects.
+     **/
+    void setEventQueue(EventQueue* queue);
+    /**
+     * @returns The event queue to use for creating objects.
+     **/
+    EventQueue* eventQueue();
+
+    /**
+     * Imports the DRM syncobj timeline @p fd. The caller keeps ownership of @p fd and takes
+     * ownership of the returned timeline, which must be destroyed with
+     * wp_linux_drm_syncobj_timeline_v1_destroy.
+     **/
+    wp_linux_drm_syncobj_timeline_v1* import_timeline(int fd);
+    /**
+     * Creates the synchronization object for @p surface. The caller takes ownership of it and
+     * must destroy it with wp_linux_drm_syncobj_surface_v1_destroy.
+     **/
+    wp_linux_drm_syncobj_surface_v1* get_surface(Surface* surface);
+
+    operator wp_linux_drm_syncobj_manager_v1*();
+    operator wp_linux_drm_syncobj_manager_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * The corresponding global for this interface on the Registry got removed.
+     *
+     * This signal gets only emitted if the manager got created by
+     * Registry::createLinuxDrmSyncobjManagerV1
+     **/
+    void removed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}
@@ -0,0 +1,86 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "plasma_stacking_order_v1.h"
+
+#include "event_queue.h"
+#include "plasmawindowmanagement.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-wrapland-plasma-stacking-order-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN plasma_stacking_order_manager_v1::Private
+{
+public:
+    WaylandPointer<wrapland_plasma_stacking_order_manager_v1,
+                   wrapland_plasma_stacking_order_manager_v1_destroy>
+        manager;
+    EventQueue* queue = nullptr;
+};
+
+plasma_stacking_order_manager_v1::plasma_stacking_order_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+plasma_stacking_order_manager_v1::~plasma_stacking_order_manager_v1()
+{
+    release();
+}
+
+void plasma_stacking_order_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool plasma_stacking_order_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void plasma_stacking_order_manager_v1::setup(wrapland_plasma_stacking_order_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* plasma_stacking_order_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void plasma_stacking_order_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+wrapland_plasma_stacking_order_v1*
+plasma_stacking_order_manager_v1::get_stacking_order(PlasmaWindowManagement* wm)
+{
+    Q_ASSERT(isValid());
+    auto stacking_order
+        = wrapland_plasma_stacking_order_manager_v1_get_stacking_order(d->manager, *wm);
+    if (d->queue) {
+        d->queue->addProxy(stacking_order);
+    }
+    return stacking_order;
+}
+
+plasma_stacking_order_manager_v1::operator wrapland_plasma_stacking_order_manager_v1*() const
+{
+    return d->manager;
+}
+
+plasma_stacking_order_manager_v1::operator wrapland_plasma_stacking_order_manager_v1*()
+{
+    return d->manager;
+}
+
+}
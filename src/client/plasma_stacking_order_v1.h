@@ -0,0 +1,99 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <QObject>
+#include <Wrapland/Client/wraplandclient_export.h>
+#include <memory>
+
+struct wrapland_plasma_stacking_order_manager_v1;
+struct wrapland_plasma_stacking_order_v1;
+
+namespace Wrapland::Client
+{
+
+class EventQueue;
+class PlasmaWindowManagement;
+
+/**
+ * @short Wrapper for the wrapland_plasma_stacking_order_manager_v1 interface.
+ *
+ * Allows a PlasmaWindowManagement to receive changes of the stacking order instead of the
+ * complete stack on every change. Pass it to PlasmaWindowManagement::set_stacking_order_manager.
+ *
+ * To use this class one needs to interact with the Registry. There are two
+ * possible ways to create the plasma_stacking_order_manager_v1 interface:
+ * @code
+ * auto m = registry->createPlasmaStackingOrderManagerV1(name, version);
+ * @endcode
+ *
+ * This creates the plasma_stacking_order_manager_v1 and sets it up directly. As an alternative
+ * this can also be done in a more low level way:
+ * @code
+ * auto m = new plasma_stacking_order_manager_v1;
+ * m->setup(registry->bindPlasmaStackingOrderManagerV1(name, version));
+ * @endcode
+ *
+ * @see Registry
+ **/
+class WRAPLANDCLIENT_EXPORT plasma_stacking_order_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit plasma_stacking_order_manager_v1(QObject* parent = nullptr);
+    ~plasma_stacking_order_manager_v1() override;
+
+    /**
+     * @returns @c true if managing a wrapland_plasma_stacking_order_manager_v1.
+     **/
+    bool isValid() const;
+    /**
+     * Setup this plasma_stacking_order_manager_v1 to manage the @p manager.
+     * When using Registry::createPlasmaStackingOrderManagerV1 there is no need to call this
+     * method.
+     **/
+    void setup(wrapland_plasma_stacking_order_manager_v1* manager);
+    /**
+     * Releases the wrapland_plasma_stacking_order_manager_v1 interface.
+     * After the interface has been released the plasma_stacking_order_manager_v1 instance is no
+     * longer valid and can be setup with another wrapland_plasma_stacking_order_manager_v1
+     * interface.
+     **/
+    void release();
+
+    /**
+     * Sets the @p queue to use for creating objects.
+     **/
+    void setEventQueue(EventQueue* queue);
+    /**
+     * @returns The event queue to use for creating objects.
+     **/
+    EventQueue* eventQueue();
+
+    /**
+     * Creates the stacking order object for @p wm. The caller takes ownership of it.
+     * PlasmaWindowManagement::set_stacking_order_manager does this already.
+     **/
+    wrapland_plasma_stacking_order_v1* get_stacking_order(PlasmaWindowManagement* wm);
+
+    operator wrapland_plasma_stacking_order_manager_v1*();
+    operator wrapland_plasma_stacking_order_manager_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * The corresponding global for this interface on the Registry got removed.
+     *
+     * This signal gets only emitted if the manager got created by
+     * Registry::createPlasmaStackingOrderManagerV1
+     **/
+    void removed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}
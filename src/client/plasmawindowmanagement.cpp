@@ -21,6 +21,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "plasmawindowmanagement.h"
 #include "event_queue.h"
 #include "output.h"
+#include "plasma_stacking_order_v1.h"
 #include "plasmavirtualdesktop.h"
 #include "plasmawindowmodel.h"
 #include "surface.h"
@@ -28,12 +29,15 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 // Wayland
 #include <wayland-plasma-window-management-client-protocol.h>
 #include <wayland-util.h>
+#include <wayland-wrapland-plasma-stacking-order-v1-client-protocol.h>
 
-#include <QFutureWatcher>
+#include <QCache>
+#include <QCryptographicHash>
+#include <QSocketNotifier>
 #include <QTimer>
-#include <QtConcurrentRun>
 #include <qplatformdefs.h>
 
+#include <algorithm>
 #include <cerrno>
 
 namespace Wrapland::Client
@@ -44,6 +48,8 @@ class Q_DECL_HIDDEN PlasmaWindowManagement::Private
 public:
     explicit Private(PlasmaWindowManagement* q);
     WaylandPointer<org_kde_plasma_window_management, org_kde_plasma_window_management_destroy> wm;
+    WaylandPointer<wrapland_plasma_stacking_order_v1, wrapland_plasma_stacking_order_v1_destroy>
+        uuid_stack;
     EventQueue* queue = nullptr;
     bool showingDesktop = false;
     QList<PlasmaWindow*> windows;
@@ -51,7 +57,12 @@ public:
     std::vector<uint32_t> stacking_order;
     PlasmaWindow* activeWindow = nullptr;
 
+    // Decoded icons by hash of their serialized data. Windows of the same application often share
+    // an icon that then only has to be decoded once.
+    QCache<QByteArray, QIcon> icons{s_icon_cache_size};
+
     void setup(org_kde_plasma_window_management* proxy);
+    void setup_uuid_stack(wrapland_plasma_stacking_order_v1* proxy);
     PlasmaWindow*
     windowCreated(org_kde_plasma_window* id, quint32 internalId, std::string const& uuid);
 
@@ -70,11 +81,27 @@ private:
                                           uint32_t id,
                                           char const* uuid);
 
+    static void uuid_stack_reset_callback(void* data, wrapland_plasma_stacking_order_v1* proxy);
+    static void uuid_stack_removed_callback(void* data,
+                                            wrapland_plasma_stacking_order_v1* proxy,
+                                            char const* uuid);
+    static void uuid_stack_inserted_callback(void* data,
+                                             wrapland_plasma_stacking_order_v1* proxy,
+                                             char const* uuid,
+                                             uint32_t position);
+    static void
+    uuid_stack_done_callback(void* data, wrapland_plasma_stacking_order_v1* proxy, uint32_t serial);
+
     void setShowDesktop(bool set);
     void set_stacking_order(std::vector<uint32_t> const& stack);
     void set_stacking_order_uuids(std::vector<std::string> const& stack);
 
     org_kde_plasma_window_management_listener static const s_listener;
+    wrapland_plasma_stacking_order_v1_listener static const s_uuid_stack_listener;
+    static int constexpr s_icon_cache_size{64};
+
+    // Stack the changes of the stacking order object are applied to until done.
+    std::vector<std::string> pending_uuid_stack;
     PlasmaWindowManagement* q;
 };
 
@@ -82,6 +109,7 @@ class Q_DECL_HIDDEN PlasmaWindow::Private
 {
 public:
     Private(org_kde_plasma_window* window, quint32 internalId, std::string uuid, PlasmaWindow* q);
+    ~Private();
     WaylandPointer<org_kde_plasma_window, org_kde_plasma_window_destroy> window;
     quint32 internalId;
     std::string uuid;
@@ -109,6 +137,14 @@ public:
     bool resizable = false;
     bool virtualDesktopChangeable = false;
     QIcon icon;
+
+    // Icon data currently being read from the compositor.
+    struct {
+        int fd{-1};
+        QSocketNotifier* notifier{nullptr};
+        QByteArray data;
+    } icon_transfer;
+
     PlasmaWindowManagement* wm = nullptr;
     bool unmapped = false;
     QPointer<PlasmaWindow> parentWindow;
@@ -122,6 +158,11 @@ public:
     } application_menu;
 
 private:
+    void fetch_icon();
+    void read_icon();
+    void end_icon_transfer();
+    void set_icon(QByteArray const& data);
+
     static void titleChangedCallback(void* data, org_kde_plasma_window* window, char const* title);
     static void appIdChangedCallback(void* data, org_kde_plasma_window* window, char const* app_id);
     static void pidChangedCallback(void* data, org_kde_plasma_window* window, uint32_t pid);
@@ -202,6 +243,15 @@ org_kde_plasma_window_management_listener const PlasmaWindowManagement::Private:
     window_with_uuid_callback,
 };
 
+wrapland_plasma_stacking_order_v1_listener const
+    PlasmaWindowManagement::Private::s_uuid_stack_listener
+    = {
+        uuid_stack_reset_callback,
+        uuid_stack_removed_callback,
+        uuid_stack_inserted_callback,
+        uuid_stack_done_callback,
+};
+
 void PlasmaWindowManagement::Private::setup(org_kde_plasma_window_management* proxy)
 {
     Q_ASSERT(!wm);
@@ -210,6 +260,15 @@ void PlasmaWindowManagement::Private::setup(org_kde_plasma_window_management* pr
     org_kde_plasma_window_management_add_listener(proxy, &s_listener, this);
 }
 
+void PlasmaWindowManagement::Private::setup_uuid_stack(wrapland_plasma_stacking_order_v1* proxy)
+{
+    Q_ASSERT(!uuid_stack);
+    Q_ASSERT(proxy);
+    uuid_stack.setup(proxy);
+    pending_uuid_stack = stacking_order_uuid;
+    wrapland_plasma_stacking_order_v1_add_listener(proxy, &s_uuid_stack_listener, this);
+}
+
 void PlasmaWindowManagement::Private::showDesktopCallback(void* data,
                                                           org_kde_plasma_window_management* proxy,
                                                           uint32_t state)
@@ -312,6 +371,55 @@ void PlasmaWindowManagement::Private::set_stacking_order_uuids(
     Q_EMIT q->stacking_order_uuid_changed();
 }
 
+void PlasmaWindowManagement::Private::uuid_stack_reset_callback(
+    void* data,
+    wrapland_plasma_stacking_order_v1* proxy)
+{
+    auto wm = reinterpret_cast<PlasmaWindowManagement::Private*>(data);
+    Q_ASSERT(wm->uuid_stack == proxy);
+
+    wm->pending_uuid_stack.clear();
+}
+
+void PlasmaWindowManagement::Private::uuid_stack_removed_callback(
+    void* data,
+    wrapland_plasma_stacking_order_v1* proxy,
+    char const* uuid)
+{
+    auto wm = reinterpret_cast<PlasmaWindowManagement::Private*>(data);
+    Q_ASSERT(wm->uuid_stack == proxy);
+
+    auto& stack = wm->pending_uuid_stack;
+    if (auto it = std::find(stack.begin(), stack.end(), uuid); it != stack.end()) {
+        stack.erase(it);
+    }
+}
+
+void PlasmaWindowManagement::Private::uuid_stack_inserted_callback(
+    void* data,
+    wrapland_plasma_stacking_order_v1* proxy,
+    char const* uuid,
+    uint32_t position)
+{
+    auto wm = reinterpret_cast<PlasmaWindowManagement::Private*>(data);
+    Q_ASSERT(wm->uuid_stack == proxy);
+
+    auto& stack = wm->pending_uuid_stack;
+    auto const index = std::min(static_cast<size_t>(position), stack.size());
+    stack.insert(stack.begin() + static_cast<std::ptrdiff_t>(index), uuid);
+}
+
+void PlasmaWindowManagement::Private::uuid_stack_done_callback(
+    void* data,
+    wrapland_plasma_stacking_order_v1* proxy,
+    [[maybe_unused]] uint32_t serial)
+{
+    auto wm = reinterpret_cast<PlasmaWindowManagement::Private*>(data);
+    Q_ASSERT(wm->uuid_stack == proxy);
+
+    wm->set_stacking_order_uuids(wm->pending_uuid_stack);
+}
+
 void PlasmaWindowManagement::Private::window_with_uuid_callback(
     void* data,
     org_kde_plasma_window_management* proxy,
@@ -385,6 +493,7 @@ void PlasmaWindowManagement::release()
         return;
     }
     Q_EMIT interfaceAboutToBeReleased();
+    d->uuid_stack.release();
     d->wm.release();
 }
 
@@ -462,6 +571,13 @@ std::vector<std::string> const& PlasmaWindowManagement::stacking_order_uuid() co
     return d->stacking_order_uuid;
 }
 
+void PlasmaWindowManagement::set_stacking_order_manager(plasma_stacking_order_manager_v1* manager)
+{
+    Q_ASSERT(isValid());
+    Q_ASSERT(manager);
+    d->setup_uuid_stack(manager->get_stacking_order(this));
+}
+
 PlasmaWindow* PlasmaWindowManagement::activeWindow() const
 {
     return d->activeWindow;
@@ -718,62 +834,94 @@ void PlasmaWindow::Private::resource_name_changed_callback(void* data,
     Q_EMIT priv->q->resource_name_changed();
 }
 
-static int readData(int fd, QByteArray& data)
-{
-    // implementation based on QtWayland file qwaylanddataoffer.cpp
-    char buf[4096];
-    int retryCount = 0;
-    int n;
-    while (true) {
-        n = QT_READ(fd, buf, sizeof buf);
-        if (n == -1 && (errno == EAGAIN) && ++retryCount < 1000) {
-            usleep(1000);
-        } else {
-            break;
-        }
-    }
-    if (n > 0) {
-        data.append(buf, n);
-        n = readData(fd, data);
-    }
-    return n;
-}
-
 void PlasmaWindow::Private::iconChangedCallback(void* data, org_kde_plasma_window* window)
 {
     auto p = cast(data);
     Q_UNUSED(window);
+    p->fetch_icon();
+}
+
+void PlasmaWindow::Private::fetch_icon()
+{
+    // A new icon replaces the one that might still be in transfer.
+    end_icon_transfer();
+
     int pipeFds[2];
     if (pipe2(pipeFds, O_CLOEXEC | O_NONBLOCK) != 0) {
         return;
     }
-    org_kde_plasma_window_get_icon(p->window, pipeFds[1]);
+    org_kde_plasma_window_get_icon(window, pipeFds[1]);
     close(pipeFds[1]);
-    int const pipeFd = pipeFds[0];
-    auto readIcon = [pipeFd]() -> QIcon {
-        QByteArray content;
-        if (readData(pipeFd, content) != 0) {
-            close(pipeFd);
-            return {};
+
+    // The data is read on the event loop whenever the compositor has written some of it. That way
+    // fetching the icons of many windows does not block any threads.
+    icon_transfer.fd = pipeFds[0];
+    icon_transfer.notifier = new QSocketNotifier(icon_transfer.fd, QSocketNotifier::Read, q);
+    QObject::connect(icon_transfer.notifier, &QSocketNotifier::activated, q, [this] {
+        read_icon();
+    });
+}
+
+void PlasmaWindow::Private::read_icon()
+{
+    char buf[4096];
+
+    while (true) {
+        auto const n = QT_READ(icon_transfer.fd, buf, sizeof buf);
+        if (n > 0) {
+            icon_transfer.data.append(buf, static_cast<int>(n));
+            continue;
         }
-        close(pipeFd);
-        QDataStream ds(content);
-        QIcon icon;
-        ds >> icon;
-        return icon;
-    };
-    auto watcher = new QFutureWatcher<QIcon>(p->q);
-    QObject::connect(watcher, &QFutureWatcher<QIcon>::finished, p->q, [p, watcher] {
-        watcher->deleteLater();
-        QIcon icon = watcher->result();
-        if (!icon.isNull()) {
-            p->icon = icon;
+        if (n == -1 && (errno == EAGAIN || errno == EINTR)) {
+            // Wait for more data.
+            return;
+        }
+
+        // On end of file the icon is complete. Otherwise reading failed.
+        auto const data = n == 0 ? icon_transfer.data : QByteArray();
+        end_icon_transfer();
+        set_icon(data);
+        return;
+    }
+}
+
+void PlasmaWindow::Private::end_icon_transfer()
+{
+    if (icon_transfer.fd == -1) {
+        return;
+    }
+
+    // The notifier might be the sender of the current signal.
+    icon_transfer.notifier->setEnabled(false);
+    icon_transfer.notifier->deleteLater();
+    icon_transfer.notifier = nullptr;
+
+    close(icon_transfer.fd);
+    icon_transfer.fd = -1;
+    icon_transfer.data.clear();
+}
+
+void PlasmaWindow::Private::set_icon(QByteArray const& data)
+{
+    auto& cache = wm->d->icons;
+    auto const hash = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+
+    if (auto cached = cache.object(hash)) {
+        icon = *cached;
+    } else {
+        QDataStream ds(data);
+        QIcon decoded;
+        ds >> decoded;
+
+        if (!decoded.isNull()) {
+            cache.insert(hash, new QIcon(decoded));
+            icon = decoded;
         } else {
-            p->icon = QIcon::fromTheme(QStringLiteral("wayland"));
+            icon = QIcon::fromTheme(QStringLiteral("wayland"));
         }
-        Q_EMIT p->q->iconChanged();
-    });
-    watcher->setFuture(QtConcurrent::run(readIcon));
+    }
+
+    Q_EMIT q->iconChanged();
 }
 
 void PlasmaWindow::Private::setActive(bool set)
@@ -959,6 +1107,11 @@ PlasmaWindow::Private::Private(org_kde_plasma_window* w,
     org_kde_plasma_window_add_listener(w, &s_listener, this);
 }
 
+PlasmaWindow::Private::~Private()
+{
+    end_icon_transfer();
+}
+
 PlasmaWindow::PlasmaWindow(PlasmaWindowManagement* parent,
                            org_kde_plasma_window* window,
                            quint32 internalId,
@@ -42,6 +42,7 @@ class PlasmaWindow;
 class PlasmaWindowModel;
 class Surface;
 class PlasmaVirtualDesktop;
+class plasma_stacking_order_manager_v1;
 
 /**
  * @short Wrapper for the org_kde_plasma_window_management interface.
@@ -161,6 +162,14 @@ public:
      **/
     std::vector<std::string> const& stacking_order_uuid() const;
 
+    /**
+     * Receives changes of the stacking order through @p manager instead of the complete stack on
+     * every change. Without it or with an older compositor the complete stack is received.
+     * Must be called at most once after setup.
+     * @see stacking_order_uuid
+     **/
+    void set_stacking_order_manager(plasma_stacking_order_manager_v1* manager);
+
     /**
      * @returns The currently active PlasmaWindow, the PlasmaWindow which
      * returns @c true in {@link PlasmaWindow::isActive} or @c nullptr in case
@@ -224,6 +233,7 @@ Q_SIGNALS:
     void removed();
 
 private:
+    friend class PlasmaWindow;
     class Private;
     std::unique_ptr<Private> d;
 };
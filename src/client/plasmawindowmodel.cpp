@@ -22,6 +22,8 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <QMetaEnum>
 
+#include <utility>
+
 namespace Wrapland
 {
 namespace Client
@@ -35,10 +37,22 @@ public:
     PlasmaWindow* window = nullptr;
 
     void addWindow(PlasmaWindow* window);
+    void removeWindow(PlasmaWindow* window);
+    void clear();
     void dataChanged(PlasmaWindow* window, int role);
 
 private:
+    void flushDataChanged();
+
     PlasmaWindowModel* q;
+
+    // Row of each window in the windows list.
+    QHash<PlasmaWindow*, int> rows;
+
+    // Roles changed per window since the last dataChanged signal. Changes are collected until
+    // control returns to the event loop so a burst of events results in a single signal.
+    QHash<PlasmaWindow*, QVector<int>> changedRoles;
+    bool flushScheduled = false;
 };
 
 PlasmaWindowModel::Private::Private(PlasmaWindowModel* q)
@@ -48,23 +62,17 @@ PlasmaWindowModel::Private::Private(PlasmaWindowModel* q)
 
 void PlasmaWindowModel::Private::addWindow(PlasmaWindow* window)
 {
-    if (windows.indexOf(window) != -1) {
+    if (rows.contains(window)) {
         return;
     }
 
     int const count = windows.count();
     q->beginInsertRows(QModelIndex(), count, count);
     windows.append(window);
+    rows.insert(window, count);
     q->endInsertRows();
 
-    auto removeWindow = [window, this] {
-        const int row = windows.indexOf(window);
-        if (row != -1) {
-            q->beginRemoveRows(QModelIndex(), row, row);
-            windows.removeAt(row);
-            q->endRemoveRows();
-        }
-    };
+    auto removeWindow = [window, this] { this->removeWindow(window); };
 
     QObject::connect(window, &PlasmaWindow::unmapped, q, removeWindow);
     QObject::connect(window, &QObject::destroyed, q, removeWindow);
@@ -170,10 +178,59 @@ void PlasmaWindowModel::Private::addWindow(PlasmaWindow* window)
     });
 }
 
+void PlasmaWindowModel::Private::removeWindow(PlasmaWindow* window)
+{
+    auto it = rows.constFind(window);
+    if (it == rows.constEnd()) {
+        return;
+    }
+
+    int const row = it.value();
+    q->beginRemoveRows(QModelIndex(), row, row);
+    windows.removeAt(row);
+    rows.erase(it);
+    changedRoles.remove(window);
+
+    for (int i = row; i < windows.count(); ++i) {
+        rows[windows.at(i)] = i;
+    }
+    q->endRemoveRows();
+}
+
+void PlasmaWindowModel::Private::clear()
+{
+    windows.clear();
+    rows.clear();
+    changedRoles.clear();
+}
+
 void PlasmaWindowModel::Private::dataChanged(PlasmaWindow* window, int role)
 {
-    QModelIndex idx = q->index(windows.indexOf(window));
-    Q_EMIT q->dataChanged(idx, idx, QVector<int>() << role);
+    auto& roles = changedRoles[window];
+    if (!roles.contains(role)) {
+        roles.append(role);
+    }
+
+    if (flushScheduled) {
+        return;
+    }
+    flushScheduled = true;
+    QMetaObject::invokeMethod(q, [this] { flushDataChanged(); }, Qt::QueuedConnection);
+}
+
+void PlasmaWindowModel::Private::flushDataChanged()
+{
+    flushScheduled = false;
+
+    auto const changes = std::exchange(changedRoles, {});
+    for (auto it = changes.constBegin(); it != changes.constEnd(); ++it) {
+        auto row = rows.constFind(it.key());
+        if (row == rows.constEnd()) {
+            continue;
+        }
+        QModelIndex idx = q->index(row.value());
+        Q_EMIT q->dataChanged(idx, idx, it.value());
+    }
 }
 
 PlasmaWindowModel::PlasmaWindowModel(PlasmaWindowManagement* parent)
@@ -182,7 +239,7 @@ PlasmaWindowModel::PlasmaWindowModel(PlasmaWindowManagement* parent)
 {
     connect(parent, &PlasmaWindowManagement::interfaceAboutToBeReleased, this, [this] {
         beginResetModel();
-        d->windows.clear();
+        d->clear();
         endResetModel();
     });
 
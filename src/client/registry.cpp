@@ -21,27 +21,36 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "registry.h"
 #include "appmenu.h"
 #include "blur.h"
+#include "commit_timing_v1.h"
 #include "compositor.h"
 #include "connection_thread.h"
+#include "content_type_v1.h"
 #include "contrast.h"
+#include "cursor_shape_v1.h"
 #include "data_control_v1.h"
 #include "datadevicemanager.h"
 #include "dpms.h"
 #include "drm_lease_v1_p.h"
 #include "event_queue.h"
 #include "fakeinput.h"
+#include "fifo_v1.h"
+#include "fractional_scale_v1.h"
 #include "fullscreen_shell.h"
 #include "idle.h"
 #include "idle_notify_v1.h"
 #include "idleinhibit.h"
+#include "image_capture_source_v1.h"
+#include "image_copy_capture_v1.h"
 #include "input_method_v2.h"
 #include "keyboard_shortcuts_inhibit.h"
 #include "keystate.h"
 #include "layer_shell_v1.h"
 #include "linux_dmabuf_v1.h"
+#include "linux_drm_syncobj_v1.h"
 #include "logging.h"
 #include "output.h"
 #include "plasma_activation_feedback.h"
+#include "plasma_stacking_order_v1.h"
 #include "plasmashell.h"
 #include "plasmavirtualdesktop.h"
 #include "plasmawindowmanagement.h"
@@ -56,8 +65,10 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include "shadow.h"
 #include "shell.h"
 #include "shm_pool.h"
+#include "single_pixel_buffer_v1.h"
 #include "slide.h"
 #include "subcompositor.h"
+#include "tearing_control_v1.h"
 #include "text_input_v2_p.h"
 #include "text_input_v3_p.h"
 #include "viewporter.h"
@@ -75,11 +86,18 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include <wayland-appmenu-client-protocol.h>
 #include <wayland-blur-client-protocol.h>
 #include <wayland-client-protocol.h>
+#include <wayland-commit-timing-v1-client-protocol.h>
+#include <wayland-content-type-v1-client-protocol.h>
 #include <wayland-contrast-client-protocol.h>
+#include <wayland-cursor-shape-v1-client-protocol.h>
 #include <wayland-dpms-client-protocol.h>
 #include <wayland-drm-lease-v1-client-protocol.h>
 #include <wayland-ext-idle-notify-v1-client-protocol.h>
+#include <wayland-ext-image-capture-source-v1-client-protocol.h>
+#include <wayland-ext-image-copy-capture-v1-client-protocol.h>
 #include <wayland-fake-input-client-protocol.h>
+#include <wayland-fifo-v1-client-protocol.h>
+#include <wayland-fractional-scale-v1-client-protocol.h>
 #include <wayland-fullscreen-shell-client-protocol.h>
 #include <wayland-idle-client-protocol.h>
 #include <wayland-idle-inhibit-unstable-v1-client-protocol.h>
@@ -87,6 +105,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include <wayland-keyboard-shortcuts-inhibit-client-protocol.h>
 #include <wayland-keystate-client-protocol.h>
 #include <wayland-linux-dmabuf-unstable-v1-client-protocol.h>
+#include <wayland-linux-drm-syncobj-v1-client-protocol.h>
 #include <wayland-plasma-shell-client-protocol.h>
 #include <wayland-plasma-virtual-desktop-client-protocol.h>
 #include <wayland-plasma-window-management-client-protocol.h>
@@ -98,7 +117,9 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include <wayland-security-context-v1-client-protocol.h>
 #include <wayland-server-decoration-palette-client-protocol.h>
 #include <wayland-shadow-client-protocol.h>
+#include <wayland-single-pixel-buffer-v1-client-protocol.h>
 #include <wayland-slide-client-protocol.h>
+#include <wayland-tearing-control-v1-client-protocol.h>
 #include <wayland-text-input-v2-client-protocol.h>
 #include <wayland-text-input-v3-client-protocol.h>
 #include <wayland-viewporter-client-protocol.h>
@@ -106,6 +127,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #include <wayland-wlr-data-control-v1-client-protocol.h>
 #include <wayland-wlr-layer-shell-client-protocol.h>
 #include <wayland-wlr-output-management-v1-client-protocol.h>
+#include <wayland-wrapland-plasma-stacking-order-v1-client-protocol.h>
 #include <wayland-xdg-activation-v1-client-protocol.h>
 #include <wayland-xdg-decoration-unstable-v1-client-protocol.h>
 #include <wayland-xdg-foreign-unstable-v2-client-protocol.h>
@@ -144,7 +166,7 @@ static QMap<Registry::Interface, SuppertedInterfaceData> const s_interfaces = {
     {
         Registry::Interface::Compositor,
         {
-            4,
+            6,
             QByteArrayLiteral("wl_compositor"),
             &wl_compositor_interface,
             &Registry::compositorAnnounced,
@@ -229,6 +251,106 @@ static QMap<Registry::Interface, SuppertedInterfaceData> const s_interfaces = {
             &Registry::securityContextManagerV1Removed,
         },
     },
+    {
+        Registry::Interface::ImageCopyCaptureManagerV1,
+        {
+            1,
+            QByteArrayLiteral("ext_image_copy_capture_manager_v1"),
+            &ext_image_copy_capture_manager_v1_interface,
+            &Registry::imageCopyCaptureManagerV1Announced,
+            &Registry::imageCopyCaptureManagerV1Removed,
+        },
+    },
+    {
+        Registry::Interface::OutputImageCaptureSourceManagerV1,
+        {
+            1,
+            QByteArrayLiteral("ext_output_image_capture_source_manager_v1"),
+            &ext_output_image_capture_source_manager_v1_interface,
+            &Registry::outputImageCaptureSourceManagerV1Announced,
+            &Registry::outputImageCaptureSourceManagerV1Removed,
+        },
+    },
+    {
+        Registry::Interface::CursorShapeManagerV1,
+        {
+            1,
+            QByteArrayLiteral("wp_cursor_shape_manager_v1"),
+            &wp_cursor_shape_manager_v1_interface,
+            &Registry::cursorShapeManagerV1Announced,
+            &Registry::cursorShapeManagerV1Removed,
+        },
+    },
+    {
+        Registry::Interface::ContentTypeManagerV1,
+        {
+            1,
+            QByteArrayLiteral("wp_content_type_manager_v1"),
+            &wp_content_type_manager_v1_interface,
+            &Registry::contentTypeManagerV1Announced,
+            &Registry::contentTypeManagerV1Removed,
+        },
+    },
+    {
+        Registry::Interface::CommitTimingManagerV1,
+        {
+            1,
+            QByteArrayLiteral("wp_commit_timing_manager_v1"),
+            &wp_commit_timing_manager_v1_interface,
+            &Registry::commitTimingManagerV1Announced,
+            &Registry::commitTimingManagerV1Removed,
+        },
+    },
+    {
+        Registry::Interface::FifoManagerV1,
+        {
+            1,
+            QByteArrayLiteral("wp_fifo_manager_v1"),
+            &wp_fifo_manager_v1_interface,
+            &Registry::fifoManagerV1Announced,
+            &Registry::fifoManagerV1Removed,
+        },
+    },
+    {
+        Registry::Interface::FractionalScaleManagerV1,
+        {
+            1,
+            QByteArrayLiteral("wp_fractional_scale_manager_v1"),
+            &wp_fractional_scale_manager_v1_interface,
+            &Registry::fractionalScaleManagerV1Announced,
+            &Registry::fractionalScaleManagerV1Removed,
+        },
+    },
+    {
+        Registry::Interface::TearingControlManagerV1,
+        {
+            1,
+            QByteArrayLiteral("wp_tearing_control_manager_v1"),
+            &wp_tearing_control_manager_v1_interface,
+            &Registry::tearingControlManagerV1Announced,
+            &Registry::tearingControlManagerV1Removed,
+        },
+    },
+    {
+        Registry::Interface::LinuxDrmSyncobjManagerV1,
+        {
+            1,
+            QByteArrayLiteral("wp_linux_drm_syncobj_manager_v1"),
+            &wp_linux_drm_syncobj_manager_v1_interface,
+            &Registry::linuxDrmSyncobjManagerV1Announced,
+            &Registry::linuxDrmSyncobjManagerV1Removed,
+        },
+    },
+    {
+        Registry::Interface::SinglePixelBufferManagerV1,
+        {
+            1,
+            QByteArrayLiteral("wp_single_pixel_buffer_manager_v1"),
+            &wp_single_pixel_buffer_manager_v1_interface,
+            &Registry::singlePixelBufferManagerV1Announced,
+            &Registry::singlePixelBufferManagerV1Removed,
+        },
+    },
     {
         Registry::Interface::Shell,
         {
@@ -289,6 +411,16 @@ static QMap<Registry::Interface, SuppertedInterfaceData> const s_interfaces = {
             &Registry::plasmaWindowManagementRemoved,
         },
     },
+    {
+        Registry::Interface::PlasmaStackingOrderManagerV1,
+        {
+            1,
+            QByteArrayLiteral("wrapland_plasma_stacking_order_manager_v1"),
+            &wrapland_plasma_stacking_order_manager_v1_interface,
+            &Registry::plasmaStackingOrderManagerV1Announced,
+            &Registry::plasmaStackingOrderManagerV1Removed,
+        },
+    },
     {
         Registry::Interface::Idle,
         {
@@ -907,6 +1039,7 @@ BIND(PlasmaActivationFeedback, org_kde_plasma_activation_feedback)
 BIND(PlasmaShell, org_kde_plasma_shell)
 BIND(PlasmaVirtualDesktopManagement, org_kde_plasma_virtual_desktop_management)
 BIND(PlasmaWindowManagement, org_kde_plasma_window_management)
+BIND(PlasmaStackingOrderManagerV1, wrapland_plasma_stacking_order_manager_v1)
 BIND(Idle, org_kde_kwin_idle)
 BIND(IdleNotifierV1, ext_idle_notifier_v1)
 BIND(InputMethodManagerV2, zwp_input_method_manager_v2)
@@ -924,6 +1057,16 @@ BIND(PointerConstraintsUnstableV1, zwp_pointer_constraints_v1)
 BIND(PresentationManager, wp_presentation)
 BIND(PrimarySelectionDeviceManager, zwp_primary_selection_device_manager_v1)
 BIND(SecurityContextManagerV1, wp_security_context_manager_v1)
+BIND(ImageCopyCaptureManagerV1, ext_image_copy_capture_manager_v1)
+BIND(OutputImageCaptureSourceManagerV1, ext_output_image_capture_source_manager_v1)
+BIND(CursorShapeManagerV1, wp_cursor_shape_manager_v1)
+BIND(ContentTypeManagerV1, wp_content_type_manager_v1)
+BIND(CommitTimingManagerV1, wp_commit_timing_manager_v1)
+BIND(FifoManagerV1, wp_fifo_manager_v1)
+BIND(FractionalScaleManagerV1, wp_fractional_scale_manager_v1)
+BIND(TearingControlManagerV1, wp_tearing_control_manager_v1)
+BIND(LinuxDrmSyncobjManagerV1, wp_linux_drm_syncobj_manager_v1)
+BIND(SinglePixelBufferManagerV1, wp_single_pixel_buffer_manager_v1)
 BIND(XdgActivationV1, xdg_activation_v1)
 BIND(XdgExporterUnstableV2, zxdg_exporter_v2)
 BIND(XdgImporterUnstableV2, zxdg_importer_v2)
@@ -1059,6 +1202,81 @@ Registry::createSecurityContextManagerV1(quint32 name, quint32 version, QObject*
         name, version, parent, &Registry::bindSecurityContextManagerV1);
 }
 
+image_copy_capture_manager_v1*
+Registry::createImageCopyCaptureManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<image_copy_capture_manager_v1>(
+        name, version, parent, &Registry::bindImageCopyCaptureManagerV1);
+}
+
+output_image_capture_source_manager_v1*
+Registry::createOutputImageCaptureSourceManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<output_image_capture_source_manager_v1>(
+        name, version, parent, &Registry::bindOutputImageCaptureSourceManagerV1);
+}
+
+plasma_stacking_order_manager_v1*
+Registry::createPlasmaStackingOrderManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<plasma_stacking_order_manager_v1>(
+        name, version, parent, &Registry::bindPlasmaStackingOrderManagerV1);
+}
+
+cursor_shape_manager_v1*
+Registry::createCursorShapeManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<cursor_shape_manager_v1>(
+        name, version, parent, &Registry::bindCursorShapeManagerV1);
+}
+
+content_type_manager_v1*
+Registry::createContentTypeManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<content_type_manager_v1>(
+        name, version, parent, &Registry::bindContentTypeManagerV1);
+}
+
+commit_timing_manager_v1*
+Registry::createCommitTimingManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<commit_timing_manager_v1>(
+        name, version, parent, &Registry::bindCommitTimingManagerV1);
+}
+
+fifo_manager_v1* Registry::createFifoManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<fifo_manager_v1>(name, version, parent, &Registry::bindFifoManagerV1);
+}
+
+fractional_scale_manager_v1*
+Registry::createFractionalScaleManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<fractional_scale_manager_v1>(
+        name, version, parent, &Registry::bindFractionalScaleManagerV1);
+}
+
+tearing_control_manager_v1*
+Registry::createTearingControlManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<tearing_control_manager_v1>(
+        name, version, parent, &Registry::bindTearingControlManagerV1);
+}
+
+linux_drm_syncobj_manager_v1*
+Registry::createLinuxDrmSyncobjManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<linux_drm_syncobj_manager_v1>(
+        name, version, parent, &Registry::bindLinuxDrmSyncobjManagerV1);
+}
+
+single_pixel_buffer_manager_v1*
+Registry::createSinglePixelBufferManagerV1(quint32 name, quint32 version, QObject* parent)
+{
+    return d->create<single_pixel_buffer_manager_v1>(
+        name, version, parent, &Registry::bindSinglePixelBufferManagerV1);
+}
+
 text_input_manager_v3*
 Registry::createTextInputManagerV3(quint32 name, quint32 version, QObject* parent)
 {
@@ -56,9 +56,20 @@ struct org_kde_plasma_activation_feedback;
 struct org_kde_plasma_shell;
 struct org_kde_plasma_virtual_desktop_management;
 struct org_kde_plasma_window_management;
+struct wrapland_plasma_stacking_order_manager_v1;
 struct org_kde_kwin_server_decoration_palette_manager;
 struct wp_drm_lease_device_v1;
 struct wp_security_context_manager_v1;
+struct ext_image_copy_capture_manager_v1;
+struct ext_output_image_capture_source_manager_v1;
+struct wp_cursor_shape_manager_v1;
+struct wp_content_type_manager_v1;
+struct wp_commit_timing_manager_v1;
+struct wp_fifo_manager_v1;
+struct wp_fractional_scale_manager_v1;
+struct wp_tearing_control_manager_v1;
+struct wp_linux_drm_syncobj_manager_v1;
+struct wp_single_pixel_buffer_manager_v1;
 struct wp_viewporter;
 struct xdg_activation_v1;
 struct xdg_shell;
@@ -108,6 +119,7 @@ class plasma_activation_feedback;
 class PlasmaShell;
 class PlasmaVirtualDesktopManagement;
 class PlasmaWindowManagement;
+class plasma_stacking_order_manager_v1;
 class PointerConstraints;
 class PointerGestures;
 class PresentationManager;
@@ -120,6 +132,16 @@ class SlideManager;
 class Shell;
 class ShmPool;
 class security_context_manager_v1;
+class image_copy_capture_manager_v1;
+class output_image_capture_source_manager_v1;
+class cursor_shape_manager_v1;
+class content_type_manager_v1;
+class commit_timing_manager_v1;
+class fifo_manager_v1;
+class fractional_scale_manager_v1;
+class tearing_control_manager_v1;
+class linux_drm_syncobj_manager_v1;
+class single_pixel_buffer_manager_v1;
 class ServerSideDecorationPaletteManager;
 class SubCompositor;
 class TextInputManagerV2;
@@ -227,6 +249,17 @@ public:
         DrmLeaseDeviceV1,     ///< Refers to wp_drm_lease_device_v1, @since 0.523.0
         DataControlManagerV1, ///< Refers to zwlr_data_control_manager_v1 interface, @since 0.523.0
         SecurityContextManagerV1,
+        SinglePixelBufferManagerV1, ///< Refers to wp_single_pixel_buffer_manager_v1
+        LinuxDrmSyncobjManagerV1, ///< Refers to wp_linux_drm_syncobj_manager_v1
+        TearingControlManagerV1, ///< Refers to wp_tearing_control_manager_v1
+        FractionalScaleManagerV1, ///< Refers to wp_fractional_scale_manager_v1
+        FifoManagerV1, ///< Refers to wp_fifo_manager_v1
+        CommitTimingManagerV1, ///< Refers to wp_commit_timing_manager_v1
+        ContentTypeManagerV1, ///< Refers to wp_content_type_manager_v1
+        CursorShapeManagerV1, ///< Refers to wp_cursor_shape_manager_v1
+        OutputImageCaptureSourceManagerV1, ///< Refers to ext_output_image_capture_source_manager_v1
+        ImageCopyCaptureManagerV1, ///< Refers to ext_image_copy_capture_manager_v1
+        PlasmaStackingOrderManagerV1, ///< Refers to wrapland_plasma_stacking_order_manager_v1
     };
     explicit Registry(QObject* parent = nullptr);
     virtual ~Registry();
@@ -466,6 +499,15 @@ public:
      **/
     org_kde_plasma_window_management* bindPlasmaWindowManagement(uint32_t name,
                                                                  uint32_t version) const;
+    /**
+     * Binds the wrapland_plasma_stacking_order_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the wrapland_plasma_stacking_order_manager_v1
+     * interface, @c null will be returned.
+     *
+     * Prefer using createPlasmaStackingOrderManagerV1
+     */
+    wrapland_plasma_stacking_order_manager_v1*
+    bindPlasmaStackingOrderManagerV1(uint32_t name, uint32_t version) const;
     /**
      * Binds the ext_idle_notifier_v1 with @p name and @p version.
      * If the @p name does not exist or is not for the notifier interface,
@@ -576,6 +618,92 @@ public:
      */
     wp_security_context_manager_v1* bindSecurityContextManagerV1(uint32_t name,
                                                                  uint32_t version) const;
+    /**
+     * Binds the ext_image_copy_capture_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the ext_image_copy_capture_manager_v1 interface,
+     * @c null will be returned.
+     *
+     * Prefer using createImageCopyCaptureManagerV1
+     */
+    ext_image_copy_capture_manager_v1* bindImageCopyCaptureManagerV1(uint32_t name,
+                                                                     uint32_t version) const;
+    /**
+     * Binds the ext_output_image_capture_source_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the ext_output_image_capture_source_manager_v1
+     * interface, @c null will be returned.
+     *
+     * Prefer using createOutputImageCaptureSourceManagerV1
+     */
+    ext_output_image_capture_source_manager_v1*
+    bindOutputImageCaptureSourceManagerV1(uint32_t name, uint32_t version) const;
+    /**
+     * Binds the wp_cursor_shape_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the wp_cursor_shape_manager_v1 interface,
+     * @c null will be returned.
+     *
+     * Prefer using createCursorShapeManagerV1
+     */
+    wp_cursor_shape_manager_v1* bindCursorShapeManagerV1(uint32_t name, uint32_t version) const;
+    /**
+     * Binds the wp_content_type_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the wp_content_type_manager_v1 interface,
+     * @c null will be returned.
+     *
+     * Prefer using createContentTypeManagerV1
+     */
+    wp_content_type_manager_v1* bindContentTypeManagerV1(uint32_t name, uint32_t version) const;
+    /**
+     * Binds the wp_commit_timing_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the wp_commit_timing_manager_v1 interface,
+     * @c null will be returned.
+     *
+     * Prefer using createCommitTimingManagerV1
+     */
+    wp_commit_timing_manager_v1* bindCommitTimingManagerV1(uint32_t name, uint32_t version) const;
+    /**
+     * Binds the wp_fifo_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the wp_fifo_manager_v1 interface,
+     * @c null will be returned.
+     *
+     * Prefer using createFifoManagerV1
+     */
+    wp_fifo_manager_v1* bindFifoManagerV1(uint32_t name, uint32_t version) const;
+    /**
+     * Binds the wp_fractional_scale_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the wp_fractional_scale_manager_v1 interface,
+     * @c null will be returned.
+     *
+     * Prefer using createFractionalScaleManagerV1
+     */
+    wp_fractional_scale_manager_v1* bindFractionalScaleManagerV1(uint32_t name,
+                                                                 uint32_t version) const;
+    /**
+     * Binds the wp_tearing_control_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the wp_tearing_control_manager_v1 interface,
+     * @c null will be returned.
+     *
+     * Prefer using createTearingControlManagerV1
+     */
+    wp_tearing_control_manager_v1* bindTearingControlManagerV1(uint32_t name,
+                                                               uint32_t version) const;
+    /**
+     * Binds the wp_linux_drm_syncobj_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the wp_linux_drm_syncobj_manager_v1 interface,
+     * @c null will be returned.
+     *
+     * Prefer using createLinuxDrmSyncobjManagerV1
+     */
+    wp_linux_drm_syncobj_manager_v1* bindLinuxDrmSyncobjManagerV1(uint32_t name,
+                                                                  uint32_t version) const;
+    /**
+     * Binds the wp_single_pixel_buffer_manager_v1 with @p name and @p version.
+     * If the @p name does not exist or is not for the wp_single_pixel_buffer_manager_v1 interface,
+     * @c null will be returned.
+     *
+     * Prefer using createSinglePixelBufferManagerV1
+     */
+    wp_single_pixel_buffer_manager_v1* bindSinglePixelBufferManagerV1(uint32_t name,
+                                                                      uint32_t version) const;
     /**
      * Binds the org_kde_kwin_slide_manager with @p name and @p version.
      * If the @p name does not exist or is not for the slide manager interface,
@@ -1063,6 +1191,24 @@ public:
      **/
     PlasmaWindowManagement*
     createPlasmaWindowManagement(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a plasma_stacking_order_manager_v1 and sets it up to manage the interface identified
+     * by @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li wrapland_plasma_stacking_order_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the plasma_stacking_order_manager_v1
+     *
+     * @returns The created plasma_stacking_order_manager_v1
+     **/
+    plasma_stacking_order_manager_v1*
+    createPlasmaStackingOrderManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
     /**
      * Creates an Idle and sets it up to manage the interface identified by
      * @p name and @p version.
@@ -1182,6 +1328,187 @@ public:
      **/
     security_context_manager_v1*
     createSecurityContextManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a image_copy_capture_manager_v1 and sets it up to manage the interface identified by
+     * @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li ext_image_copy_capture_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the image_copy_capture_manager_v1
+     *
+     * @returns The created image_copy_capture_manager_v1
+     **/
+    image_copy_capture_manager_v1*
+    createImageCopyCaptureManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a output_image_capture_source_manager_v1 and sets it up to manage the interface
+     * identified by @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li ext_output_image_capture_source_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the output_image_capture_source_manager_v1
+     *
+     * @returns The created output_image_capture_source_manager_v1
+     **/
+    output_image_capture_source_manager_v1* createOutputImageCaptureSourceManagerV1(
+        quint32 name,
+        quint32 version,
+        QObject* parent = nullptr);
+    /**
+     * Creates a cursor_shape_manager_v1 and sets it up to manage the interface identified by
+     * @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li wp_cursor_shape_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the cursor_shape_manager_v1
+     *
+     * @returns The created cursor_shape_manager_v1
+     **/
+    cursor_shape_manager_v1*
+    createCursorShapeManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a content_type_manager_v1 and sets it up to manage the interface identified by
+     * @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li wp_content_type_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the content_type_manager_v1
+     *
+     * @returns The created content_type_manager_v1
+     **/
+    content_type_manager_v1*
+    createContentTypeManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a commit_timing_manager_v1 and sets it up to manage the interface identified by
+     * @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li wp_commit_timing_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the commit_timing_manager_v1
+     *
+     * @returns The created commit_timing_manager_v1
+     **/
+    commit_timing_manager_v1*
+    createCommitTimingManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a fifo_manager_v1 and sets it up to manage the interface identified by
+     * @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li wp_fifo_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the fifo_manager_v1
+     *
+     * @returns The created fifo_manager_v1
+     **/
+    fifo_manager_v1* createFifoManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a fractional_scale_manager_v1 and sets it up to manage the interface identified by
+     * @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li wp_fractional_scale_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the fractional_scale_manager_v1
+     *
+     * @returns The created fractional_scale_manager_v1
+     **/
+    fractional_scale_manager_v1*
+    createFractionalScaleManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a tearing_control_manager_v1 and sets it up to manage the interface identified by
+     * @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li wp_tearing_control_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the tearing_control_manager_v1
+     *
+     * @returns The created tearing_control_manager_v1
+     **/
+    tearing_control_manager_v1*
+    createTearingControlManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a linux_drm_syncobj_manager_v1 and sets it up to manage the interface identified by
+     * @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li wp_linux_drm_syncobj_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the linux_drm_syncobj_manager_v1
+     *
+     * @returns The created linux_drm_syncobj_manager_v1
+     **/
+    linux_drm_syncobj_manager_v1*
+    createLinuxDrmSyncobjManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
+    /**
+     * Creates a single_pixel_buffer_manager_v1 and sets it up to manage the interface identified by
+     * @p name and @p version.
+     *
+     * This factory method supports the following interfaces:
+     * @li wp_single_pixel_buffer_manager_v1
+     *
+     * If @p name is for one of the supported interfaces the corresponding manager will be created,
+     * otherwise @c null will be returned.
+     *
+     * @param name The name of the interface to bind
+     * @param version The version of the interface to use
+     * @param parent The parent for the single_pixel_buffer_manager_v1
+     *
+     * @returns The created single_pixel_buffer_manager_v1
+     **/
+    single_pixel_buffer_manager_v1*
+    createSinglePixelBufferManagerV1(quint32 name, quint32 version, QObject* parent = nullptr);
     /**
      * Creates a ShadowManager and sets it up to manage the interface identified by
      * @p name and @p version.
@@ -1763,6 +2090,12 @@ Q_SIGNALS:
      * @since 5.4
      **/
     void plasmaWindowManagementAnnounced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a wrapland_plasma_stacking_order_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void plasmaStackingOrderManagerV1Announced(quint32 name, quint32 version);
     /**
      * Emitted whenever a org_kde_kwin_idle interface gets announced.
      * @param name The name for the announced interface
@@ -1798,6 +2131,66 @@ Q_SIGNALS:
      * @param version The maximum supported version of the announced interface
      **/
     void securityContextManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a ext_image_copy_capture_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void imageCopyCaptureManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a ext_output_image_capture_source_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void outputImageCaptureSourceManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a wp_cursor_shape_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void cursorShapeManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a wp_content_type_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void contentTypeManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a wp_commit_timing_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void commitTimingManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a wp_fifo_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void fifoManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a wp_fractional_scale_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void fractionalScaleManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a wp_tearing_control_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void tearingControlManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a wp_linux_drm_syncobj_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void linuxDrmSyncobjManagerV1Announced(quint32 name, quint32 version);
+    /**
+     * Emitted whenever a wp_single_pixel_buffer_manager_v1 interface gets announced.
+     * @param name The name for the announced interface
+     * @param version The maximum supported version of the announced interface
+     **/
+    void singlePixelBufferManagerV1Announced(quint32 name, quint32 version);
     /**
      * Emitted whenever a org_kde_kwin_shadow_manager interface gets announced.
      * @param name The name for the announced interface
@@ -2008,6 +2401,56 @@ Q_SIGNALS:
      * @param name The name for the removed interface
      **/
     void securityContextManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a ext_image_copy_capture_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void imageCopyCaptureManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a ext_output_image_capture_source_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void outputImageCaptureSourceManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a wp_cursor_shape_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void cursorShapeManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a wp_content_type_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void contentTypeManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a wp_commit_timing_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void commitTimingManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a wp_fifo_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void fifoManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a wp_fractional_scale_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void fractionalScaleManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a wp_tearing_control_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void tearingControlManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a wp_linux_drm_syncobj_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void linuxDrmSyncobjManagerV1Removed(quint32 name);
+    /**
+     * Emitted whenever a wp_single_pixel_buffer_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void singlePixelBufferManagerV1Removed(quint32 name);
     /**
      * Emitted whenever a wl_shm interface gets removed.
      * @param name The name for the removed interface
@@ -2076,6 +2519,11 @@ Q_SIGNALS:
      * @since 5.4
      **/
     void plasmaWindowManagementRemoved(quint32 name);
+    /**
+     * Emitted whenever a wrapland_plasma_stacking_order_manager_v1 interface gets removed.
+     * @param name The name for the removed interface
+     **/
+    void plasmaStackingOrderManagerV1Removed(quint32 name);
     /**
      * Emitted whenever a org_kde_kwin_idle interface gets removed.
      * @param name The name for the removed interface
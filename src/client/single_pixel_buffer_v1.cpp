@@ -0,0 +1,86 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "single_pixel_buffer_v1.h"
+
+#include "event_queue.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-single-pixel-buffer-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN single_pixel_buffer_manager_v1::Private
+{
+public:
+    WaylandPointer<wp_single_pixel_buffer_manager_v1, wp_single_pixel_buffer_manager_v1_destroy>
+        manager;
+    EventQueue* queue = nullptr;
+};
+
+single_pixel_buffer_manager_v1::single_pixel_buffer_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+single_pixel_buffer_manager_v1::~single_pixel_buffer_manager_v1()
+{
+    release();
+}
+
+void single_pixel_buffer_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool single_pixel_buffer_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void single_pixel_buffer_manager_v1::setup(wp_single_pixel_buffer_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* single_pixel_buffer_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void single_pixel_buffer_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+wl_buffer* single_pixel_buffer_manager_v1::create_u32_rgba_buffer(uint32_t red,
+                                                                  uint32_t green,
+                                                                  uint32_t blue,
+                                                                  uint32_t alpha)
+{
+    Q_ASSERT(isValid());
+    auto buffer = wp_single_pixel_buffer_manager_v1_create_u32_rgba_buffer(
+        d->manager, red, green, blue, alpha);
+    if (d->queue) {
+        d->queue->addProxy(buffer);
+    }
+    return buffer;
+}
+
+single_pixel_buffer_manager_v1::operator wp_single_pixel_buffer_manager_v1*() const
+{
+    return d->manager;
+}
+
+single_pixel_buffer_manager_v1::operator wp_single_pixel_buffer_manager_v1*()
+{
+    return d->manager;
+}
+
+}
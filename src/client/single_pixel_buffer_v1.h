@@ -0,0 +1,98 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#pragma once
+
+#include <QObject>
+#include <Wrapland/Client/wraplandclient_export.h>
+#include <memory>
+
+struct wl_buffer;
+struct wp_single_pixel_buffer_manager_v1;
+
+namespace Wrapland::Client
+{
+
+class EventQueue;
+
+/**
+ * @short Wrapper for the wp_single_pixel_buffer_manager_v1 interface.
+ *
+ * Creates 1x1 buffers holding a single color. Such buffers are not backed by memory and are
+ * usually scaled to the wanted size with a Viewport.
+ *
+ * To use this class one needs to interact with the Registry. There are two
+ * possible ways to create the single_pixel_buffer_manager_v1 interface:
+ * @code
+ * auto m = registry->createSinglePixelBufferManagerV1(name, version);
+ * @endcode
+ *
+ * This creates the single_pixel_buffer_manager_v1 and sets it up directly. As an alternative this
+ * can also be done in a more low level way:
+ * @code
+ * auto m = new single_pixel_buffer_manager_v1;
+ * m->setup(registry->bindSinglePixelBufferManagerV1(name, version));
+ * @endcode
+ *
+ * @see Registry
+ **/
+class WRAPLANDCLIENT_EXPORT single_pixel_buffer_manager_v1 : public QObject
+{
+    Q_OBJECT
+public:
+    explicit single_pixel_buffer_manager_v1(QObject* parent = nullptr);
+    ~single_pixel_buffer_manager_v1() override;
+
+    /**
+     * @returns @c true if managing a wp_single_pixel_buffer_manager_v1.
+     **/
+    bool isValid() const;
+    /**
+     * Setup this single_pixel_buffer_manager_v1 to manage the @p manager.
+     * When using Registry::createSinglePixelBufferManagerV1 there is no need to call this
+     * method.
+     **/
+    void setup(wp_single_pixel_buffer_manager_v1* manager);
+    /**
+     * Releases the wp_single_pixel_buffer_manager_v1 interface.
+     * After the interface has been released the single_pixel_buffer_manager_v1 instance is no
+     * longer valid and can be setup with another wp_single_pixel_buffer_manager_v1 interface.
+     **/
+    void release();
+
+    /**
+     * Sets the @p queue to use for creating buffers.
+     **/
+    void setEventQueue(EventQueue* queue);
+    /**
+     * @returns The event queue to use for creating buffers.
+     **/
+    EventQueue* eventQueue();
+
+    /**
+     * Creates a 1x1 buffer with the given premultiplied color. The channels span the full range
+     * of an unsigned 32-bit integer. The caller takes ownership of the returned buffer and must
+     * destroy it with wl_buffer_destroy.
+     **/
+    wl_buffer* create_u32_rgba_buffer(uint32_t red, uint32_t green, uint32_t blue, uint32_t alpha);
+
+    operator wp_single_pixel_buffer_manager_v1*();
+    operator wp_single_pixel_buffer_manager_v1*() const;
+
+Q_SIGNALS:
+    /**
+     * The corresponding global for this interface on the Registry got removed.
+     *
+     * This signal gets only emitted if the manager got created by
+     * Registry::createSinglePixelBufferManagerV1
+     **/
+    void removed();
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}
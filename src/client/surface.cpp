@@ -49,6 +49,8 @@ public:
     QSize size;
     bool foreign = false;
     qint32 scale = 1;
+    qint32 preferred_buffer_scale = 1;
+    Output::Transform preferred_buffer_transform = Output::Transform::Normal;
 
     wl_callback* pendingFrameCallback = nullptr;
     QVector<Output*> outputs;
@@ -60,6 +62,9 @@ private:
     static void frameCallback(void* data, wl_callback* callback, uint32_t time);
     static void enterCallback(void* data, wl_surface* wl_surface, wl_output* output);
     static void leaveCallback(void* data, wl_surface* wl_surface, wl_output* output);
+    static void preferredBufferScaleCallback(void* data, wl_surface* wl_surface, int32_t factor);
+    static void
+    preferredBufferTransformCallback(void* data, wl_surface* wl_surface, uint32_t transform);
 
     Surface* q;
     static const wl_callback_listener s_listener;
@@ -172,6 +177,8 @@ const struct wl_callback_listener Surface::Private::s_listener = {
 const struct wl_surface_listener Surface::Private::s_surfaceListener = {
     enterCallback,
     leaveCallback,
+    preferredBufferScaleCallback,
+    preferredBufferTransformCallback,
 };
 #endif
 
@@ -206,6 +213,26 @@ void Surface::Private::leaveCallback(void* data, wl_surface* surface, wl_output*
     Q_EMIT s->q->outputLeft(o);
 }
 
+void Surface::Private::preferredBufferScaleCallback(void* data,
+                                                    wl_surface* surface,
+                                                    int32_t factor)
+{
+    Q_UNUSED(surface);
+    auto s = reinterpret_cast<Surface::Private*>(data);
+    s->preferred_buffer_scale = factor;
+    Q_EMIT s->q->preferredBufferScaleChanged();
+}
+
+void Surface::Private::preferredBufferTransformCallback(void* data,
+                                                        wl_surface* surface,
+                                                        uint32_t transform)
+{
+    Q_UNUSED(surface);
+    auto s = reinterpret_cast<Surface::Private*>(data);
+    s->preferred_buffer_transform = static_cast<Output::Transform>(transform);
+    Q_EMIT s->q->preferredBufferTransformChanged();
+}
+
 void Surface::Private::setupFrameCallback()
 {
     Q_ASSERT(!pendingFrameCallback);
@@ -257,6 +284,16 @@ void Surface::damageBuffer(QRect const& rect)
 void Surface::attachBuffer(wl_buffer* buffer, QPoint const& offset)
 {
     Q_ASSERT(isValid());
+
+    if (wl_surface_get_version(d->surface) >= WL_SURFACE_OFFSET_SINCE_VERSION) {
+        // Since version 5 the offset must be set with its own request.
+        if (!offset.isNull()) {
+            wl_surface_offset(d->surface, offset.x(), offset.y());
+        }
+        wl_surface_attach(d->surface, buffer, 0, 0);
+        return;
+    }
+
     wl_surface_attach(d->surface, buffer, offset.x(), offset.y());
 }
 
@@ -346,6 +383,16 @@ qint32 Surface::scale() const
     return d->scale;
 }
 
+qint32 Surface::preferredBufferScale() const
+{
+    return d->preferred_buffer_scale;
+}
+
+Output::Transform Surface::preferredBufferTransform() const
+{
+    return d->preferred_buffer_transform;
+}
+
 void Surface::setScale(qint32 scale)
 {
     d->scale = scale;
@@ -21,6 +21,7 @@ License along with this library.  If not, see <http://www.gnu.org/licenses/>.
 #define WAYLAND_SURFACE_H
 
 #include "buffer.h"
+#include "output.h"
 
 #include <QObject>
 #include <QPoint>
@@ -227,6 +228,18 @@ public:
      **/
     qint32 scale() const;
 
+    /**
+     * @returns The buffer scale the compositor prefers for this Surface, @c 1 if not sent.
+     * @see preferredBufferScaleChanged
+     **/
+    qint32 preferredBufferScale() const;
+    /**
+     * @returns The buffer transform the compositor prefers for this Surface, normal if not sent.
+     * Attaching buffers with this transform allows the compositor to avoid rotating them.
+     * @see preferredBufferTransformChanged
+     **/
+    Output::Transform preferredBufferTransform() const;
+
     operator wl_surface*();
     operator wl_surface*() const;
 
@@ -288,6 +301,17 @@ Q_SIGNALS:
      **/
     void outputLeft(Wrapland::Client::Output* o);
 
+    /**
+     * Emitted when the compositor sent a new preferred buffer scale.
+     * @see preferredBufferScale
+     **/
+    void preferredBufferScaleChanged();
+    /**
+     * Emitted when the compositor sent a new preferred buffer transform.
+     * @see preferredBufferTransform
+     **/
+    void preferredBufferTransformChanged();
+
 private:
     class Private;
     std::unique_ptr<Private> d;
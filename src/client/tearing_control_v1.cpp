@@ -0,0 +1,83 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "tearing_control_v1.h"
+
+#include "event_queue.h"
+#include "surface.h"
+#include "wayland_pointer_p.h"
+
+#include <wayland-tearing-control-v1-client-protocol.h>
+
+namespace Wrapland::Client
+{
+
+class Q_DECL_HIDDEN tearing_control_manager_v1::Private
+{
+public:
+    WaylandPointer<wp_tearing_control_manager_v1, wp_tearing_control_manager_v1_destroy>
+        manager;
+    EventQueue* queue = nullptr;
+};
+
+tearing_control_manager_v1::tearing_control_manager_v1(QObject* parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+tearing_control_manager_v1::~tearing_control_manager_v1()
+{
+    release();
+}
+
+void tearing_control_manager_v1::release()
+{
+    d->manager.release();
+}
+
+bool tearing_control_manager_v1::isValid() const
+{
+    return d->manager.isValid();
+}
+
+void tearing_control_manager_v1::setup(wp_tearing_control_manager_v1* manager)
+{
+    Q_ASSERT(manager);
+    Q_ASSERT(!d->manager.isValid());
+    d->manager.setup(manager);
+}
+
+EventQueue* tearing_control_manager_v1::eventQueue()
+{
+    return d->queue;
+}
+
+void tearing_control_manager_v1::setEventQueue(EventQueue* queue)
+{
+    d->queue = queue;
+}
+
+wp_tearing_control_v1* tearing_control_manager_v1::get_tearing_control(Surface* surface)
+{
+    Q_ASSERT(isValid());
+    auto control = wp_tearing_control_manager_v1_get_tearing_control(d->manager, *surface);
+    if (d->queue) {
+        d->queue->addProxy(control);
+    }
+    return control;
+}
+
+tearing_control_manager_v1::operator wp_tearing_control_manager_v1*() const
+{
+    return d->manager;
+}
+
+tearing_control_manager_v1::operator wp_tearing_control_manager_v1*()
+{
+    return d->manager;
+}
+
+}
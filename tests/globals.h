@@ -7,24 +7,33 @@
 
 #include "../../server/appmenu.h"
 #include "../../server/blur.h"
+#include "../../server/commit_timing_v1.h"
 #include "../../server/compositor.h"
+#include "../../server/content_type_v1.h"
 #include "../../server/contrast.h"
+#include "../../server/cursor_shape_v1.h"
 #include "../../server/data_control_v1.h"
 #include "../../server/data_device_manager.h"
 #include "../../server/dpms.h"
 #include "../../server/drm_lease_v1.h"
 #include "../../server/fake_input.h"
+#include "../../server/fifo_v1.h"
+#include "../../server/fractional_scale_v1.h"
 #include "../../server/idle_inhibit_v1.h"
 #include "../../server/idle_notify_v1.h"
+#include "../../server/image_capture_source_v1.h"
+#include "../../server/image_copy_capture_v1.h"
 #include "../../server/input_method_v2.h"
 #include "../../server/kde_idle.h"
 #include "../../server/keyboard_shortcuts_inhibit.h"
 #include "../../server/keystate.h"
 #include "../../server/layer_shell_v1.h"
 #include "../../server/linux_dmabuf_v1.h"
+#include "../../server/linux_drm_syncobj_v1.h"
 #include "../../server/output_manager.h"
 #include "../../server/plasma_activation_feedback.h"
 #include "../../server/plasma_shell.h"
+#include "../../server/plasma_stacking_order_v1.h"
 #include "../../server/plasma_virtual_desktop.h"
 #include "../../server/plasma_window.h"
 #include "../../server/pointer.h"
@@ -37,8 +46,10 @@
 #include "../../server/security_context_v1.h"
 #include "../../server/server_decoration_palette.h"
 #include "../../server/shadow.h"
+#include "../../server/single_pixel_buffer_v1.h"
 #include "../../server/slide.h"
 #include "../../server/subcompositor.h"
+#include "../../server/tearing_control_v1.h"
 #include "../../server/text_input_v2.h"
 #include "../../server/text_input_v3.h"
 #include "../../server/viewporter.h"
@@ -70,6 +81,17 @@ struct globals {
     std::unique_ptr<Server::linux_dmabuf_v1> linux_dmabuf_v1;
     std::unique_ptr<Server::Viewporter> viewporter;
     std::unique_ptr<Server::PresentationManager> presentation_manager;
+    std::unique_ptr<Server::single_pixel_buffer_manager_v1> single_pixel_buffer_manager_v1;
+    std::unique_ptr<Server::linux_drm_syncobj_manager_v1> linux_drm_syncobj_manager_v1;
+    std::unique_ptr<Server::tearing_control_manager_v1> tearing_control_manager_v1;
+    std::unique_ptr<Server::fractional_scale_manager_v1> fractional_scale_manager_v1;
+    std::unique_ptr<Server::fifo_manager_v1> fifo_manager_v1;
+    std::unique_ptr<Server::commit_timing_manager_v1> commit_timing_manager_v1;
+    std::unique_ptr<Server::content_type_manager_v1> content_type_manager_v1;
+    std::unique_ptr<Server::cursor_shape_manager_v1> cursor_shape_manager_v1;
+    std::unique_ptr<Server::output_image_capture_source_manager_v1>
+        output_image_capture_source_manager_v1;
+    std::unique_ptr<Server::image_copy_capture_manager_v1> image_copy_capture_manager_v1;
 
     /// Additional graphical effects
     std::unique_ptr<Server::ShadowManager> shadow_manager;
@@ -122,6 +144,7 @@ struct globals {
     std::unique_ptr<Server::PlasmaVirtualDesktopManager> plasma_virtual_desktop_manager;
     std::unique_ptr<Server::PlasmaShell> plasma_shell;
     std::unique_ptr<Server::PlasmaWindowManager> plasma_window_manager;
+    std::unique_ptr<Server::plasma_stacking_order_manager_v1> plasma_stacking_order_manager_v1;
 
     /// Hardware take-over and blocking
     std::unique_ptr<Server::idle_notifier_v1> idle_notifier_v1;
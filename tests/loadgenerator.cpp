@@ -0,0 +1,617 @@
+/*
+    SPDX-FileCopyrightText: 2026 Roman Gilg <subdiff@gmail.com>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only
+*/
+#include "../src/client/compositor.h"
+#include "../src/client/connection_thread.h"
+#include "../src/client/datadevice.h"
+#include "../src/client/datadevicemanager.h"
+#include "../src/client/datasource.h"
+#include "../src/client/event_queue.h"
+#include "../src/client/keyboard.h"
+#include "../src/client/presentation_time.h"
+#include "../src/client/registry.h"
+#include "../src/client/seat.h"
+#include "../src/client/shm_pool.h"
+#include "../src/client/subcompositor.h"
+#include "../src/client/subsurface.h"
+#include "../src/client/surface.h"
+#include "../src/client/text_input_v3.h"
+#include "../src/client/xdg_shell.h"
+
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QGuiApplication>
+#include <QThread>
+#include <QTimer>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <unistd.h>
+#include <vector>
+
+namespace Clt = Wrapland::Client;
+
+namespace
+{
+
+struct script_options {
+    bool toplevel{false};
+    bool subsurfaces{false};
+    bool selection{false};
+    bool text_input{false};
+
+    int rate{60};
+    int subsurface_count{4};
+    QSize size{256, 256};
+};
+
+/**
+ * Counters and latency samples of a single load client. Samples are in microseconds and measured
+ * from the commit request to the arrival of the respective event on the client.
+ */
+struct client_statistics {
+    std::vector<qint64> frame_latencies;
+    std::vector<qint64> presentation_latencies;
+
+    int frames{0};
+    int throttled{0};
+    int discarded{0};
+    int selections{0};
+    int text_input_commits{0};
+
+    bool connected{false};
+    bool died{false};
+};
+
+/**
+ * A single Wayland client connection that runs a load script on the thread it is moved to.
+ *
+ * All Wayland objects are created and destroyed on that thread. Call start and stop through
+ * queued invocations.
+ */
+class load_client : public QObject
+{
+public:
+    load_client(QString socket, script_options const& script)
+        : socket{std::move(socket)}
+        , script{script}
+    {
+    }
+
+    void start()
+    {
+        clock.start();
+        frame_timer = new QTimer(this);
+
+        connection = std::make_unique<Clt::ConnectionThread>();
+        if (!socket.isEmpty()) {
+            connection->setSocketName(socket);
+        }
+
+        connect(connection.get(),
+                &Clt::ConnectionThread::establishedChanged,
+                this,
+                [this](bool established) {
+                    if (established && !stats.connected) {
+                        stats.connected = true;
+                        setup_registry();
+                    }
+                });
+        connect(connection.get(), &Clt::ConnectionThread::connectionDied, this, [this] {
+            stats.died = true;
+            frame_timer->stop();
+        });
+        connect(connection.get(), &Clt::ConnectionThread::failed, this, [this] {
+            std::cerr << "Connection to " << socket.toStdString() << " failed." << std::endl;
+        });
+
+        connection->establishConnection();
+    }
+
+    void stop()
+    {
+        frame_timer->stop();
+
+        for (auto& [feedback, timestamp] : feedbacks) {
+            delete feedback;
+        }
+        feedbacks.clear();
+
+        text_input.reset();
+        text_input_manager.reset();
+        selection_source.reset();
+        data_device.reset();
+        data_device_manager.reset();
+        keyboard.reset();
+        seat.reset();
+
+        subsurfaces.clear();
+        child_surfaces.clear();
+        toplevel.reset();
+        surface.reset();
+
+        presentation.reset();
+        xdg_shell.reset();
+        subcompositor.reset();
+        shm.reset();
+        compositor.reset();
+        registry.reset();
+        queue.reset();
+        connection.reset();
+    }
+
+    client_statistics stats;
+
+private:
+    using Interface = Clt::Registry::Interface;
+
+    void setup_registry()
+    {
+        queue = std::make_unique<Clt::EventQueue>();
+        queue->setup(connection.get());
+
+        registry = std::make_unique<Clt::Registry>();
+        registry->setEventQueue(queue.get());
+
+        connect(registry.get(), &Clt::Registry::interfacesAnnounced, this, [this] {
+            setup_globals();
+            setup_script();
+        });
+
+        registry->create(connection->display());
+        registry->setup();
+    }
+
+    void setup_globals()
+    {
+        auto const iface = [this](Interface type) { return registry->interface(type); };
+
+        compositor.reset(registry->createCompositor(iface(Interface::Compositor).name,
+                                                    iface(Interface::Compositor).version));
+        shm.reset(registry->createShmPool(iface(Interface::Shm).name,
+                                          iface(Interface::Shm).version));
+
+        if (auto const xdg = iface(Interface::XdgShell); xdg.name) {
+            xdg_shell.reset(registry->createXdgShell(xdg.name, xdg.version));
+        }
+        if (auto const sub = iface(Interface::SubCompositor); sub.name) {
+            subcompositor.reset(registry->createSubCompositor(sub.name, sub.version));
+        }
+        if (auto const pres = iface(Interface::PresentationManager); pres.name) {
+            presentation.reset(registry->createPresentationManager(pres.name, pres.version));
+        }
+        if (auto const seat_iface = iface(Interface::Seat); seat_iface.name) {
+            seat.reset(registry->createSeat(seat_iface.name, seat_iface.version));
+        }
+        if (auto const ddm = iface(Interface::DataDeviceManager); ddm.name) {
+            data_device_manager.reset(registry->createDataDeviceManager(ddm.name, ddm.version));
+        }
+        if (auto const ti = iface(Interface::TextInputManagerV3); ti.name) {
+            text_input_manager.reset(registry->createTextInputManagerV3(ti.name, ti.version));
+        }
+    }
+
+    void setup_script()
+    {
+        if (!compositor || !compositor->isValid() || !shm || !shm->isValid()) {
+            std::cerr << "Compositor or shm global missing, load client idles." << std::endl;
+            return;
+        }
+
+        surface.reset(compositor->createSurface());
+
+        if (script.toplevel && xdg_shell) {
+            toplevel.reset(xdg_shell->create_toplevel(surface.get()));
+            connect(toplevel.get(), &Clt::XdgShellToplevel::configured, this, [this](auto serial) {
+                toplevel->ackConfigure(serial);
+            });
+
+            // Buffers may only be committed once the first configure event is acked.
+            connect(
+                toplevel.get(),
+                &Clt::XdgShellToplevel::configured,
+                this,
+                [this] { start_frame_timer(); },
+                Qt::SingleShotConnection);
+            toplevel->setTitle(QStringLiteral("Wrapland load generator"));
+
+            // Initial commit without buffer to receive the first configure event.
+            surface->commit(Clt::Surface::CommitFlag::None);
+        }
+
+        if (script.subsurfaces && subcompositor) {
+            setup_subsurface_tree();
+        }
+
+        if (seat && (script.selection || script.text_input)) {
+            setup_seat();
+        }
+
+        connect(surface.get(), &Clt::Surface::frameRendered, this, [this] {
+            if (frame_pending) {
+                stats.frame_latencies.push_back(now() - frame_commit_time);
+                frame_pending = false;
+            }
+        });
+
+        connect(frame_timer, &QTimer::timeout, this, [this] { render_frame(); });
+        frame_timer->setTimerType(Qt::PreciseTimer);
+
+        if (!toplevel) {
+            start_frame_timer();
+        }
+    }
+
+    void start_frame_timer()
+    {
+        frame_timer->start(std::max(1, 1000 / std::max(1, script.rate)));
+    }
+
+    /**
+     * Creates a binary tree of subsurfaces below the main surface. Child i is parented to the
+     * surface (i - 1) / 2 of the tree with the main surface as root.
+     */
+    void setup_subsurface_tree()
+    {
+        for (int i = 0; i < script.subsurface_count; i++) {
+            auto parent_index = (i - 1) / 2;
+            auto parent = i == 0 ? surface.get() : child_surfaces.at(parent_index).get();
+
+            child_surfaces.emplace_back(compositor->createSurface());
+            auto child = child_surfaces.back().get();
+
+            subsurfaces.emplace_back(subcompositor->createSubSurface(child, parent));
+            subsurfaces.back()->setPosition(QPoint(8 * (i + 1), 8 * (i + 1)));
+        }
+    }
+
+    void setup_seat()
+    {
+        connect(seat.get(), &Clt::Seat::hasKeyboardChanged, this, [this](bool has) {
+            if (!has || keyboard) {
+                return;
+            }
+            keyboard.reset(seat->createKeyboard());
+            connect(keyboard.get(), &Clt::Keyboard::entered, this, [this](auto serial) {
+                keyboard_serial = serial;
+            });
+        });
+
+        if (script.selection && data_device_manager) {
+            data_device.reset(data_device_manager->getDevice(seat.get()));
+        }
+        if (script.text_input && text_input_manager) {
+            text_input.reset(text_input_manager->get_text_input(seat.get()));
+            text_input->enable();
+            text_input->commit();
+        }
+    }
+
+    void render_frame()
+    {
+        if (frame_pending) {
+            // The compositor has not yet sent the frame callback of the previous commit. Like a
+            // well-behaved client we skip this tick instead of queuing up frames.
+            stats.throttled++;
+            return;
+        }
+
+        auto const color = static_cast<uchar>(stats.frames % 256);
+
+        for (auto& child : child_surfaces) {
+            attach_buffer(child.get(), script.size / 4, color);
+            child->commit(Clt::Surface::CommitFlag::None);
+        }
+
+        attach_buffer(surface.get(), script.size, color);
+
+        auto const commit_time = now();
+
+        if (presentation) {
+            auto feedback = presentation->createFeedback(surface.get());
+            feedbacks.emplace(feedback, commit_time);
+            connect(feedback, &Clt::PresentationFeedback::presented, this, [this, feedback] {
+                finish_feedback(feedback, true);
+            });
+            connect(feedback, &Clt::PresentationFeedback::discarded, this, [this, feedback] {
+                finish_feedback(feedback, false);
+            });
+        }
+
+        frame_commit_time = commit_time;
+        frame_pending = true;
+        surface->commit(Clt::Surface::CommitFlag::FrameCallback);
+        stats.frames++;
+
+        if (selection_interval_reached()) {
+            set_selection();
+        }
+        if (text_input) {
+            update_text_input();
+        }
+
+        connection->flush();
+    }
+
+    /// Microseconds since the client was started.
+    qint64 now() const
+    {
+        return clock.nsecsElapsed() / 1000;
+    }
+
+    void attach_buffer(Clt::Surface* target, QSize const& size, uchar color)
+    {
+        auto buffer = shm->getBuffer(size, size.width() * 4).lock();
+        if (!buffer) {
+            return;
+        }
+
+        buffer->setUsed(true);
+        std::memset(buffer->address(), color, size.width() * size.height() * 4);
+
+        target->attachBuffer(buffer);
+        target->damage(QRect(QPoint(0, 0), size));
+    }
+
+    void finish_feedback(Clt::PresentationFeedback* feedback, bool presented)
+    {
+        auto it = feedbacks.find(feedback);
+        if (it == feedbacks.end()) {
+            return;
+        }
+
+        if (presented) {
+            stats.presentation_latencies.push_back(now() - it->second);
+        } else {
+            stats.discarded++;
+        }
+
+        feedbacks.erase(it);
+        feedback->deleteLater();
+    }
+
+    bool selection_interval_reached() const
+    {
+        // Replace the selection roughly twice per second.
+        return data_device && stats.frames % std::max(1, script.rate / 2) == 0;
+    }
+
+    void set_selection()
+    {
+        auto source = std::unique_ptr<Clt::DataSource>(data_device_manager->createSource());
+        source->offer(QStringLiteral("text/plain"));
+
+        connect(source.get(),
+                &Clt::DataSource::sendDataRequested,
+                this,
+                [this](auto const& /*mimeType*/, qint32 fd) {
+                    auto const payload = QByteArray("wrapland load generator selection ")
+                        + QByteArray::number(stats.selections);
+                    [[maybe_unused]] auto written = write(fd, payload.constData(), payload.size());
+                    close(fd);
+                });
+
+        data_device->setSelection(keyboard_serial, source.get());
+        selection_source = std::move(source);
+        stats.selections++;
+    }
+
+    void update_text_input()
+    {
+        auto const text = "load generator frame " + std::to_string(stats.frames);
+        auto const cursor = static_cast<uint32_t>(text.size());
+
+        text_input->set_surrounding_text(
+            text, cursor, cursor, Clt::text_input_v3_change_cause::other);
+        text_input->set_cursor_rectangle(QRect(cursor, 0, 1, 16));
+        text_input->commit();
+        stats.text_input_commits++;
+    }
+
+    QString socket;
+    script_options script;
+
+    std::unique_ptr<Clt::ConnectionThread> connection;
+    std::unique_ptr<Clt::EventQueue> queue;
+    std::unique_ptr<Clt::Registry> registry;
+
+    std::unique_ptr<Clt::Compositor> compositor;
+    std::unique_ptr<Clt::ShmPool> shm;
+    std::unique_ptr<Clt::XdgShell> xdg_shell;
+    std::unique_ptr<Clt::SubCompositor> subcompositor;
+    std::unique_ptr<Clt::PresentationManager> presentation;
+    std::unique_ptr<Clt::Seat> seat;
+    std::unique_ptr<Clt::Keyboard> keyboard;
+    std::unique_ptr<Clt::DataDeviceManager> data_device_manager;
+    std::unique_ptr<Clt::DataDevice> data_device;
+    std::unique_ptr<Clt::DataSource> selection_source;
+    std::unique_ptr<Clt::text_input_manager_v3> text_input_manager;
+    std::unique_ptr<Clt::text_input_v3> text_input;
+
+    std::unique_ptr<Clt::Surface> surface;
+    std::unique_ptr<Clt::XdgShellToplevel> toplevel;
+    std::vector<std::unique_ptr<Clt::Surface>> child_surfaces;
+    std::vector<std::unique_ptr<Clt::SubSurface>> subsurfaces;
+
+    /// Pending presentation feedbacks with their commit timestamps in microseconds.
+    std::map<Clt::PresentationFeedback*, qint64> feedbacks;
+
+    QTimer* frame_timer{nullptr};
+    QElapsedTimer clock;
+    qint64 frame_commit_time{0};
+    bool frame_pending{false};
+    quint32 keyboard_serial{0};
+};
+
+qint64 percentile(std::vector<qint64> const& sorted, double fraction)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto const rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+    return sorted.at(std::clamp<size_t>(rank, 1, sorted.size()) - 1);
+}
+
+void print_latencies(std::string const& name, std::vector<qint64> samples)
+{
+    std::cout << std::left << std::setw(24) << name;
+
+    if (samples.empty()) {
+        std::cout << "no samples" << std::endl;
+        return;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    std::cout << "samples " << std::setw(8) << samples.size() << " p50 " << std::setw(8)
+              << percentile(samples, 0.5) << " p90 " << std::setw(8) << percentile(samples, 0.9)
+              << " p99 " << std::setw(8) << percentile(samples, 0.99) << " max "
+              << samples.back() << " (us)" << std::endl;
+}
+
+void print_report(std::vector<std::unique_ptr<load_client>> const& clients, int duration)
+{
+    client_statistics total;
+    int connected{0};
+    int died{0};
+
+    for (auto const& client : clients) {
+        auto const& stats = client->stats;
+        total.frame_latencies.insert(total.frame_latencies.end(),
+                                     stats.frame_latencies.begin(),
+                                     stats.frame_latencies.end());
+        total.presentation_latencies.insert(total.presentation_latencies.end(),
+                                            stats.presentation_latencies.begin(),
+                                            stats.presentation_latencies.end());
+        total.frames += stats.frames;
+        total.throttled += stats.throttled;
+        total.discarded += stats.discarded;
+        total.selections += stats.selections;
+        total.text_input_commits += stats.text_input_commits;
+        connected += stats.connected ? 1 : 0;
+        died += stats.died ? 1 : 0;
+    }
+
+    std::cout << "Clients connected:      " << connected << "/" << clients.size() << std::endl;
+    std::cout << "Connections died:       " << died << std::endl;
+    std::cout << "Frames committed:       " << total.frames << " ("
+              << total.frames / std::max(1, duration) << "/s)" << std::endl;
+    std::cout << "Frames throttled:       " << total.throttled << std::endl;
+    std::cout << "Presentations discarded:" << total.discarded << std::endl;
+    std::cout << "Selections set:         " << total.selections << std::endl;
+    std::cout << "Text input commits:     " << total.text_input_commits << std::endl;
+
+    print_latencies("Frame callback latency", total.frame_latencies);
+    print_latencies("Presentation latency", total.presentation_latencies);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral(
+        "Connects many Wayland clients to a compositor and reports its dispatch latencies."));
+    parser.addHelpOption();
+
+    QCommandLineOption socketOption(QStringLiteral("socket"),
+                                    QStringLiteral("Wayland socket to connect to."),
+                                    QStringLiteral("name"));
+    QCommandLineOption clientsOption(QStringLiteral("clients"),
+                                     QStringLiteral("Number of client connections."),
+                                     QStringLiteral("count"),
+                                     QStringLiteral("16"));
+    QCommandLineOption durationOption(QStringLiteral("duration"),
+                                      QStringLiteral("Run time in seconds."),
+                                      QStringLiteral("seconds"),
+                                      QStringLiteral("10"));
+    QCommandLineOption rateOption(QStringLiteral("rate"),
+                                  QStringLiteral("Frames per second committed by each client."),
+                                  QStringLiteral("fps"),
+                                  QStringLiteral("60"));
+    QCommandLineOption scriptOption(
+        QStringLiteral("script"),
+        QStringLiteral("Comma separated list of: toplevel, subsurfaces, selection, text-input."),
+        QStringLiteral("steps"),
+        QStringLiteral("toplevel"));
+    QCommandLineOption subsurfacesOption(QStringLiteral("subsurfaces"),
+                                         QStringLiteral("Number of subsurfaces per client."),
+                                         QStringLiteral("count"),
+                                         QStringLiteral("4"));
+    QCommandLineOption sizeOption(QStringLiteral("size"),
+                                  QStringLiteral("Edge length of the main surface in pixels."),
+                                  QStringLiteral("pixels"),
+                                  QStringLiteral("256"));
+    parser.addOptions({socketOption,
+                       clientsOption,
+                       durationOption,
+                       rateOption,
+                       scriptOption,
+                       subsurfacesOption,
+                       sizeOption});
+    parser.process(app);
+
+    script_options script;
+    for (auto const& step : parser.value(scriptOption).split(QLatin1Char(','))) {
+        auto const name = step.trimmed();
+        if (name == QLatin1String("toplevel")) {
+            script.toplevel = true;
+        } else if (name == QLatin1String("subsurfaces")) {
+            script.subsurfaces = true;
+        } else if (name == QLatin1String("selection")) {
+            script.selection = true;
+        } else if (name == QLatin1String("text-input")) {
+            script.text_input = true;
+        } else {
+            std::cerr << "Unknown script step: " << name.toStdString() << std::endl;
+            return 1;
+        }
+    }
+
+    script.rate = std::max(1, parser.value(rateOption).toInt());
+    script.subsurface_count = std::max(0, parser.value(subsurfacesOption).toInt());
+    auto const edge = std::max(4, parser.value(sizeOption).toInt());
+    script.size = QSize(edge, edge);
+
+    auto const client_count = std::max(1, parser.value(clientsOption).toInt());
+    auto const duration = std::max(1, parser.value(durationOption).toInt());
+
+    std::vector<std::unique_ptr<load_client>> clients;
+    std::vector<std::unique_ptr<QThread>> threads;
+
+    for (int i = 0; i < client_count; i++) {
+        auto client = std::make_unique<load_client>(parser.value(socketOption), script);
+        auto thread = std::make_unique<QThread>();
+
+        client->moveToThread(thread.get());
+        thread->start();
+        QMetaObject::invokeMethod(client.get(), [client = client.get()] { client->start(); });
+
+        clients.push_back(std::move(client));
+        threads.push_back(std::move(thread));
+    }
+
+    QTimer::singleShot(duration * 1000, &app, [&] {
+        for (size_t i = 0; i < clients.size(); i++) {
+            QMetaObject::invokeMethod(
+                clients.at(i).get(),
+                [client = clients.at(i).get()] { client->stop(); },
+                Qt::BlockingQueuedConnection);
+            threads.at(i)->quit();
+            threads.at(i)->wait();
+        }
+
+        print_report(clients, duration);
+        app.quit();
+    });
+
+    return app.exec();
+}